@@ -9,6 +9,10 @@
 
 #include "ip_cores_memory_map.hpp"
 
+#ifdef MMPP_MOCK
+#include "peripherals/register_file.hpp"
+#endif
+
 namespace hal
 {
     class Top
@@ -24,10 +28,32 @@ namespace hal
             return m_instance.m_registers;
         }
 
+#ifdef MMPP_MOCK
+        //! Provides the memory holding the registers on the host, where the FPGA cannot be mapped. Its access
+        //! counters and models of the IP cores are used to run and benchmark the HAL objects on the host.
+        //!
+        //! @return Register file backing the register shifts Top class
+        static RegisterFile& registers()
+        {
+            static RegisterFile m_registers_file(ipCores::Top::size);
+            return m_registers_file;
+        }
+#endif
+
       private:
         Top()
-            : m_registers(reinterpret_cast<uint8_t*>(fgc4::utils::constants::fpga_base_address))
+            : m_registers(baseAddress())
+        {
+        }
+
+        //! @return Base address of the register map: the FPGA on the target, a register file on the host
+        static uint8_t* baseAddress()
         {
+#ifdef MMPP_MOCK
+            return registers().data();
+#else
+            return reinterpret_cast<uint8_t*>(fgc4::utils::constants::fpga_base_address);
+#endif
         }
 
         ipCores::Top m_registers;
@@ -0,0 +1,39 @@
+//! @file
+//! @brief Defines a bulk read of a block of consecutive registers using wide loads.
+//! @author Dominik Arominski
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mmpp.h>
+
+namespace hal
+{
+    //! Copies a block of consecutive 32-bit registers into a frame using 64-bit loads, so that the CPU issues one load,
+    //! and stalls on one uncached access to device memory, for each pair of registers. The number of bus transactions
+    //! is not reduced for IP cores behind a 32-bit AXI-Lite slave, such as the ADC: the interconnect splits each
+    //! 64-bit load into two 32-bit transactions, so the bus traffic is that of reading the registers one by one.
+    //!
+    //! @tparam words Number of 32-bit registers in the block, even
+    //! @param source Address of the first register of the block, aligned to 64 bits
+    //! @param frame Frame receiving the values of the registers, in order
+    template<size_t words>
+    void burstRead(const uint8_t* source, std::array<uint32_t, words>& frame)
+    {
+        static_assert(words % 2 == 0, "The block needs to be made of pairs of 32-bit registers.");
+
+        for (size_t index = 0; index < words; index += 2)
+        {
+#ifdef MMPP_MOCK
+            const uint64_t pair = mmpp::mock::read<uint64_t>(const_cast<uint8_t*>(source) + index * sizeof(uint32_t));
+#else
+            const uint64_t pair = reinterpret_cast<const volatile uint64_t*>(source)[index / 2];
+#endif
+            frame[index]     = static_cast<uint32_t>(pair);
+            frame[index + 1] = static_cast<uint32_t>(pair >> 32);
+        }
+    }
+
+}   // namespace hal
@@ -2,7 +2,13 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <mmpp.h>
+
+#ifdef MMPP_MOCK
+#include "register_file.hpp"
+#endif
 
 namespace hal
 {
@@ -20,6 +26,19 @@ namespace hal
         {
         }
 
+#ifdef MMPP_MOCK
+        //! Constructor for a bus backed by a register file, to run the HAL on the host. All reads and writes go
+        //! through the register file, which counts them.
+        //!
+        //! @param registers Register file standing in for the memory, expected to outlive the bus
+        explicit Bus(RegisterFile& registers)
+            : base(registers.data()),
+              len(registers.size()),
+              m_registers(&registers)
+        {
+        }
+#endif
+
         //! Returns a direct access to the memory-mapped data.
         //!
         //! @return Pointer to the base address of accessed memory
@@ -42,6 +61,12 @@ namespace hal
         //! @return Value at the chosen address (as unsigned int)
         uint32_t read(size_t offset) const
         {
+#ifdef MMPP_MOCK
+            if (m_registers != nullptr)
+            {
+                return m_registers->read(offset);
+            }
+#endif
             return *reinterpret_cast<volatile uint32_t*>(base + offset);
         }
 
@@ -51,6 +76,13 @@ namespace hal
         //! @param value Value to be written
         void write(size_t offset, uint32_t value)
         {
+#ifdef MMPP_MOCK
+            if (m_registers != nullptr)
+            {
+                m_registers->write(offset, value);
+                return;
+            }
+#endif
             *reinterpret_cast<volatile uint32_t*>(base + offset) = value;
         }
 
@@ -63,6 +95,9 @@ namespace hal
       private:
         volatile uint8_t* base;
         size_t            len;
+#ifdef MMPP_MOCK
+        RegisterFile* m_registers{nullptr};   //!< Register file backing the bus on the host, if any
+#endif
     };
 
 }   // namespace hal
\ No newline at end of file
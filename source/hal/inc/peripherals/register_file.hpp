@@ -0,0 +1,390 @@
+//! @file
+//! @brief Defines a memory-backed register file counting the accesses to each register, to run and benchmark the
+//! hardware abstraction layer on the host.
+//! @author Dominik Arominski
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <vector>
+
+namespace hal
+{
+    class RegisterFile;
+
+    //! Behavioural model of an IP core mapped in a RegisterFile, reacting to the accesses to its registers the way
+    //! the gateware would, e.g. by raising a busy flag after a start bit has been written.
+    class RegisterModel
+    {
+      public:
+        virtual ~RegisterModel() = default;
+
+        //! Called before a register of the model is read, so that its value can be updated.
+        //!
+        //! @param registers Register file holding the registers of the model
+        //! @param offset Offset of the register from the base of the model, in bytes
+        virtual void beforeRead(RegisterFile& registers, size_t offset) = 0;
+
+        //! Called after a register of the model has been written.
+        //!
+        //! @param registers Register file holding the registers of the model
+        //! @param offset Offset of the register from the base of the model, in bytes
+        //! @param value Written value
+        virtual void afterWrite(RegisterFile& registers, size_t offset, uint32_t value) = 0;
+    };
+
+    //! Number of accesses to a single register of a RegisterFile
+    struct RegisterAccesses
+    {
+        size_t   offset{0};   //!< Offset of the register, in bytes
+        uint64_t reads{0};    //!< Number of reads
+        uint64_t writes{0};   //!< Number of writes
+    };
+
+    //! Plain memory standing in for the memory-mapped registers of the FPGA, so that the hardware abstraction layer
+    //! can run on the host. Each access goes through read or write, which count the accesses per 32-bit register:
+    //! the count is the main proxy for the cost of the AXI bus, as each access is an uncached bus transaction on the
+    //! target. Models of IP cores can be attached to address ranges to emulate their handshakes.
+    //!
+    //! Register files register themselves on construction, so that accesses by address can be routed to the file
+    //! holding that address. It is meant for host-side tests and benchmarks only, and is not thread-safe.
+    class RegisterFile
+    {
+        static constexpr size_t word_size = sizeof(uint32_t);
+
+      public:
+        //! Constructor for a zero-initialised register file.
+        //!
+        //! @param size Size of the register file, in bytes
+        explicit RegisterFile(const size_t size)
+            : m_size(size),
+              m_memory(new(std::align_val_t{64}) uint8_t[size]{}),
+              m_reads(size / word_size, 0),
+              m_writes(size / word_size, 0)
+        {
+            m_next = first();
+            first() = this;
+        }
+
+        RegisterFile(const RegisterFile&)            = delete;
+        RegisterFile& operator=(const RegisterFile&) = delete;
+
+        ~RegisterFile()
+        {
+            RegisterFile** link = &first();
+            while (*link != this)
+            {
+                link = &(*link)->m_next;
+            }
+            *link = m_next;
+        }
+
+        //! Provides the register file holding the provided address.
+        //!
+        //! @param address Address of a register
+        //! @return Pointer to the register file holding the address, nullptr if there is none
+        [[nodiscard]] static RegisterFile* find(const volatile void* address) noexcept
+        {
+            for (RegisterFile* file = first(); file != nullptr; file = file->m_next)
+            {
+                if (file->contains(address))
+                {
+                    return file;
+                }
+            }
+            return nullptr;
+        }
+
+        //! Returns the memory holding the registers, to be used as the base address of the IP cores.
+        //!
+        //! @return Pointer to the first byte of the register file
+        [[nodiscard]] uint8_t* data() const noexcept
+        {
+            return m_memory.get();
+        }
+
+        //! Returns the size of the register file.
+        //!
+        //! @return Size of the register file, in bytes
+        [[nodiscard]] size_t size() const noexcept
+        {
+            return m_size;
+        }
+
+        //! Checks whether the provided address lies within the register file.
+        //!
+        //! @param address Address to be checked
+        //! @return True if the address belongs to the register file, false otherwise
+        [[nodiscard]] bool contains(const volatile void* address) const noexcept
+        {
+            const auto* byte = static_cast<const volatile uint8_t*>(address);
+            return byte >= m_memory.get() && byte < m_memory.get() + m_size;
+        }
+
+        //! Returns the offset of the provided address from the base of the register file.
+        //!
+        //! @param address Address within the register file
+        //! @return Offset of the address, in bytes
+        [[nodiscard]] size_t offsetOf(const volatile void* address) const noexcept
+        {
+            return static_cast<size_t>(static_cast<const volatile uint8_t*>(address) - m_memory.get());
+        }
+
+        // ************************************************************
+        // Counted accesses
+
+        //! Reads a 32-bit register, counting the access and letting the attached model update it first.
+        //!
+        //! @param offset Offset of the register, in bytes
+        //! @return Value of the register
+        uint32_t read(const size_t offset)
+        {
+            checkOffset(offset, word_size);
+            if (const auto* mapping = findModel(offset); mapping != nullptr)
+            {
+                mapping->model->beforeRead(*this, offset - mapping->base);
+            }
+            m_reads[offset / word_size]++;
+            return peek(offset);
+        }
+
+        //! Reads two adjacent 32-bit registers with a single 64-bit access, as a wide load does on the target. The
+        //! access is counted against both registers, as the 32-bit AXI-Lite slaves of the IP cores serve it in two
+        //! transactions, and the attached model is notified of both.
+        //!
+        //! @param offset Offset of the lower register, in bytes, aligned to 64 bits
+        //! @return Value of the lower register in the low word and of the upper register in the high word
+        uint64_t readWide(const size_t offset)
+        {
+            checkOffset(offset, 2 * word_size);
+            if (offset % (2 * word_size) != 0)
+            {
+                throw std::out_of_range("Wide register access not aligned to 64 bits.\n");
+            }
+            for (const size_t word : {offset, offset + word_size})
+            {
+                if (const auto* mapping = findModel(word); mapping != nullptr)
+                {
+                    mapping->model->beforeRead(*this, word - mapping->base);
+                }
+                m_reads[word / word_size]++;
+            }
+            return static_cast<uint64_t>(peek(offset)) | (static_cast<uint64_t>(peek(offset + word_size)) << 32);
+        }
+
+        //! Writes a 32-bit register, counting the access and notifying the attached model afterwards.
+        //!
+        //! @param offset Offset of the register, in bytes
+        //! @param value Value to be written
+        void write(const size_t offset, const uint32_t value)
+        {
+            checkOffset(offset, word_size);
+            m_writes[offset / word_size]++;
+            poke(offset, value);
+            if (const auto* mapping = findModel(offset); mapping != nullptr)
+            {
+                mapping->model->afterWrite(*this, offset - mapping->base, value);
+            }
+        }
+
+        // ************************************************************
+        // Uncounted accesses, for models and tests
+
+        //! Reads a 32-bit register without counting the access.
+        //!
+        //! @param offset Offset of the register, in bytes
+        //! @return Value of the register
+        [[nodiscard]] uint32_t peek(const size_t offset) const
+        {
+            checkOffset(offset, word_size);
+            uint32_t value;
+            std::memcpy(&value, m_memory.get() + offset, word_size);
+            return value;
+        }
+
+        //! Writes a 32-bit register without counting the access.
+        //!
+        //! @param offset Offset of the register, in bytes
+        //! @param value Value to be written
+        void poke(const size_t offset, const uint32_t value)
+        {
+            checkOffset(offset, word_size);
+            std::memcpy(m_memory.get() + offset, &value, word_size);
+        }
+
+        // ************************************************************
+        // Models
+
+        //! Attaches a behavioural model to a range of registers. Only the first model attached to an address
+        //! is notified of its accesses.
+        //!
+        //! @param model Model of the IP core, to be detached before it is destroyed
+        //! @param base Offset of the first register of the IP core, in bytes
+        //! @param size Size of the address range of the IP core, in bytes
+        void attach(RegisterModel& model, const size_t base, const size_t size)
+        {
+            checkOffset(base, size);
+            m_models.push_back({&model, base, size});
+        }
+
+        //! Detaches a behavioural model from all the ranges of registers it was attached to.
+        //!
+        //! @param model Model of the IP core
+        void detach(const RegisterModel& model) noexcept
+        {
+            std::erase_if(
+                m_models,
+                [&model](const ModelMapping& mapping)
+                {
+                    return mapping.model == &model;
+                }
+            );
+        }
+
+        // ************************************************************
+        // Statistics
+
+        //! Returns the number of reads of a register.
+        //!
+        //! @param offset Offset of the register, in bytes
+        //! @return Number of reads since construction or the last reset
+        [[nodiscard]] uint64_t reads(const size_t offset) const
+        {
+            checkOffset(offset, word_size);
+            return m_reads[offset / word_size];
+        }
+
+        //! Returns the number of writes of a register.
+        //!
+        //! @param offset Offset of the register, in bytes
+        //! @return Number of writes since construction or the last reset
+        [[nodiscard]] uint64_t writes(const size_t offset) const
+        {
+            checkOffset(offset, word_size);
+            return m_writes[offset / word_size];
+        }
+
+        //! Returns the number of reads of all registers.
+        //!
+        //! @return Number of reads since construction or the last reset
+        [[nodiscard]] uint64_t totalReads() const noexcept
+        {
+            return sum(m_reads);
+        }
+
+        //! Returns the number of writes of all registers.
+        //!
+        //! @return Number of writes since construction or the last reset
+        [[nodiscard]] uint64_t totalWrites() const noexcept
+        {
+            return sum(m_writes);
+        }
+
+        //! Lists the registers accessed at least once, in the order of their offsets. Divided by the number of ticks
+        //! run since the last reset, it gives the bus transactions of each register per tick.
+        //!
+        //! @return Number of reads and writes of each accessed register
+        [[nodiscard]] std::vector<RegisterAccesses> report() const
+        {
+            std::vector<RegisterAccesses> accesses;
+            for (size_t index = 0; index < m_reads.size(); index++)
+            {
+                if (m_reads[index] != 0 || m_writes[index] != 0)
+                {
+                    accesses.push_back({index * word_size, m_reads[index], m_writes[index]});
+                }
+            }
+            return accesses;
+        }
+
+        //! Resets the access counters of all registers.
+        void resetCounters() noexcept
+        {
+            std::fill(m_reads.begin(), m_reads.end(), 0);
+            std::fill(m_writes.begin(), m_writes.end(), 0);
+        }
+
+      private:
+        //! Range of registers handled by a model
+        struct ModelMapping
+        {
+            RegisterModel* model;   //!< Model of the IP core
+            size_t         base;    //!< Offset of the first register, in bytes
+            size_t         size;    //!< Size of the address range, in bytes
+        };
+
+        //! Deleter releasing the over-aligned memory of the registers
+        struct AlignedDelete
+        {
+            void operator()(uint8_t* memory) const noexcept
+            {
+                ::operator delete[](memory, std::align_val_t{64});
+            }
+        };
+
+        size_t                                    m_size;            //!< Size of the register file, in bytes
+        std::unique_ptr<uint8_t[], AlignedDelete> m_memory;          //!< Memory holding the registers
+        std::vector<uint64_t>                     m_reads;           //!< Number of reads of each register
+        std::vector<uint64_t>                     m_writes;          //!< Number of writes of each register
+        std::vector<ModelMapping>                 m_models;          //!< Models attached to ranges of registers
+        RegisterFile*                             m_next{nullptr};   //!< Next register file in the list of all files
+
+        //! Provides the head of the list of all register files.
+        //!
+        //! @return Reference to the first register file of the list
+        static RegisterFile*& first() noexcept
+        {
+            static RegisterFile* head{nullptr};
+            return head;
+        }
+
+        //! Sums the provided counters.
+        //!
+        //! @param counters Counters of each register
+        //! @return Sum of all counters
+        static uint64_t sum(const std::vector<uint64_t>& counters) noexcept
+        {
+            uint64_t total = 0;
+            for (const auto counter : counters)
+            {
+                total += counter;
+            }
+            return total;
+        }
+
+        //! Provides the model handling the register at the provided offset.
+        //!
+        //! @param offset Offset of the register, in bytes
+        //! @return Pointer to the mapping of the model, nullptr if no model handles the register
+        [[nodiscard]] const ModelMapping* findModel(const size_t offset) const noexcept
+        {
+            for (const auto& mapping : m_models)
+            {
+                if (offset >= mapping.base && offset < mapping.base + mapping.size)
+                {
+                    return &mapping;
+                }
+            }
+            return nullptr;
+        }
+
+        //! Throws if the provided range does not fit in the register file.
+        //!
+        //! @param offset Offset of the first byte of the range
+        //! @param length Length of the range, in bytes
+        void checkOffset(const size_t offset, const size_t length) const
+        {
+            if (offset + length > m_size || offset % word_size != 0)
+            {
+                throw std::out_of_range("Register access outside of the register file or not aligned to 32 bits.\n");
+            }
+        }
+    };
+
+}   // namespace hal
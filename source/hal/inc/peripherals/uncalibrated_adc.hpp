@@ -4,7 +4,14 @@
 
 #pragma once
 
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+
+#include "burst_read.hpp"
 #include "cheby_gen/mb_top_singleton.hpp"
+#include "pollCpuClock.hpp"
 
 namespace hal
 {
@@ -20,9 +27,20 @@ namespace hal
         // Constant holding the number of ADC ports
         constexpr static uint32_t adc_number_ports = ipCores::Top::AdcUncalintArrayItem::Adc::DataArray::size;
 
+        // Timeout of the blocking start
+        constexpr static std::chrono::seconds start_timeout{1};
+        // Time from the start bit after which a cleared busy flag means the conversion has ended, even if the flag
+        // has not been seen raised. Longer than the delay of the rising edge of the busy flag, which comes late e.g.
+        // with an external busy source.
+        constexpr static std::chrono::microseconds minimum_conversion_time{5};
+        // Width of the pulse resetting the external ADC
+        constexpr static std::chrono::milliseconds hardware_reset_pulse{1};
+
       public:
         //! Constructor for an uncalibrated ADC controller.
         UncalibratedADC() noexcept
+            : m_start_timeout_cycles(fgc4::utils::toCounterCycles(start_timeout)),
+              m_minimum_conversion_cycles(fgc4::utils::toCounterCycles(minimum_conversion_time))
         {
             m_regs = hal::Top::instance().adcUncalint[adc_id].adc;
             // TMP: IP core needs to be configured before use, eventually this will be handled by FGC4 configurator
@@ -73,26 +91,109 @@ namespace hal
         void resetHardware() noexcept
         {
             m_regs.ctrl.hwReset.set(true);
-            sleep(0.001);
+            fgc4::utils::waitFor(hardware_reset_pulse);
             m_regs.ctrl.write(0x0);
         }
 
         //! Start conversion and transmission from ADC, block until done.
         void start()
+        {
+            trigger();
+            if (!poll(m_start_timeout_cycles))
+            {
+                throw std::runtime_error("ADC conversion timeout.\n");
+            }
+        }
+
+        // ************************************************************
+        // Split-phase acquisition
+
+        //! Starts a conversion and returns immediately, so that the conversion runs while other work is done. The
+        //! samples are to be collected once poll or collect report the conversion finished.
+        void trigger() noexcept
         {
             m_regs.ctrl.start.set(true);
-            uint32_t counter = 0;
-            while (!m_regs.status.busy.get())
+            m_trigger_time = fgc4::utils::read_CNTPCT();
+            m_busy_seen    = false;
+        }
+
+        //! Checks once whether the last triggered conversion has finished. The busy flag rises some time after the
+        //! start bit is written, so a cleared flag means the conversion has finished once the flag has been seen
+        //! raised, or once the minimum conversion time has elapsed since the trigger. The latter covers conversions
+        //! collected after they have ended, without the busy pulse being seen.
+        //!
+        //! @return True if the samples of the conversion are available, false otherwise
+        [[nodiscard]] bool isReady() noexcept
+        {
+            if (m_regs.status.busy.get())
             {
-                sleep(0.001);
-                // infinite loop possible while waiting? limit this to a couple of seconds wait?
-                if (counter++ > 1'000)   // 5 s wait
+                m_busy_seen = true;
+                return false;
+            }
+            return m_busy_seen || fgc4::utils::read_CNTPCT() - m_trigger_time >= m_minimum_conversion_cycles;
+        }
+
+        //! Polls the status of the last triggered conversion until it finishes or the timeout elapses. The time from
+        //! the trigger to the end of the conversion is recorded on success, and the timeout counted otherwise. For a
+        //! conversion that ended before the poll, the recorded time is the time to the poll.
+        //!
+        //! @param timeout_cycles Maximal time from the trigger to the end of the conversion, in system counter cycles
+        //! @return True if the conversion finished in time, false otherwise
+        [[nodiscard]] bool poll(const uint64_t timeout_cycles) noexcept
+        {
+            while (!isReady())
+            {
+                if (fgc4::utils::read_CNTPCT() - m_trigger_time > timeout_cycles)
                 {
-                    throw std::runtime_error("ADC start timeout after 1 s.\n");
+                    m_timeouts++;
+                    return false;
                 }
             }
+            m_conversion_cycles = fgc4::utils::read_CNTPCT() - m_trigger_time;
+            return true;
+        }
+
+        //! Waits for the end of the last triggered conversion with a bounded poll, and reads all ports in a burst.
+        //! Every port costs a bus transaction, so when only some ports are used, poll and read them one by one instead.
+        //!
+        //! @param timeout_cycles Maximal time from the trigger to the end of the conversion, in system counter cycles
+        //! @return True if the conversion finished in time and the frame holds its samples, false otherwise
+        [[nodiscard]] bool collect(const uint64_t timeout_cycles) noexcept
+        {
+            if (!poll(timeout_cycles))
+            {
+                return false;
+            }
+            readAllPorts();
+            return true;
+        }
+
+        //! Returns the frame filled by the last collect or readAllPorts.
+        //!
+        //! @return Cache-aligned frame with the raw ADC values
+        [[nodiscard]] const std::array<uint32_t, adc_number_ports>& frame() const noexcept
+        {
+            return m_values;
         }
 
+        //! Returns the time from the trigger to the end of the last conversion that finished in time.
+        //!
+        //! @return Duration of the conversion, in system counter cycles
+        [[nodiscard]] uint64_t conversionCycles() const noexcept
+        {
+            return m_conversion_cycles;
+        }
+
+        //! Returns the number of conversions which did not finish within the timeout.
+        //!
+        //! @return Number of timeouts since construction
+        [[nodiscard]] uint64_t timeouts() const noexcept
+        {
+            return m_timeouts;
+        }
+
+        // ************************************************************
+
         //! Read data received from an ADC port.
         //!
         //! @param port_index Port index
@@ -102,16 +203,29 @@ namespace hal
             return m_regs.data[port_index].value.read();
         }
 
-        //! Reads data from all ports sequentially and returns the read values.
+        //! Reads data from all ports with wide loads over the block of data registers, issuing half as many loads as
+        //! reading the ports one by one. This is not a bulk transfer: the IP core exposes each sample in its own 32-bit
+        //! register, without a FIFO or DMA, so reading all ports still takes one bus transaction per port, see
+        //! burstRead. The bus traffic of a tick is only reduced by reading the ports in use alone.
         //!
-        //! @return Array with the read raw ADC values
+        //! @return Cache-aligned frame with the read raw ADC values
         const std::array<uint32_t, adc_number_ports>& readAllPorts() noexcept
         {
-            for (auto index = 0; index < adc_number_ports; index++)
+            burstRead(m_regs.data.base(), m_values);
+            return m_values;
+        }
+
+        //! Reads data from all ports in a single burst and converts them to a user-understandable scale.
+        //!
+        //! @return Array with the converted ADC values
+        const std::array<float, adc_number_ports>& readAllConverted() noexcept
+        {
+            readAllPorts();
+            for (size_t index = 0; index < adc_number_ports; index++)
             {
-                m_values[index] = read(index);
+                m_converted[index] = convert(m_values[index]);
             }
-            return m_values;
+            return m_converted;
         }
 
         //! Reads a value from the ADC and converts it to a user-understandable scale
@@ -120,7 +234,15 @@ namespace hal
         //! @return Converted data received from an ADC port
         float readConverted(const uint32_t port_index) noexcept
         {
-            const uint32_t raw             = read(port_index);
+            return convert(read(port_index));
+        }
+
+        //! Converts a raw value received from an ADC port to a user-understandable scale.
+        //!
+        //! @param raw Raw data received from an ADC port
+        //! @return Converted value
+        static float convert(const uint32_t raw) noexcept
+        {
             // check if the measured value is positive or negative, and shift accordingly:
             const int16_t   signed_sample  = static_cast<int16_t>(raw & 0xFFFF);
             constexpr float scaling_factor = 381.44e-6;
@@ -130,7 +252,17 @@ namespace hal
       private:
         ipCores::Top::AdcUncalintArrayItem::Adc m_regs;   //!< IP core with register definitions
 
-        std::array<uint32_t, adc_number_ports> m_values;   //!< Array holding all port values from the ADC
+        //! Frame holding all port values from the ADC, aligned to a cache line
+        alignas(64) std::array<uint32_t, adc_number_ports> m_values{};
+
+        std::array<float, adc_number_ports> m_converted{};   //!< Array holding the converted values of the frame
+
+        uint64_t m_start_timeout_cycles;        //!< Timeout of the blocking start, in counter cycles
+        uint64_t m_minimum_conversion_cycles;   //!< Minimum conversion time, in counter cycles
+        uint64_t m_trigger_time{0};             //!< System counter value when the last conversion was triggered
+        uint64_t m_conversion_cycles{0};        //!< Duration of the last conversion finished in time, in counter cycles
+        uint64_t m_timeouts{0};                 //!< Number of conversions which did not finish within the timeout
+        bool     m_busy_seen{false};            //!< Whether the busy flag of the last conversion has been seen raised
     };
 
 }   // namespace hal
\ No newline at end of file
@@ -0,0 +1,286 @@
+//! @file
+//! @brief Host-side stand-in for the MemMap++ library (mmpp) used by the cheby-generated register maps. Instead of
+//! dereferencing the physical addresses of the FPGA, every register access goes through the hal::RegisterFile
+//! holding the address, which counts it and lets the attached models of the IP cores react to it.
+//! @author Dominik Arominski
+//!
+//! Only the subset of mmpp used by the generated headers is provided. The directory of this header needs to come
+//! before the real mmpp in the include path of host builds.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <string>
+#include <type_traits>
+
+#include "peripherals/register_file.hpp"
+
+//! Defined when the register maps are backed by memory on the host rather than by the FPGA
+#define MMPP_MOCK 1
+
+namespace mmpp
+{
+    namespace attributes
+    {
+        enum class AccessMode
+        {
+            RO,
+            WO,
+            RW
+        };
+
+        enum class ByteOrdering
+        {
+            little,
+            big
+        };
+
+        enum class WordOrdering
+        {
+            little,
+            big
+        };
+    }   // namespace attributes
+
+    namespace mock
+    {
+        //! Reads a register of 32 or 64 bits, through the register file holding its address if there is one. A 64-bit
+        //! read is a single wide load, counted against both 32-bit registers it spans.
+        //!
+        //! @param address Address of the register
+        //! @return Value of the register
+        template<typename Word>
+        Word read(uint8_t* address)
+        {
+            static_assert(sizeof(Word) == 4 || sizeof(Word) == 8, "Registers have 32 or 64 bits.");
+
+            hal::RegisterFile* registers = hal::RegisterFile::find(address);
+            if (registers == nullptr)
+            {
+                return *reinterpret_cast<volatile Word*>(address);
+            }
+            const size_t offset = registers->offsetOf(address);
+            if constexpr (sizeof(Word) == 8)
+            {
+                return static_cast<Word>(registers->readWide(offset));
+            }
+            else
+            {
+                return static_cast<Word>(registers->read(offset));
+            }
+        }
+
+        //! Writes a register of 32 or 64 bits, through the register file holding its address if there is one.
+        //!
+        //! @param address Address of the register
+        //! @param value Value to be written
+        template<typename Word>
+        void write(uint8_t* address, const Word value)
+        {
+            static_assert(sizeof(Word) == 4 || sizeof(Word) == 8, "Registers have 32 or 64 bits.");
+
+            hal::RegisterFile* registers = hal::RegisterFile::find(address);
+            if (registers == nullptr)
+            {
+                *reinterpret_cast<volatile Word*>(address) = value;
+                return;
+            }
+            const size_t offset = registers->offsetOf(address);
+            registers->write(offset, static_cast<uint32_t>(value));
+            if constexpr (sizeof(Word) == 8)
+            {
+                registers->write(offset + 4, static_cast<uint32_t>(static_cast<uint64_t>(value) >> 32));
+            }
+        }
+
+        //! Base of all memory items, holding the address of their first byte
+        class MemItem
+        {
+          public:
+            MemItem() = default;
+
+            explicit MemItem(uint8_t* base) noexcept
+                : m_base(base)
+            {
+            }
+
+            //! @return Address of the first byte of the item
+            [[nodiscard]] uint8_t* base() const noexcept
+            {
+                return m_base;
+            }
+
+          private:
+            uint8_t* m_base{nullptr};   //!< Address of the first byte of the item
+        };
+    }   // namespace mock
+
+    //! Top-level memory module, e.g. the register map of an FPGA
+    template<size_t module_size, typename Word, attributes::ByteOrdering, attributes::WordOrdering>
+    struct MemModule : mock::MemItem
+    {
+        static constexpr size_t size = module_size;   //!< Size of the module, in bytes
+
+        using MemItem::MemItem;
+    };
+
+    //! Memory module nested in another one, e.g. an IP core
+    template<typename Parent, size_t module_size>
+    struct MemSubmodule : mock::MemItem
+    {
+        static constexpr size_t size = module_size;   //!< Size of the module, in bytes
+
+        using MemItem::MemItem;
+    };
+
+    //! Single register
+    template<typename Parent, size_t register_size, attributes::AccessMode access, typename T>
+    struct MemReg : mock::MemItem
+    {
+        using MemItem::MemItem;
+
+        //! @return Value of the register
+        [[nodiscard]] T read() const
+        {
+            using Word = std::conditional_t<register_size == 8, uint64_t, uint32_t>;
+            return static_cast<T>(mock::read<Word>(base()));
+        }
+
+        //! @param value Value to be written to the register
+        void write(const T value) const
+            requires(access != attributes::AccessMode::RO)
+        {
+            using Word = std::conditional_t<register_size == 8, uint64_t, uint32_t>;
+            mock::write<Word>(base(), static_cast<Word>(value));
+        }
+    };
+
+    //! Bit field of a register, from bit lsb to bit msb included. Setting a field reads and writes its register.
+    template<typename Register, size_t lsb, size_t msb, attributes::AccessMode access, typename T>
+    struct MemField : mock::MemItem
+    {
+        using MemItem::MemItem;
+
+        //! @return Value of the field
+        [[nodiscard]] T get() const
+        {
+            return static_cast<T>((mock::read<Word>(base()) >> lsb) & mask);
+        }
+
+        //! @param value Value to be written to the field
+        void set(const T value) const
+            requires(access != attributes::AccessMode::RO)
+        {
+            const Word word = mock::read<Word>(base()) & ~(mask << lsb);
+            mock::write<Word>(base(), word | ((static_cast<Word>(value) & mask) << lsb));
+        }
+
+      private:
+        using Word = std::conditional_t<(msb < 32), uint32_t, uint64_t>;
+
+        static constexpr Word mask = (msb - lsb + 1 == 64) ? ~Word{0} : ((Word{1} << (msb - lsb + 1)) - 1);
+    };
+
+    //! Array of identical items placed every stride bytes
+    template<typename Parent, typename Item, size_t count, size_t stride>
+    struct MemArray : mock::MemItem
+    {
+        static constexpr size_t size = count;   //!< Number of items
+
+        using MemItem::MemItem;
+
+        //! @param index Index of the item
+        //! @return Item at the provided index
+        [[nodiscard]] Item operator[](const size_t index) const noexcept
+        {
+            return Item{base() + index * stride};
+        }
+    };
+
+    namespace utils
+    {
+        //! Converts the provided value to a string, specialised by the generated headers for their enumerations.
+        //!
+        //! @param value Value to be converted
+        //! @return String representation of the value
+        template<typename T>
+        std::string to_string(const T& value)
+        {
+            return std::to_string(+value);
+        }
+
+        //! Converts the provided enumeration value to its unsigned underlying value.
+        //!
+        //! @param value Enumeration value
+        //! @return Unsigned underlying value
+        template<typename Enum>
+        constexpr auto as_unsigned(const Enum value) noexcept
+        {
+            return static_cast<std::make_unsigned_t<std::underlying_type_t<Enum>>>(value);
+        }
+
+        namespace dump_utils
+        {
+            //! Register or field of a dump, read when its value is requested
+            class DumpEntry
+            {
+              public:
+                template<typename Item>
+                explicit DumpEntry(const Item& item) noexcept
+                    : m_address(item.base()),
+                      m_read(&readItem<Item>)
+                {
+                }
+
+                //! @return Current value of the register or field
+                [[nodiscard]] uint64_t value() const
+                {
+                    return m_read(m_address);
+                }
+
+              private:
+                uint8_t* m_address;                //!< Address of the register
+                uint64_t (*m_read)(uint8_t*);      //!< Function reading the register or field
+
+                template<typename Item>
+                static uint64_t readItem(uint8_t* address)
+                {
+                    const Item item{address};
+                    if constexpr (requires { item.get(); })
+                    {
+                        return static_cast<uint64_t>(item.get());
+                    }
+                    else
+                    {
+                        return static_cast<uint64_t>(item.read());
+                    }
+                }
+            };
+
+            //! Registers and fields of a memory item, by name
+            class DumpMap : public std::map<std::string, DumpEntry>
+            {
+              public:
+                explicit DumpMap(uint8_t* base) noexcept
+                    : m_base(base)
+                {
+                }
+
+                //! @return Address of the dumped memory item
+                [[nodiscard]] uint8_t* base() const noexcept
+                {
+                    return m_base;
+                }
+
+              private:
+                uint8_t* m_base;   //!< Address of the dumped memory item
+            };
+        }   // namespace dump_utils
+
+        using dump_utils::DumpEntry;
+        using dump_utils::DumpMap;
+    }   // namespace utils
+}   // namespace mmpp
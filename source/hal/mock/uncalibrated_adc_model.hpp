@@ -0,0 +1,161 @@
+//! @file
+//! @brief Defines a behavioural model of the uncalibrated ADC IP core, to run its HAL object on the host.
+//! @author Dominik Arominski
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include "cheby_gen/mb_top_singleton.hpp"
+#include "peripherals/register_file.hpp"
+#include "pollCpuClock.hpp"
+
+namespace hal
+{
+    //! Model of the start/busy handshake of the uncalibrated ADC IP core, timed with the system counter. The busy flag
+    //! rises some time after the start bit is written, as it does with an external busy source, and stays raised for
+    //! the conversion time. The samples set with setSample are then latched into the data registers and the flag is
+    //! cleared. The state is brought up to date whenever a register of the IP core is read, so a conversion also ends
+    //! while nothing polls it. The start and reset bits clear themselves.
+    //!
+    //! @tparam adc_id Index of the ADC IP core in the register map
+    template<uint32_t adc_id>
+    class UncalibratedAdcModel : public RegisterModel
+    {
+        using Adc = ipCores::Top::AdcUncalintArrayItem::Adc;
+
+        static constexpr uint32_t start_bit = 1U << 1;
+        static constexpr uint32_t reset_bit = 1U << 0;
+        static constexpr uint32_t busy_bit  = 1U << 8;
+
+      public:
+        static constexpr size_t number_ports = Adc::DataArray::size;
+
+        //! Constructor attaching the model to the register file holding the register map on the host.
+        //!
+        //! @param conversion_time Time the busy flag stays raised
+        //! @param rise_delay Time from the start bit to the rising edge of the busy flag
+        explicit UncalibratedAdcModel(
+            const std::chrono::nanoseconds conversion_time = std::chrono::microseconds(1),
+            const std::chrono::nanoseconds rise_delay      = std::chrono::nanoseconds(100)
+        )
+            : m_rise_cycles(fgc4::utils::toCounterCycles(rise_delay)),
+              m_end_cycles(m_rise_cycles + fgc4::utils::toCounterCycles(conversion_time))
+        {
+            const Adc regs = Top::instance().adcUncalint[adc_id].adc;
+            m_ctrl         = relativeOffset(regs.ctrl.base(), regs);
+            m_status       = relativeOffset(regs.status.base(), regs);
+            m_data         = relativeOffset(regs.data.base(), regs);
+
+            RegisterFile& registers = Top::registers();
+            m_base                  = registers.offsetOf(regs.base());
+            registers.attach(*this, m_base, Adc::size);
+        }
+
+        UncalibratedAdcModel(const UncalibratedAdcModel&)            = delete;
+        UncalibratedAdcModel& operator=(const UncalibratedAdcModel&) = delete;
+
+        ~UncalibratedAdcModel() override
+        {
+            Top::registers().detach(*this);
+        }
+
+        //! Sets the sample latched into a data register at the end of the following conversions.
+        //!
+        //! @param port_index Port index
+        //! @param value Raw value of the sample
+        void setSample(const size_t port_index, const uint32_t value) noexcept
+        {
+            m_samples[port_index] = value;
+        }
+
+        //! @return Number of conversions started so far
+        [[nodiscard]] uint64_t conversions() const noexcept
+        {
+            return m_conversions;
+        }
+
+        //! @return True if a conversion was in progress at the last access to the IP core, false otherwise
+        [[nodiscard]] bool busy() const noexcept
+        {
+            return m_converting;
+        }
+
+        void beforeRead(RegisterFile& registers, const size_t /* offset */) override
+        {
+            advance(registers);
+        }
+
+        void afterWrite(RegisterFile& registers, const size_t offset, const uint32_t value) override
+        {
+            if (offset != m_ctrl)
+            {
+                return;
+            }
+            if (value & reset_bit)
+            {
+                m_converting = false;
+                registers.poke(m_base + m_status, registers.peek(m_base + m_status) & ~busy_bit);
+            }
+            if (value & start_bit)
+            {
+                m_conversions++;
+                m_converting = true;
+                m_start_time = fgc4::utils::read_CNTPCT();
+                advance(registers);
+            }
+            registers.poke(m_base + m_ctrl, value & ~(start_bit | reset_bit));
+        }
+
+      private:
+        uint64_t                           m_rise_cycles;         //!< Counter cycles from the start to the busy flag
+        uint64_t                           m_end_cycles;          //!< Counter cycles from the start to the end
+        uint64_t                           m_start_time{0};       //!< Counter value when the conversion started
+        bool                               m_converting{false};   //!< Whether a conversion is in progress
+        uint64_t                           m_conversions{0};      //!< Number of conversions started
+        size_t                             m_base{0};             //!< Offset of the IP core in the file
+        size_t                             m_ctrl{0};             //!< Offset of the control register
+        size_t                             m_status{0};           //!< Offset of the status register
+        size_t                             m_data{0};             //!< Offset of the first data register
+        std::array<uint32_t, number_ports> m_samples{};           //!< Samples latched by the conversions
+
+        //! @return Offset of a register from the base of the IP core
+        static size_t relativeOffset(const uint8_t* address, const Adc& regs) noexcept
+        {
+            return static_cast<size_t>(address - regs.base());
+        }
+
+        //! Brings the busy flag and the data registers up to date with the time elapsed since the start.
+        void advance(RegisterFile& registers)
+        {
+            if (!m_converting)
+            {
+                return;
+            }
+            const uint64_t elapsed = fgc4::utils::read_CNTPCT() - m_start_time;
+            if (elapsed >= m_end_cycles)
+            {
+                finishConversion(registers);
+            }
+            else if (elapsed >= m_rise_cycles)
+            {
+                registers.poke(m_base + m_status, registers.peek(m_base + m_status) | busy_bit);
+            }
+        }
+
+        //! Clears the busy flag and latches the samples into the data registers.
+        void finishConversion(RegisterFile& registers)
+        {
+            m_converting = false;
+            registers.poke(m_base + m_status, registers.peek(m_base + m_status) & ~busy_bit);
+            for (size_t index = 0; index < number_ports; index++)
+            {
+                registers.poke(m_base + m_data + index * sizeof(uint32_t), m_samples[index]);
+            }
+        }
+    };
+
+}   // namespace hal
@@ -0,0 +1,194 @@
+//! @file
+//! @brief Defines a behavioural model of the FIFOs of the Xilinx AXI Quad SPI IP core, to run its HAL object on the
+//! host.
+//! @author Dominik Arominski
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include "peripherals/register_file.hpp"
+
+namespace hal
+{
+    //! Model of the transmit and receive FIFOs of the Xilinx AXI Quad SPI IP core in master mode. Bytes written to
+    //! the transmit register are queued and shifted out once the master transaction is no longer inhibited; each of
+    //! them shifts a byte into the receive FIFO, equal to the transmitted byte in loopback mode and to the
+    //! configured response otherwise. The status and occupancy registers follow the FIFOs.
+    class XilAxiSpiModel : public RegisterModel
+    {
+        static constexpr size_t srr_addr         = 0x40;   // Software reset register
+        static constexpr size_t spicr_addr       = 0x60;   // SPI control register
+        static constexpr size_t spisr_addr       = 0x64;   // SPI status register
+        static constexpr size_t spidtr_addr      = 0x68;   // SPI data transmit register
+        static constexpr size_t spidrr_addr      = 0x6C;   // SPI data receive register
+        static constexpr size_t tx_fifo_ocr_addr = 0x74;   // Transmit FIFO occupancy register
+        static constexpr size_t rx_fifo_ocr_addr = 0x78;   // Receive FIFO occupancy register
+
+        static constexpr uint32_t loop_bit          = 1U << 0;
+        static constexpr uint32_t spe_bit           = 1U << 1;
+        static constexpr uint32_t master_bit        = 1U << 2;
+        static constexpr uint32_t tx_fifo_reset_bit = 1U << 5;
+        static constexpr uint32_t rx_fifo_reset_bit = 1U << 6;
+        static constexpr uint32_t trans_inhibit_bit = 1U << 8;
+
+        static constexpr uint32_t reset_key       = 0xA;     // Value of the software reset register resetting the core
+        static constexpr uint32_t spicr_reset     = 0x180;   // Control register after reset
+        static constexpr size_t   register_window = 0x80;    // Size of the address range of the core
+
+      public:
+        //! Constructor attaching the model to the register file backing the bus of the SPI core.
+        //!
+        //! @param registers Register file backing the bus, expected to outlive the model
+        //! @param base Offset of the SPI core on the bus, in bytes
+        //! @param fifo_size Depth of the FIFOs, 16 or 256
+        XilAxiSpiModel(RegisterFile& registers, const size_t base, const size_t fifo_size = 16)
+            : m_registers(registers),
+              m_base(base),
+              m_fifo_size(fifo_size)
+        {
+            registers.attach(*this, base, register_window);
+            reset(registers);
+        }
+
+        XilAxiSpiModel(const XilAxiSpiModel&)            = delete;
+        XilAxiSpiModel& operator=(const XilAxiSpiModel&) = delete;
+
+        ~XilAxiSpiModel() override
+        {
+            m_registers.detach(*this);
+        }
+
+        //! Sets the byte received for each transmitted byte outside of the loopback mode.
+        //!
+        //! @param response Received byte
+        void setResponse(const uint8_t response) noexcept
+        {
+            m_response = response;
+        }
+
+        //! @return All bytes shifted out since construction, in order
+        [[nodiscard]] const std::vector<uint8_t>& transmitted() const noexcept
+        {
+            return m_transmitted;
+        }
+
+        void beforeRead(RegisterFile& registers, const size_t offset) override
+        {
+            switch (offset)
+            {
+                case spidrr_addr:
+                    if (!m_rx.empty())
+                    {
+                        registers.poke(m_base + spidrr_addr, m_rx.front());
+                        m_rx.pop_front();
+                    }
+                    break;
+                case spisr_addr:
+                    registers.poke(m_base + spisr_addr, status());
+                    break;
+                case tx_fifo_ocr_addr:
+                    registers.poke(m_base + tx_fifo_ocr_addr, occupancy(m_tx));
+                    break;
+                case rx_fifo_ocr_addr:
+                    registers.poke(m_base + rx_fifo_ocr_addr, occupancy(m_rx));
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        void afterWrite(RegisterFile& registers, const size_t offset, const uint32_t value) override
+        {
+            switch (offset)
+            {
+                case srr_addr:
+                    if (value == reset_key)
+                    {
+                        reset(registers);
+                    }
+                    break;
+                case spicr_addr:
+                    if (value & tx_fifo_reset_bit)
+                    {
+                        m_tx.clear();
+                    }
+                    if (value & rx_fifo_reset_bit)
+                    {
+                        m_rx.clear();
+                    }
+                    // the FIFO reset bits clear themselves
+                    registers.poke(m_base + spicr_addr, value & ~(tx_fifo_reset_bit | rx_fifo_reset_bit));
+                    transfer(registers);
+                    break;
+                case spidtr_addr:
+                    if (m_tx.size() < m_fifo_size)
+                    {
+                        m_tx.push_back(static_cast<uint8_t>(value));
+                    }
+                    transfer(registers);
+                    break;
+                default:
+                    break;
+            }
+        }
+
+      private:
+        RegisterFile&        m_registers;       //!< Register file backing the bus
+        size_t               m_base;            //!< Offset of the SPI core on the bus
+        size_t               m_fifo_size;       //!< Depth of the FIFOs
+        uint8_t              m_response{0};     //!< Byte received outside of the loopback mode
+        std::deque<uint8_t>  m_tx;              //!< Transmit FIFO
+        std::deque<uint8_t>  m_rx;              //!< Receive FIFO
+        std::vector<uint8_t> m_transmitted;     //!< All bytes shifted out
+
+        //! Resets the core: empties the FIFOs and restores the control register.
+        void reset(RegisterFile& registers)
+        {
+            m_tx.clear();
+            m_rx.clear();
+            registers.poke(m_base + spicr_addr, spicr_reset);
+        }
+
+        //! Shifts out the transmit FIFO if the core is enabled in master mode and the transaction is not inhibited.
+        void transfer(RegisterFile& registers)
+        {
+            const uint32_t control = registers.peek(m_base + spicr_addr);
+            if ((control & (spe_bit | master_bit)) != (spe_bit | master_bit) || (control & trans_inhibit_bit))
+            {
+                return;
+            }
+            while (!m_tx.empty())
+            {
+                const uint8_t byte = m_tx.front();
+                m_tx.pop_front();
+                m_transmitted.push_back(byte);
+                if (m_rx.size() < m_fifo_size)
+                {
+                    m_rx.push_back((control & loop_bit) ? byte : m_response);
+                }
+            }
+        }
+
+        //! @return Value of the status register: RX empty, RX full, TX empty and TX full in bits 0 to 3
+        [[nodiscard]] uint32_t status() const noexcept
+        {
+            const auto flag = [](const bool value, const uint32_t bit)
+            {
+                return static_cast<uint32_t>(value) << bit;
+            };
+            return flag(m_rx.empty(), 0) | flag(m_rx.size() == m_fifo_size, 1) | flag(m_tx.empty(), 2)
+                   | flag(m_tx.size() == m_fifo_size, 3);
+        }
+
+        //! @return Value of an occupancy register: the number of bytes in the FIFO minus one, 0 when it is empty
+        [[nodiscard]] static uint32_t occupancy(const std::deque<uint8_t>& fifo) noexcept
+        {
+            return fifo.empty() ? 0 : static_cast<uint32_t>(fifo.size() - 1);
+        }
+    };
+
+}   // namespace hal
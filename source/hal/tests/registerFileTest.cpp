@@ -0,0 +1,177 @@
+//! @file
+//! @brief File with unit tests of the RegisterFile class.
+//! @author Dominik Arominski
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+
+#include "peripherals/bus.hpp"
+#include "peripherals/register_file.hpp"
+
+using namespace hal;
+
+class RegisterFileTest : public ::testing::Test
+{
+};
+
+namespace
+{
+    //! Model of a register counting up on each read, and doubling the values written to the next register
+    class CounterModel : public RegisterModel
+    {
+      public:
+        void beforeRead(RegisterFile& registers, const size_t offset) override
+        {
+            reads_seen++;
+            if (offset == 0)
+            {
+                registers.poke(base, registers.peek(base) + 1);
+            }
+        }
+
+        void afterWrite(RegisterFile& registers, const size_t offset, const uint32_t value) override
+        {
+            if (offset == 0)
+            {
+                registers.poke(base + 4, value * 2);
+            }
+        }
+
+        size_t base{0};
+        size_t reads_seen{0};
+    };
+}
+
+//! Checks that a register file is zero-initialised, aligned and holds the values written to it
+TEST_F(RegisterFileTest, ReadWrite)
+{
+    RegisterFile registers(64);
+
+    EXPECT_EQ(registers.size(), 64);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(registers.data()) % 64, 0);
+    EXPECT_EQ(registers.read(8), 0);
+
+    registers.write(8, 0xDEADBEEF);
+    EXPECT_EQ(registers.read(8), 0xDEADBEEF);
+    EXPECT_EQ(registers.peek(8), 0xDEADBEEF);
+    EXPECT_EQ(registers.data()[8], 0xEF);
+}
+
+//! Checks that only read and write are counted, per register
+TEST_F(RegisterFileTest, AccessCounters)
+{
+    RegisterFile registers(64);
+
+    registers.write(0, 1);
+    registers.read(0);
+    registers.read(0);
+    registers.read(12);
+    registers.poke(4, 3);
+    EXPECT_EQ(registers.peek(4), 3);
+
+    EXPECT_EQ(registers.reads(0), 2);
+    EXPECT_EQ(registers.writes(0), 1);
+    EXPECT_EQ(registers.reads(4), 0);
+    EXPECT_EQ(registers.writes(4), 0);
+    EXPECT_EQ(registers.totalReads(), 3);
+    EXPECT_EQ(registers.totalWrites(), 1);
+
+    const auto report = registers.report();
+    ASSERT_EQ(report.size(), 2);
+    EXPECT_EQ(report[0].offset, 0);
+    EXPECT_EQ(report[0].reads, 2);
+    EXPECT_EQ(report[0].writes, 1);
+    EXPECT_EQ(report[1].offset, 12);
+    EXPECT_EQ(report[1].reads, 1);
+    EXPECT_EQ(report[1].writes, 0);
+
+    registers.resetCounters();
+    EXPECT_EQ(registers.totalReads(), 0);
+    EXPECT_EQ(registers.totalWrites(), 0);
+    EXPECT_TRUE(registers.report().empty());
+}
+
+//! Checks that a wide read returns two registers, counting an access to each of them
+TEST_F(RegisterFileTest, ReadWide)
+{
+    RegisterFile registers(64);
+    registers.poke(16, 0x89ABCDEF);
+    registers.poke(20, 0x01234567);
+
+    EXPECT_EQ(registers.readWide(16), 0x0123456789ABCDEF);
+    EXPECT_EQ(registers.reads(16), 1);
+    EXPECT_EQ(registers.reads(20), 1);
+    EXPECT_EQ(registers.totalReads(), 2);
+
+    EXPECT_THROW(static_cast<void>(registers.readWide(20)), std::out_of_range);
+    EXPECT_THROW(static_cast<void>(registers.readWide(60)), std::out_of_range);
+}
+
+//! Checks that out-of-range and unaligned accesses are rejected
+TEST_F(RegisterFileTest, InvalidAccess)
+{
+    RegisterFile registers(16);
+
+    EXPECT_THROW(registers.read(16), std::out_of_range);
+    EXPECT_THROW(registers.write(14, 0), std::out_of_range);
+    EXPECT_THROW(static_cast<void>(registers.peek(2)), std::out_of_range);
+    EXPECT_THROW(registers.poke(64, 0), std::out_of_range);
+}
+
+//! Checks that addresses are routed to the register file holding them
+TEST_F(RegisterFileTest, Find)
+{
+    RegisterFile first(32);
+    {
+        RegisterFile second(32);
+
+        EXPECT_EQ(RegisterFile::find(first.data() + 4), &first);
+        EXPECT_EQ(RegisterFile::find(second.data() + 28), &second);
+        EXPECT_EQ(second.offsetOf(second.data() + 28), 28);
+        EXPECT_FALSE(first.contains(first.data() + 32));
+    }
+    EXPECT_EQ(RegisterFile::find(first.data()), &first);
+
+    int unrelated = 0;
+    EXPECT_EQ(RegisterFile::find(&unrelated), nullptr);
+}
+
+//! Checks that attached models see the accesses to their range only, relative to their base
+TEST_F(RegisterFileTest, Models)
+{
+    RegisterFile registers(64);
+    CounterModel model;
+    model.base = 32;
+    registers.attach(model, 32, 16);
+
+    EXPECT_EQ(registers.read(32), 1);
+    EXPECT_EQ(registers.read(32), 2);
+    registers.read(0);
+    registers.read(48);
+    EXPECT_EQ(model.reads_seen, 2);
+
+    registers.write(32, 21);
+    EXPECT_EQ(registers.read(36), 42);
+
+    const size_t reads_seen = model.reads_seen;
+    registers.detach(model);
+    registers.read(32);
+    EXPECT_EQ(model.reads_seen, reads_seen);
+
+    EXPECT_THROW(registers.attach(model, 60, 16), std::out_of_range);
+}
+
+//! Checks that a bus backed by a register file goes through its counted accesses
+TEST_F(RegisterFileTest, Bus)
+{
+    RegisterFile registers(256);
+    Bus          bus(registers);
+
+    ASSERT_TRUE(bus);
+    EXPECT_EQ(bus.size(), 256);
+
+    bus.write(0x40, 0xA);
+    EXPECT_EQ(bus.read(0x40), 0xA);
+    EXPECT_EQ(registers.writes(0x40), 1);
+    EXPECT_EQ(registers.reads(0x40), 1);
+}
@@ -0,0 +1,222 @@
+//! @file
+//! @brief File with host-side unit tests of the UncalibratedADC class, run against a model of its IP core.
+//! @author Dominik Arominski
+
+#include <chrono>
+#include <gtest/gtest.h>
+
+#include "peripherals/uncalibrated_adc.hpp"
+#include "uncalibrated_adc_model.hpp"
+
+using namespace hal;
+
+class UncalibratedAdcTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        Top::registers().resetCounters();
+    }
+
+    //! @return Offset of a register of the first ADC in the register file of the host
+    static size_t offsetOf(const uint8_t* address)
+    {
+        return Top::registers().offsetOf(address);
+    }
+};
+
+//! Checks that the configuration set on construction lands in the configuration register
+TEST_F(UncalibratedAdcTest, Configuration)
+{
+    UncalibratedAdcModel<0> model;
+    UncalibratedADC<0>      adc;
+
+    const auto& regs = Top::instance().adcUncalint[0].adc;
+    EXPECT_TRUE(regs.config.cpol.get());
+    EXPECT_TRUE(regs.config.cpha.get());
+    EXPECT_TRUE(regs.config.cnvPol.get());
+    EXPECT_FALSE(regs.config.cnvWithCs.get());
+    EXPECT_TRUE(regs.config.busyPol.get());
+    EXPECT_EQ(regs.config.dataWidth.get(), 16);
+    EXPECT_FALSE(regs.config.gwCtrl.get());
+}
+
+//! Checks the bus transactions of a tick starting a conversion and reading all ports
+TEST_F(UncalibratedAdcTest, AccessesPerTick)
+{
+    UncalibratedAdcModel<0> model;
+    UncalibratedADC<0>      adc;
+
+    const auto&    regs  = Top::instance().adcUncalint[0].adc;
+    constexpr auto ports = UncalibratedAdcModel<0>::number_ports;
+    constexpr auto ticks = 10;
+    RegisterFile&  file  = Top::registers();
+    file.resetCounters();
+
+    for (int tick = 0; tick < ticks; tick++)
+    {
+        adc.start();
+        adc.readAllPorts();
+    }
+    EXPECT_EQ(model.conversions(), ticks);
+
+    // setting the start bit is a read-modify-write of the control register, followed by a poll of the status which
+    // takes as many reads as the conversion takes time
+    const auto status_reads = file.reads(offsetOf(regs.status.base()));
+    EXPECT_EQ(file.reads(offsetOf(regs.ctrl.base())), ticks);
+    EXPECT_EQ(file.writes(offsetOf(regs.ctrl.base())), ticks);
+    EXPECT_GE(status_reads, ticks);
+    // the wide loads of the burst still take a transaction for each data register behind the 32-bit slave
+    for (size_t port = 0; port < ports; port++)
+    {
+        EXPECT_EQ(file.reads(offsetOf(regs.data[port].base())), ticks);
+    }
+    EXPECT_EQ(file.totalReads(), ticks * (1 + ports) + status_reads);
+    EXPECT_EQ(file.totalWrites(), ticks);
+}
+
+//! Checks the bus transactions of a tick collecting a conversion and reading only the port in use
+TEST_F(UncalibratedAdcTest, AccessesPerTickSinglePort)
+{
+    UncalibratedAdcModel<0> model;
+    UncalibratedADC<0>      adc;
+
+    const auto&    regs  = Top::instance().adcUncalint[0].adc;
+    constexpr auto ports = UncalibratedAdcModel<0>::number_ports;
+    constexpr auto ticks = 10;
+    RegisterFile&  file  = Top::registers();
+    file.resetCounters();
+
+    for (int tick = 0; tick < ticks; tick++)
+    {
+        adc.trigger();
+        ASSERT_TRUE(adc.poll(fgc4::utils::toCounterCycles(std::chrono::seconds(1))));
+        adc.read(1);
+    }
+
+    const auto status_reads = file.reads(offsetOf(regs.status.base()));
+    for (size_t port = 0; port < ports; port++)
+    {
+        EXPECT_EQ(file.reads(offsetOf(regs.data[port].base())), port == 1 ? ticks : 0);
+    }
+    EXPECT_EQ(file.totalReads(), ticks * 2 + status_reads);
+}
+
+//! Checks that the burst readout gives the same frame as reading the ports one by one, in as many transactions
+TEST_F(UncalibratedAdcTest, BurstReadout)
+{
+    UncalibratedAdcModel<0> model(std::chrono::nanoseconds(0), std::chrono::nanoseconds(0));
+    UncalibratedADC<0>      adc;
+
+    constexpr auto ports = UncalibratedAdcModel<0>::number_ports;
+    for (size_t port = 0; port < ports; port++)
+    {
+        model.setSample(port, 0x10000 * port + (port % 2 == 0 ? port * 100 : 0xFFFF - port * 100));
+    }
+    const auto& regs = Top::instance().adcUncalint[0].adc;
+    regs.ctrl.start.set(true);
+
+    RegisterFile& file = Top::registers();
+    file.resetCounters();
+    const auto& frame = adc.readAllPorts();
+    EXPECT_EQ(file.totalReads(), ports);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(frame.data()) % 64, 0);
+
+    file.resetCounters();
+    for (size_t port = 0; port < ports; port++)
+    {
+        EXPECT_EQ(frame[port], adc.read(port));
+    }
+    EXPECT_EQ(file.totalReads(), ports);
+
+    const auto& converted = adc.readAllConverted();
+    for (size_t port = 0; port < ports; port++)
+    {
+        EXPECT_FLOAT_EQ(converted[port], adc.readConverted(port));
+        EXPECT_FLOAT_EQ(converted[port], UncalibratedADC<0>::convert(frame[port]));
+    }
+    EXPECT_LT(converted[1], 0.0F);
+    EXPECT_GT(converted[2], 0.0F);
+}
+
+//! Checks that start blocks until the samples are latched
+TEST_F(UncalibratedAdcTest, StartWaitsForConversion)
+{
+    UncalibratedAdcModel<0> model(std::chrono::microseconds(3));
+    UncalibratedADC<0>      adc;
+    model.setSample(1, 0x1234);
+
+    adc.start();
+    EXPECT_FALSE(model.busy());
+    EXPECT_EQ(adc.read(1), 0x1234);
+    EXPECT_NEAR(adc.readConverted(1), 0x1234 * 381.44e-6, 1e-6);
+    EXPECT_EQ(adc.timeouts(), 0);
+}
+
+//! Checks that the time before the busy flag rises is not mistaken for the end of the conversion
+TEST_F(UncalibratedAdcTest, BusyRisesLate)
+{
+    UncalibratedAdcModel<0> model(std::chrono::microseconds(3), std::chrono::microseconds(2));
+    UncalibratedADC<0>      adc;
+    model.setSample(1, 0x1234);
+
+    adc.trigger();
+    EXPECT_FALSE(adc.isReady());
+    ASSERT_TRUE(adc.collect(fgc4::utils::toCounterCycles(std::chrono::seconds(1))));
+    EXPECT_FALSE(model.busy());
+    EXPECT_EQ(adc.frame()[1], 0x1234);
+    EXPECT_EQ(adc.timeouts(), 0);
+}
+
+//! Checks that a conversion which has ended before it is collected, without its busy pulse being seen, is collected
+TEST_F(UncalibratedAdcTest, CollectAfterConversionEnded)
+{
+    UncalibratedAdcModel<0> model(std::chrono::microseconds(1));
+    UncalibratedADC<0>      adc;
+    model.setSample(1, 0x1234);
+
+    adc.trigger();
+    fgc4::utils::waitFor(std::chrono::microseconds(20));
+    ASSERT_TRUE(adc.collect(fgc4::utils::toCounterCycles(std::chrono::microseconds(50))));
+    EXPECT_EQ(adc.frame()[1], 0x1234);
+    EXPECT_EQ(adc.timeouts(), 0);
+}
+
+//! Checks that a triggered conversion runs while other work is done, and is collected afterwards
+TEST_F(UncalibratedAdcTest, SplitPhase)
+{
+    UncalibratedAdcModel<0> model(std::chrono::microseconds(3));
+    UncalibratedADC<0>      adc;
+    model.setSample(0, 0x0042);
+    model.setSample(5, 0xFFFE);
+
+    adc.trigger();
+    EXPECT_TRUE(model.busy());
+    EXPECT_EQ(model.conversions(), 1);
+    EXPECT_FALSE(adc.isReady());
+
+    ASSERT_TRUE(adc.collect(fgc4::utils::toCounterCycles(std::chrono::seconds(1))));
+    EXPECT_FALSE(model.busy());
+    EXPECT_EQ(adc.frame()[0], 0x0042);
+    EXPECT_EQ(adc.frame()[5], 0xFFFE);
+    EXPECT_GT(adc.conversionCycles(), 0);
+    EXPECT_EQ(adc.timeouts(), 0);
+
+    // a finished conversion is collected without waiting
+    ASSERT_TRUE(adc.collect(0));
+    EXPECT_TRUE(adc.isReady());
+}
+
+//! Checks that a conversion not finishing in time is reported and counted rather than waited for
+TEST_F(UncalibratedAdcTest, Timeout)
+{
+    UncalibratedAdcModel<0> model(std::chrono::hours(1));
+    UncalibratedADC<0>      adc;
+
+    const uint64_t timeout_cycles = fgc4::utils::toCounterCycles(std::chrono::microseconds(1));
+    adc.trigger();
+    EXPECT_FALSE(adc.poll(timeout_cycles));
+    EXPECT_FALSE(adc.collect(timeout_cycles));
+    EXPECT_EQ(adc.timeouts(), 2);
+    EXPECT_TRUE(model.busy());
+}
@@ -0,0 +1,90 @@
+//! @file
+//! @brief File with host-side unit tests of the XilAxiSpi and AD7606C classes, run over a bus backed by a register
+//! file with a model of the SPI IP core.
+//! @author Dominik Arominski
+
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "peripherals/ad7606c.hpp"
+#include "peripherals/xil_axi_spi.hpp"
+#include "uncalibrated_adc_model.hpp"
+#include "xil_axi_spi_model.hpp"
+
+using namespace hal;
+
+class XilAxiSpiTest : public ::testing::Test
+{
+  protected:
+    static constexpr uint32_t spi_base = 0xE400;
+
+    RegisterFile   registers{0x10000};
+    Bus            bus{registers};
+    XilAxiSpiModel model{registers, spi_base};
+};
+
+//! Checks that bytes are held while the transfer is inhibited, and shifted out once it is started
+TEST_F(XilAxiSpiTest, Transfer)
+{
+    XilAxiSpi spi(bus, spi_base);
+    spi.configure_core(true, 0, 0, false, true, true);
+    spi.write_data({0x01, 0x02, 0x03});
+
+    EXPECT_TRUE(model.transmitted().empty());
+    EXPECT_FALSE(spi.is_tx_empty());
+
+    spi.start_transfer();
+    spi.wait_for_transfer_complete();
+    spi.inhibit_transfer();
+
+    EXPECT_EQ(model.transmitted(), (std::vector<uint8_t>{0x01, 0x02, 0x03}));
+    EXPECT_TRUE(spi.is_tx_empty());
+}
+
+//! Checks that the received bytes are read back from the receive FIFO
+TEST_F(XilAxiSpiTest, Receive)
+{
+    XilAxiSpi spi(bus, spi_base);
+    model.setResponse(0x5A);
+    spi.configure_core(true, 0, 0, false, true, true);
+    spi.write_data({0x10, 0x20});
+    spi.start_transfer();
+
+    EXPECT_EQ(spi.read_rx_data(), (std::vector<uint8_t>{0x5A, 0x5A}));
+
+    bus.write(spi_base + 0x60, 0x87);   // loopback, enabled, master, manual slave select, not inhibited
+    spi.write_data({0x33});
+    EXPECT_EQ(spi.read_rx_data(), (std::vector<uint8_t>{0x33}));
+}
+
+//! Checks that the transmit FIFO refuses more bytes than it can hold
+TEST_F(XilAxiSpiTest, Overflow)
+{
+    XilAxiSpi spi(bus, spi_base);
+    spi.configure_core(true, 0, 0, false, true, true);
+
+    EXPECT_THROW(spi.write_data(std::vector<uint32_t>(17, 0)), std::runtime_error);
+}
+
+//! Checks the register writes sent by the AD7606C on construction, and the bus transactions they take
+TEST_F(XilAxiSpiTest, AD7606CConfiguration)
+{
+    UncalibratedAdcModel<0> adc_model;
+    UncalibratedADC<0>      adc;
+    XilAxiSpi               spi(bus, spi_base);
+    registers.resetCounters();
+
+    AD7606C<0> ad7606c(spi, 3, adc);
+
+    const std::vector<uint8_t> expected{0x02, 0x18, 0x03, 0xAA, 0x04, 0xAA, 0x05, 0xAA, 0x06, 0xAA, 0x07, 0xFF};
+    EXPECT_EQ(model.transmitted(), expected);
+
+    // each register write takes an occupancy read, two data writes, two slave select writes, two control writes and
+    // a status read, on top of the control write configuring the core
+    EXPECT_EQ(registers.writes(spi_base + 0x68), 12);
+    EXPECT_EQ(registers.writes(spi_base + 0x70), 12);
+    EXPECT_EQ(registers.reads(spi_base + 0x74), 6);
+    EXPECT_EQ(registers.reads(spi_base + 0x64), 6);
+    EXPECT_EQ(registers.writes(spi_base + 0x60), 13);
+    EXPECT_EQ(registers.peek(spi_base + 0x70), ~0U);
+}
@@ -1,12 +1,21 @@
+#include <algorithm>
 #include <array>
+#include <chrono>
+#include <deque>
 #include <fcntl.h>
+#include <iomanip>
 #include <iostream>
+#include <iterator>
 #include <map>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <unistd.h>
 
 #include "bmboot/domain.hpp"
 #include "bmboot/domain_helpers.hpp"
+#include "chunkedTransfer.hpp"
+#include "commandStatusRecord.hpp"
 #include "json/json.hpp"
 #include "messageQueue.hpp"
 #include "shared_memory.h"
@@ -45,6 +54,13 @@ void parseComponent(
     }
 }
 
+//! Checks whether a message of the parameter map queue holds the parameter map, and not read-back values.
+bool isParameterMap(const Json& message)
+{
+    return message.is_array() && !message.empty() && message[0].is_object()
+           && message[0].value("type", "") == vslib::utils::parameter_map_message::parameter_map;
+}
+
 auto parseManifest(const Json& manifest)
 {
     std::vector<std::pair<std::string, std::string>> settable_parameters;
@@ -245,8 +261,250 @@ auto prepareCommands(const std::vector<std::pair<std::string, std::string>>& par
     return commands;
 }
 
+//! Maximal size of a message of the command queue, which holds the size of each message next to it
+constexpr size_t max_message_size = fgc4::utils::constants::json_memory_pool_size - 2 * sizeof(size_t);
+
+//! Replaces each command setting an array Parameter that is too large for a single message of the command queue
+//! with the commands of a chunked transfer, with chunks fitting in a message. Other commands are kept as they are.
+std::vector<Json> splitLargeCommands(const std::vector<Json>& commands)
+{
+    std::vector<Json> result;
+    result.reserve(commands.size());
+    for (const auto& command : commands)
+    {
+        const size_t size  = command.dump().size();
+        const auto&  value = command["value"];
+        if (size <= max_message_size || !value.is_array() || value.empty())
+        {
+            result.push_back(command);
+            continue;
+        }
+
+        // the chunks start from the share of the elements fitting in half of a message, and shrink until all fit
+        size_t            chunk_length = std::max<size_t>(1, value.size() * max_message_size / (2 * size));
+        std::vector<Json> transfer     = vslib::utils::splitIntoChunks(command, chunk_length);
+        while (chunk_length > 1
+               && std::any_of(
+                   transfer.begin(), transfer.end(),
+                   [](const Json& chunk)
+                   {
+                       return chunk.dump().size() > max_message_size;
+                   }
+               ))
+        {
+            chunk_length /= 2;
+            transfer      = vslib::utils::splitIntoChunks(command, chunk_length);
+        }
+        std::move(transfer.begin(), transfer.end(), std::back_inserter(result));
+    }
+    return result;
+}
+
+//! Maximal space taken in the status queue by the status record of a batch, together with the size of the message
+constexpr size_t status_record_footprint = vslib::utils::CommandStatusRecord::capacity + sizeof(size_t);
+
+//! Time without any progress after which the batch loader gives up
+constexpr auto batch_loader_timeout = std::chrono::seconds(5);
+
+//! Waits until the payload publishes its parameter map and prepares the commands setting all of its Parameters.
+std::vector<Json> waitForCommands(
+    fgc4::utils::MessageQueueReader<void>& read_parameter_map_queue, std::span<uint8_t> parameter_map_buffer
+)
+{
+    const auto start = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() - start < batch_loader_timeout)
+    {
+        auto message = read_parameter_map_queue.read(parameter_map_buffer);
+        if (message.has_value())
+        {
+            auto const json_manifest = vslib::utils::readJsonFromMessageQueue(message.value());
+            if (isParameterMap(json_manifest))
+            {
+                return splitLargeCommands(prepareCommands(parseManifest(json_manifest)));
+            }
+        }
+        std::this_thread::yield();
+    }
+    std::cerr << "No parameter map received from the payload.\n";
+    return {};
+}
+
+//! Prints a message read from the status queue which does not match any batch in flight, decoded if it is a status
+//! record and as hexadecimal bytes otherwise.
+void printUnexpectedStatus(std::span<const uint8_t> message)
+{
+    const auto record = vslib::utils::CommandStatusRecord::decode(message);
+    if (record.has_value())
+    {
+        std::cout << "Unexpected status record of batch " << record->batch_sequence << " with "
+                  << record->statuses.size() << " statuses\n";
+        return;
+    }
+    std::cout << "Unexpected status of " << message.size() << " bytes:" << std::hex << std::setfill('0');
+    for (const auto byte : message)
+    {
+        std::cout << ' ' << std::setw(2) << static_cast<int>(byte);
+    }
+    std::cout << std::dec << std::setfill(' ') << "\n";
+}
+
+//! Sends all commands packed in JSON arrays, each batch small enough for its status to fit in a single status record,
+//! and keeps as many batches in flight as their status records fit in the free space of the status queue. Each status
+//! record carries the sequence number of its batch and the index of each command within the batch, so the statuses
+//! are matched to the commands without parsing any text. The batches in flight before the batch of a status record
+//! have lost their status, and are dropped.
+void runBatchLoader(
+    const std::vector<Json>& commands, fgc4::utils::MessageQueueWriter<void>& write_commands_queue,
+    fgc4::utils::MessageQueueReader<void>& read_command_status_queue
+)
+{
+    struct Batch
+    {
+        uint32_t sequence;         // sequence number assigned by the payload, counting batches from 0
+        size_t   first_command;    // index of the first command of the batch
+        size_t   pending_status;   // number of commands without status
+    };
+
+    // each command is serialized once, batches are assembled from the serialized strings
+    std::vector<std::string> serialized_commands;
+    serialized_commands.reserve(commands.size());
+    for (const auto& command : commands)
+    {
+        serialized_commands.emplace_back(command.dump());
+        // a batch of a single command adds the brackets of the array
+        if (serialized_commands.back().size() + 2 > max_message_size)
+        {
+            // only commands setting arrays are split into chunked transfers
+            std::cerr << "Command " << command["name"] << " of " << serialized_commands.back().size()
+                      << " bytes does not fit in a message of " << max_message_size << " bytes, nothing sent.\n";
+            return;
+        }
+    }
+
+    std::array<uint8_t, fgc4::utils::constants::string_memory_pool_size> command_status_buffer{0};
+    std::deque<Batch>                                                    in_flight;
+    uint32_t                                                             next_sequence   = 0;
+    size_t                                                               next_command    = 0;
+    size_t                                                               failed_commands = 0;
+    size_t                                                               lost_commands   = 0;
+    std::string                                                          batch;
+
+    const auto start         = std::chrono::steady_clock::now();
+    auto       last_progress = start;
+    while (next_command < commands.size() || !in_flight.empty())
+    {
+        bool progress = false;
+
+        // match all available status records with the batches in flight
+        auto message = read_command_status_queue.read(command_status_buffer);
+        while (message.has_value())
+        {
+            const auto record = vslib::utils::CommandStatusRecord::decode(message.value());
+            const auto batch_found
+                = record.has_value()
+                  && std::any_of(
+                      in_flight.begin(), in_flight.end(),
+                      [&record](const Batch& flying)
+                      {
+                          return flying.sequence == record->batch_sequence;
+                      }
+                  );
+            if (!batch_found)
+            {
+                printUnexpectedStatus(message.value());
+            }
+            else
+            {
+                // the status records of the earlier batches have been lost, e.g. dropped by a full status queue
+                while (in_flight.front().sequence != record->batch_sequence)
+                {
+                    std::cout << "Batch " << in_flight.front().sequence << ": " << in_flight.front().pending_status
+                              << " commands without status\n";
+                    lost_commands += in_flight.front().pending_status;
+                    in_flight.pop_front();
+                }
+
+                auto& current_batch = in_flight.front();
+                for (const auto& status : record->statuses)
+                {
+                    if (status.result != vslib::utils::CommandResult::success)
+                    {
+                        failed_commands++;
+                        std::cout << "Command " << serialized_commands[current_batch.first_command + status.command_id]
+                                  << " failed with code " << static_cast<int>(status.result);
+                        if (status.message_index != vslib::utils::CommandStatusRecord::no_message)
+                        {
+                            std::cout << ": " << record->messages[status.message_index];
+                        }
+                        std::cout << "\n";
+                    }
+                }
+                current_batch.pending_status -= std::min(current_batch.pending_status, record->statuses.size());
+                if (current_batch.pending_status == 0)
+                {
+                    in_flight.pop_front();
+                }
+            }
+            progress = true;
+            message  = read_command_status_queue.read(command_status_buffer);
+        }
+
+        // top up the pipeline with the next batch, if the status records of all batches in flight still fit in the
+        // status queue, otherwise the payload would drop them
+        const size_t window = read_command_status_queue.spaceAvailable() / status_record_footprint;
+        if (next_command < commands.size() && in_flight.size() < window)
+        {
+            batch = "[";
+            size_t end_command = next_command;
+            while (end_command < commands.size()
+                   && end_command - next_command < vslib::utils::CommandStatusRecord::max_statuses
+                   && batch.size() + serialized_commands[end_command].size() + 2 <= max_message_size)
+            {
+                if (end_command != next_command)
+                {
+                    batch += ',';
+                }
+                batch += serialized_commands[end_command++];
+            }
+            batch += ']';
+
+            if (end_command > next_command
+                && write_commands_queue.write({reinterpret_cast<const uint8_t*>(batch.data()), batch.size()}))
+            {
+                in_flight.push_back({next_sequence++, next_command, end_command - next_command});
+                next_command = end_command;
+                progress     = true;
+            }
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+        if (progress)
+        {
+            last_progress = now;
+        }
+        else if (now - last_progress > batch_loader_timeout)
+        {
+            std::cerr << "Timeout: " << in_flight.size() << " batches without status, "
+                      << commands.size() - next_command << " commands not sent.\n";
+            break;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    const double duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "Commands sent: " << next_command << ", failed: " << failed_commands
+              << ", without status: " << lost_commands << ", in " << duration * 1e3
+              << " ms, " << static_cast<double>(next_command) / duration << " commands per second.\n";
+}
+
 int main(int argc, char* argv[])
 {
+    // with --batch, commands are packed into arrays and pipelined instead of being sent one by one
+    const bool batch_mode = (argc > 2 && std::string_view(argv[2]) == "--batch");
+
     fprintf(stderr, "Start Bmboot\n");
 
     auto domain = bmboot::throwOnError(bmboot::IDomain::open(bmboot::DomainIndex::cpu3), "IDomain::open");
@@ -283,9 +541,21 @@ int main(int argc, char* argv[])
 
     fprintf(stderr, "Run payload\n");
     bmboot::loadPayloadFromFileOrThrow(*domain, argv[1]);
+
+    std::array<uint8_t, json_queue_size> parameter_map_buffer;
+    if (batch_mode)
+    {
+        // no delay for initialization needed, the loader waits for the parameter map to be published
+        const auto commands = waitForCommands(read_parameter_map_queue, parameter_map_buffer);
+        runBatchLoader(commands, write_commands_queue, read_command_status_queue);
+
+        std::cout << "Now running the console: \n";
+        runConsoleUntilInterrupted(*domain);
+        return 0;
+    }
+
     usleep(500'000);   // delay for initialization
 
-    std::array<uint8_t, json_queue_size>   parameter_map_buffer;
     std::array<uint8_t, string_queue_size> command_status_buffer{0};
     std::vector<Json>                      commands;
     bool                                   commands_set  = false;
@@ -300,11 +570,14 @@ int main(int argc, char* argv[])
         auto message = read_parameter_map_queue.read(parameter_map_buffer);
         if (message.has_value())
         {
-            auto const json_manifest       = vslib::utils::readJsonFromMessageQueue(message.value());
+            auto const json_manifest = vslib::utils::readJsonFromMessageQueue(message.value());
             // std::cout << json_manifest.dump(1) << "\n";
-            auto const settable_parameters = parseManifest(json_manifest);
-            commands                       = prepareCommands(settable_parameters);
-            commands_set                   = true;
+            if (isParameterMap(json_manifest))
+            {
+                auto const settable_parameters = parseManifest(json_manifest);
+                commands                       = splitLargeCommands(prepareCommands(settable_parameters));
+                commands_set                   = true;
+            }
         }
 
         if (commands_set && (commands_sent <= commands.size()))
@@ -201,6 +201,16 @@ namespace fgc4::utils
             return MessageQueueBase::getPendingMessageSize(0);
         }
 
+        /**
+         * Check how much space is free in the queue, e.g. to limit the number of replies requested from the writer.
+         *
+         * @return The free space in bytes, which each message takes together with its length.
+         */
+        size_t spaceAvailable() const
+        {
+            return MessageQueueBase::spaceAvailable();
+        }
+
         /**
          * Attempt to read a message from the queue
          * @param body_buffer Buffer to receive the message body. If the buffer is insufficient, the excess data is
@@ -4,15 +4,64 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 
 namespace fgc4::utils
 {
+    //! Reads the physical count of the system counter. On hosts other than the target, the ticks of the steady clock
+    //! stand in for it, so that code accounting time in counter cycles can be tested there.
+    //!
+    //! @return Current value of the counter
     [[maybe_unused]] static uint64_t read_CNTPCT()
     {
+#if defined(__aarch64__)
         uint64_t cntval = 0;
         // asm statement MUST be volatile, otherwise compiler will do weird, wrong things like coalescing the access
         asm volatile("mrs %0, CNTPCT_EL0" : "=r"(cntval));
         return cntval;
+#else
+        return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+    }
+
+    //! Reads the frequency of the system counter, as set by the boot firmware. On hosts other than the target, the
+    //! frequency of the steady clock read by read_CNTPCT is returned instead.
+    //!
+    //! @return Frequency of the counter, in Hz
+    [[maybe_unused]] static uint64_t read_CNTFRQ()
+    {
+#if defined(__aarch64__)
+        uint64_t frequency = 0;
+        asm volatile("mrs %0, CNTFRQ_EL0" : "=r"(frequency));
+        return frequency;
+#else
+        return static_cast<uint64_t>(std::chrono::steady_clock::period::den / std::chrono::steady_clock::period::num);
+#endif
+    }
+
+    //! Converts a duration to cycles of the system counter, at the frequency of the counter.
+    //!
+    //! @param duration Duration to be converted
+    //! @return Number of counter cycles elapsing during the duration
+    template<typename Rep, typename Period>
+    [[maybe_unused]] static uint64_t toCounterCycles(const std::chrono::duration<Rep, Period> duration)
+    {
+        return static_cast<uint64_t>(
+            std::chrono::duration<double>(duration).count() * static_cast<double>(read_CNTFRQ())
+        );
+    }
+
+    //! Busy-waits for the duration, measured with the system counter.
+    //!
+    //! @param duration Duration to be waited for
+    template<typename Rep, typename Period>
+    [[maybe_unused]] static void waitFor(const std::chrono::duration<Rep, Period> duration)
+    {
+        const uint64_t cycles = toCounterCycles(duration);
+        const uint64_t start  = read_CNTPCT();
+        while (read_CNTPCT() - start < cycles)
+        {
+        }
     }
 }   // namespace fgc4::utils
\ No newline at end of file
@@ -0,0 +1,178 @@
+//! @file
+//! @brief Finite State Machine driven by a compile-time table of state and transition functions
+//! @author Dominik Arominski
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+#include "fsm.hpp"
+
+namespace utils
+{
+    //! Entry of the table of a TableFsm, holding the state function and the transition functions of a single state.
+    //!
+    //! @tparam State Enum class representing different states of the FSM, with values from 0 to the number of states
+    //! @tparam Parent Class from within the FSM is used
+    //! @tparam max_transitions Maximal number of transition functions of a state
+    template<class State, class Parent, size_t max_transitions>
+    struct FsmTableEntry
+    {
+        //! Convenience alias representing pointer to a member function of the Parent class, for a state function.
+        using StateFunc = void (Parent::*)();
+
+        //! Convenience alias representing pointer to a member function of the Parent class, for a transition function.
+        using TransitionFunc = FsmTransitionResult<State> (Parent::*)();
+
+        State                                       state;                  //!< State, equal to the index of the entry
+        StateFunc                                   state_func{nullptr};    //!< State function, can be nullptr
+        std::array<TransitionFunc, max_transitions> transitions{};          //!< Transition functions, in the order they
+                                                                            //!< are checked, followed by nullptrs
+    };
+
+    //! Convenience alias representing the table of a TableFsm, with one entry per state, indexed by the state.
+    template<class State, class Parent, size_t number_states, size_t max_transitions>
+    using FsmTable = std::array<FsmTableEntry<State, Parent, max_transitions>, number_states>;
+
+    // **********************************************************
+
+    //! This class is used to create Finite State Machine with the same behaviour as Fsm, but with states and
+    //! transitions defined by a constexpr table rather than registered at runtime. The current state indexes the
+    //! table directly, so that update() needs no heap allocation, no map lookups and no type erasure, and can be
+    //! called from the real-time context.
+    //!
+    //! The table is expected to be a static constexpr object, e.g. a static member of the Parent class declared
+    //! before the FSM and defined after the Parent class, once the member functions are known. Its consistency is
+    //! checked at compile time.
+    //!
+    //! @tparam State Enum class representing different states of the FSM, with values from 0 to the number of states
+    //! @tparam Parent Class from within the FSM is used
+    //! @tparam table FsmTable with an entry for each state
+    //! @tparam state_first Whether the state function is executed before the transitions are checked
+    template<class State, class Parent, const auto& table, bool state_first = true>
+    class TableFsm
+    {
+        using Table = std::remove_cvref_t<decltype(table)>;
+        using Entry = typename Table::value_type;
+
+        static_assert(
+            std::is_same_v<typename Entry::StateFunc, void (Parent::*)()>, "The table needs to hold entries of Parent."
+        );
+
+      public:
+        //! @param parent Reference to the Parent class, usually this should be simply '*this'.
+        //! @param starting_state Initial state of the FSM
+        constexpr TableFsm(Parent& parent, const State& starting_state) noexcept
+            : m_parent(parent),
+              m_state(starting_state),
+              m_starting_state(starting_state)
+        {
+        }
+
+        // **********************************************************
+
+        //! Checks that each entry of the table describes the state equal to its index and that the transition
+        //! functions of each state are not interleaved with nullptrs.
+        //!
+        //! @return True if the table is consistent, false otherwise
+        static constexpr bool isValid() noexcept
+        {
+            for (size_t index = 0; index < table.size(); index++)
+            {
+                if (static_cast<size_t>(table[index].state) != index)
+                {
+                    return false;
+                }
+                bool terminated = false;
+                for (const auto& transition : table[index].transitions)
+                {
+                    if (terminated && transition != nullptr)
+                    {
+                        return false;
+                    }
+                    terminated = (transition == nullptr);
+                }
+            }
+            return true;
+        }
+
+        // **********************************************************
+
+        //! @return Current state of the FSM.
+        [[nodiscard]] State getState() const noexcept
+        {
+            return m_state;
+        }
+
+        //! This function will update state machine, in the same way as Fsm::update. The state function and
+        //! the transition functions of the current state are taken from the table entry at the index of the state.
+        //! Note: this has potential to become an infinite loop, if the FSM design is flawed.
+        void update()
+        {
+            static_assert(isValid(), "Each entry of the table needs to be placed at the index of its state.");
+
+            FsmTransitionResult<State> transition_result;
+            bool                       state_changed = false;
+
+            do
+            {
+                // Clear transition result and state_changed in every state loop
+                transition_result = {};
+                state_changed     = false;
+
+                if constexpr (state_first)
+                {
+                    executeState();
+                }
+
+                // Invoke transitions functions for the current state, until a new state is found
+                for (const auto transition : table[static_cast<size_t>(m_state)].transitions)
+                {
+                    if (transition == nullptr)
+                    {
+                        break;
+                    }
+
+                    transition_result = (m_parent.*transition)();
+
+                    if (not transition_result.isDefault())
+                    {
+                        state_changed = (m_state != transition_result.state());
+                        m_state       = transition_result.state();
+                        break;
+                    }
+                }
+
+                if constexpr (not state_first)
+                {
+                    executeState();
+                }
+            } while (state_changed && transition_result.cascade());
+        }
+
+        void reset() noexcept
+        {
+            m_state = m_starting_state;
+        }
+
+      private:
+        void executeState()
+        {
+            // Invoke state function for the current state
+            const auto state_func = table[static_cast<size_t>(m_state)].state_func;
+            if (state_func != nullptr)
+            {
+                (m_parent.*state_func)();
+            }
+        }
+
+        Parent& m_parent;           //!< Reference to the object of the Parent class, used to execute state and
+                                    //!< transition functions.
+        State   m_state;            //!< Current state of the FSM.
+        State   m_starting_state;   //!< Starting state of the FSM.
+    };
+}
+
+// EOF
@@ -0,0 +1,195 @@
+//! @file
+//! @brief File with unit tests of the table-driven Finite State Machine.
+//! @author Dominik Arominski
+
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "fsm.hpp"
+#include "tableFsm.hpp"
+
+using namespace utils;
+
+class TableFsmTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+    }
+};
+
+namespace
+{
+    enum class Mode
+    {
+        off,
+        starting,
+        on,
+        fault
+    };
+
+    //! Machine recording the state functions executed, driven either by a TableFsm or by an Fsm
+    class Machine
+    {
+        using Result = FsmTransitionResult<Mode>;
+
+      public:
+        static const FsmTable<Mode, Machine, 4, 2> table;
+
+        explicit Machine(const bool use_table)
+            : m_use_table(use_table)
+        {
+            // clang-format off
+            m_map_fsm.addState(Mode::off,      &Machine::onOff,      {&Machine::toStarting});
+            m_map_fsm.addState(Mode::starting, &Machine::onStarting, {&Machine::toFault, &Machine::toOn});
+            m_map_fsm.addState(Mode::on,       &Machine::onOn,       {&Machine::toFault, &Machine::toOff});
+            m_map_fsm.addState(Mode::fault,    nullptr,              {&Machine::toOff});
+            // clang-format on
+        }
+
+        void update()
+        {
+            m_use_table ? m_table_fsm.update() : m_map_fsm.update();
+        }
+
+        [[nodiscard]] Mode getState() const
+        {
+            return m_use_table ? m_table_fsm.getState() : m_map_fsm.getState();
+        }
+
+        void reset()
+        {
+            m_use_table ? m_table_fsm.reset() : m_map_fsm.reset();
+        }
+
+        bool              start{false};   //!< Start requested
+        bool              ready{false};   //!< Start-up finished
+        bool              fault{false};   //!< Fault present
+        std::vector<Mode> executed;       //!< States whose state function was executed, in order
+
+        void onOff()
+        {
+            executed.push_back(Mode::off);
+        }
+
+        void onStarting()
+        {
+            executed.push_back(Mode::starting);
+        }
+
+        void onOn()
+        {
+            executed.push_back(Mode::on);
+        }
+
+        Result toStarting()
+        {
+            return start ? Result{Mode::starting, FsmCascade} : Result{};
+        }
+
+        Result toOn()
+        {
+            return ready ? Result{Mode::on} : Result{};
+        }
+
+        Result toFault()
+        {
+            return fault ? Result{Mode::fault, FsmCascade} : Result{};
+        }
+
+        Result toOff()
+        {
+            // staying in the same state stops checking the following transitions
+            return start ? Result{getState()} : Result{Mode::off};
+        }
+
+      private:
+        bool                           m_use_table;
+        TableFsm<Mode, Machine, table> m_table_fsm{*this, Mode::off};
+        Fsm<Mode, Machine>             m_map_fsm{*this, Mode::off};
+    };
+
+    // clang-format off
+    constexpr FsmTable<Mode, Machine, 4, 2> Machine::table{{
+        {Mode::off,      &Machine::onOff,      {&Machine::toStarting}},
+        {Mode::starting, &Machine::onStarting, {&Machine::toFault, &Machine::toOn}},
+        {Mode::on,       &Machine::onOn,       {&Machine::toFault, &Machine::toOff}},
+        {Mode::fault,    nullptr,              {&Machine::toOff}},
+    }};
+
+    constexpr FsmTable<Mode, Machine, 4, 2> misplaced_table{{
+        {Mode::off,      &Machine::onOff,      {&Machine::toStarting}},
+        {Mode::on,       &Machine::onOn,       {&Machine::toFault, &Machine::toOff}},
+        {Mode::starting, &Machine::onStarting, {&Machine::toFault, &Machine::toOn}},
+        {Mode::fault,    nullptr,              {&Machine::toOff}},
+    }};
+
+    constexpr FsmTable<Mode, Machine, 4, 2> interleaved_table{{
+        {Mode::off,      &Machine::onOff,      {nullptr, &Machine::toStarting}},
+        {Mode::starting, &Machine::onStarting, {&Machine::toFault, &Machine::toOn}},
+        {Mode::on,       &Machine::onOn,       {&Machine::toFault, &Machine::toOff}},
+        {Mode::fault,    nullptr,              {&Machine::toOff}},
+    }};
+    // clang-format on
+}
+
+//! Checks that tables with entries out of order or with interleaved nullptrs are detected at compile time
+TEST_F(TableFsmTest, TableValidation)
+{
+    static_assert(TableFsm<Mode, Machine, Machine::table>::isValid());
+    static_assert(not TableFsm<Mode, Machine, misplaced_table>::isValid());
+    static_assert(not TableFsm<Mode, Machine, interleaved_table>::isValid());
+}
+
+//! Checks the state functions, transitions and cascades of the table-driven FSM
+TEST_F(TableFsmTest, Transitions)
+{
+    Machine machine(true);
+    machine.update();
+    EXPECT_EQ(machine.getState(), Mode::off);
+
+    // cascade: the state function of the new state is executed in the same update
+    machine.start = true;
+    machine.update();
+    EXPECT_EQ(machine.getState(), Mode::starting);
+    EXPECT_EQ(machine.executed, (std::vector<Mode>{Mode::off, Mode::off, Mode::starting}));
+
+    machine.ready = true;
+    machine.update();
+    EXPECT_EQ(machine.getState(), Mode::on);
+
+    // the first transition which does not return a default result is the only one taken
+    machine.update();
+    EXPECT_EQ(machine.getState(), Mode::on);
+
+    machine.fault = true;
+    machine.update();
+    EXPECT_EQ(machine.getState(), Mode::fault);
+
+    machine.reset();
+    EXPECT_EQ(machine.getState(), Mode::off);
+}
+
+//! Checks that the table-driven FSM behaves exactly like the map-based one
+TEST_F(TableFsmTest, SameAsFsm)
+{
+    Machine table_machine(true);
+    Machine map_machine(false);
+
+    for (int step = 0; step < 64; step++)
+    {
+        for (auto* machine : {&table_machine, &map_machine})
+        {
+            machine->start = (step % 16) < 12;
+            machine->ready = (step % 4) == 3;
+            machine->fault = (step % 16) == 9;
+            machine->update();
+        }
+        ASSERT_EQ(table_machine.getState(), map_machine.getState());
+    }
+    EXPECT_EQ(table_machine.executed, map_machine.executed);
+}
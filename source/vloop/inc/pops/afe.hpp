@@ -49,14 +49,17 @@ namespace user
             const double p_ref, const double q_ref, const double start
         )
         {
+            // conversion constants of the active bank
+            const auto& [wl, v_to_pu, si_to_pu, pu_to_si, i_to_pu] = m_conversion.value();
+
             //
             // Measurement and reference frame
             //
-            const double wt_pll = pll.synchronise(v_a * m_v_to_pu, v_b * m_v_to_pu, v_c * m_v_to_pu);
+            const double wt_pll = pll.synchronise(v_a * v_to_pu, v_b * v_to_pu, v_c * v_to_pu);
             const auto [vd_meas, vq_meas, zero_v]
-                = abc_2_dq0.transform(v_a * m_v_to_pu, v_b * m_v_to_pu, v_c * m_v_to_pu, wt_pll);
+                = abc_2_dq0.transform(v_a * v_to_pu, v_b * v_to_pu, v_c * v_to_pu, wt_pll);
             const auto [id_meas, iq_meas, zero_i]
-                = abc_2_dq0.transform(i_a * m_i_to_pu, i_b * m_i_to_pu, i_c * m_i_to_pu, wt_pll);
+                = abc_2_dq0.transform(i_a * i_to_pu, i_b * i_to_pu, i_c * i_to_pu, wt_pll);
             const auto [p_meas, q_meas] = power_3ph_instant.calculate(v_a, v_b, v_c, i_a, i_b, i_c);
 
             //
@@ -70,9 +73,9 @@ namespace user
             //
             // PI + 2 * ff for each loop
             const auto vd_ref
-                = pi_vd_ref.control(start * id_ref, start * id_meas) + vd_meas - i_base * m_wl * m_si_to_pu * iq_meas;
+                = pi_vd_ref.control(start * id_ref, start * id_meas) + vd_meas - i_base * wl * si_to_pu * iq_meas;
             const auto vq_ref
-                = pi_vq_ref.control(start * iq_ref, start * iq_meas) + vq_meas + i_base * m_wl * m_si_to_pu * id_meas;
+                = pi_vq_ref.control(start * iq_ref, start * iq_meas) + vq_meas + i_base * wl * si_to_pu * id_meas;
 
             //
             // Frame conversion
@@ -84,14 +87,14 @@ namespace user
         }
 
         // Owned Components
-        vslib::SRFPLL                       pll;
-        vslib::AbcToDq0Transform            abc_2_dq0;
-        vslib::Dq0ToAbcTransform            dq0_2_abc;
+        vslib::SRFPLL<>                     pll;
+        vslib::AbcToDq0Transform<>          abc_2_dq0;
+        vslib::Dq0ToAbcTransform<>          dq0_2_abc;
         vslib::InstantaneousPowerThreePhase power_3ph_instant;
-        vslib::PID                          pi_id_ref;
-        vslib::PID                          pi_iq_ref;
-        vslib::PID                          pi_vd_ref;
-        vslib::PID                          pi_vq_ref;
+        vslib::PID<>                        pi_id_ref;
+        vslib::PID<>                        pi_iq_ref;
+        vslib::PID<>                        pi_vd_ref;
+        vslib::PID<>                        pi_vq_ref;
         vslib::LimitRange<double>           limit;
 
         // Owned Parameters
@@ -102,21 +105,29 @@ namespace user
 
         std::optional<fgc4::utils::Warning> verifyParameters() override
         {
-            m_wl       = 2.0 * std::numbers::pi * frequency.toValidate() * inductance.toValidate();
+            Conversion conversion{};
+            conversion.wl       = 2.0 * std::numbers::pi * frequency.toValidate() * inductance.toValidate();
             // conversion constants, based on base voltage and base current:
-            m_v_to_pu  = 1.0 / v_base.toValidate();
-            m_si_to_pu = sqrt(3.0 / 2.0) / v_base.toValidate();
-            m_pu_to_si = 1.0 / m_si_to_pu;
-            m_i_to_pu  = 1.0 / i_base.toValidate();
+            conversion.v_to_pu  = 1.0 / v_base.toValidate();
+            conversion.si_to_pu = sqrt(3.0 / 2.0) / v_base.toValidate();
+            conversion.pu_to_si = 1.0 / conversion.si_to_pu;
+            conversion.i_to_pu  = 1.0 / i_base.toValidate();
 
+            m_conversion.set(conversion);
             return {};
         }
 
       private:
-        double m_wl{0.0};
-        double m_v_to_pu{0.0};    //!< voltage to per unit
-        double m_si_to_pu{0.0};   //!<
-        double m_pu_to_si{0.0};
-        double m_i_to_pu{0.0};   //!< current to per unit
+        //! Conversion constants derived from the Parameters
+        struct Conversion
+        {
+            double wl{0.0};
+            double v_to_pu{0.0};    //!< voltage to per unit
+            double si_to_pu{0.0};   //!<
+            double pu_to_si{0.0};
+            double i_to_pu{0.0};   //!< current to per unit
+        };
+
+        vslib::BankedValue<Conversion> m_conversion{};   //!< Conversion constants, per bank
     };
 }   // namespace user
\ No newline at end of file
@@ -55,14 +55,17 @@ namespace user
             const double v_dc_ref, const double v_dc_meas, const double q_ref, const double regulation_on = 1.0
         )
         {
+            // conversion constants of the active bank
+            const auto& [wl, si_to_pu, pu_to_v, i_to_pu, va_to_pu] = m_conversion.value();
+
             //
             // Synchronisation, measurement, and change of reference frame
             //
-            const auto wt_pll = pll.synchronise(v_a * m_si_to_pu, v_b * m_si_to_pu, v_c * m_si_to_pu);
+            const auto wt_pll = pll.synchronise(v_a * si_to_pu, v_b * si_to_pu, v_c * si_to_pu);
             const auto [vd_meas, vq_meas, zero_v]
-                = abc_to_dq0_v.transform(v_a * m_si_to_pu, v_b * m_si_to_pu, v_c * m_si_to_pu, wt_pll);
+                = abc_to_dq0_v.transform(v_a * si_to_pu, v_b * si_to_pu, v_c * si_to_pu, wt_pll);
             const auto [id_meas, iq_meas, zero_i]
-                = abc_to_dq0_i.transform(i_a * m_i_to_pu, i_b * m_i_to_pu, i_c * m_i_to_pu, wt_pll);
+                = abc_to_dq0_i.transform(i_a * i_to_pu, i_b * i_to_pu, i_c * i_to_pu, wt_pll);
             const auto [p_meas, q_meas] = power_3ph_instant.calculate(v_a, v_b, v_c, i_a, i_b, i_c);
 
             auto p_ref = 0;
@@ -78,7 +81,7 @@ namespace user
             //
             // Outer loop: power regulation
             // 2 RSTs
-            const auto id_ref = rst_outer_id.control(regulation_on * p_ref * m_va_to_pu, regulation_on * p_meas);
+            const auto id_ref = rst_outer_id.control(regulation_on * p_ref * va_to_pu, regulation_on * p_meas);
             const auto iq_ref = -rst_outer_iq.control(regulation_on * q_ref, regulation_on * q_meas);
 
             //
@@ -86,9 +89,9 @@ namespace user
             //
             // RST + 2 * ff for each loop
             const auto vd_ref = rst_inner_vd.control(-regulation_on * id_ref, regulation_on * id_meas) + vd_meas
-                                + iq_meas * i_base * m_wl * m_si_to_pu;
+                                + iq_meas * i_base * wl * si_to_pu;
             const auto vq_ref = rst_inner_vq.control(-regulation_on * iq_ref, regulation_on * iq_meas) + vq_meas
-                                - id_meas * i_base * m_wl * m_si_to_pu;
+                                - id_meas * i_base * wl * si_to_pu;
 
             //
             // Frame conversion
@@ -97,14 +100,14 @@ namespace user
             const auto vq_ref_lim = limit.limit(vq_ref);
 
             const auto [v_a_ref, v_b_ref, v_c_ref] = dq0_to_abc.transform(vd_ref_lim, vq_ref_lim, 0.0, wt_pll);
-            return std::make_tuple(v_a_ref * m_pu_to_v, v_b_ref * m_pu_to_v, v_c_ref * m_pu_to_v);
+            return std::make_tuple(v_a_ref * pu_to_v, v_b_ref * pu_to_v, v_c_ref * pu_to_v);
         }
 
         // Owned Components
-        vslib::SRFPLL                       pll;
-        vslib::AbcToDq0Transform            abc_to_dq0_v;
-        vslib::AbcToDq0Transform            abc_to_dq0_i;
-        vslib::Dq0ToAbcTransform            dq0_to_abc;
+        vslib::SRFPLL<>                     pll;
+        vslib::AbcToDq0Transform<>          abc_to_dq0_v;
+        vslib::AbcToDq0Transform<>          abc_to_dq0_i;
+        vslib::Dq0ToAbcTransform<>          dq0_to_abc;
         vslib::InstantaneousPowerThreePhase power_3ph_instant;
         vslib::RST<1>                       rst_outer_vdc;
         vslib::RST<2>                       rst_outer_id;
@@ -121,24 +124,32 @@ namespace user
 
         std::optional<fgc4::utils::Warning> verifyParameters() override
         {
-            m_wl = 2.0 * std::numbers::pi * frequency.toValidate() * inductance.toValidate();
+            Conversion conversion{};
+            conversion.wl = 2.0 * std::numbers::pi * frequency.toValidate() * inductance.toValidate();
 
             // conversion constants, based on base voltage and base current:
-            m_si_to_pu = sqrt(3.0 / 2.0) / v_base.toValidate();
-            m_i_to_pu  = 1.0 / i_base.toValidate();
-            m_va_to_pu = sqrt(2.0 / 3.0) * m_i_to_pu / v_base.toValidate();
+            conversion.si_to_pu = sqrt(3.0 / 2.0) / v_base.toValidate();
+            conversion.i_to_pu  = 1.0 / i_base.toValidate();
+            conversion.va_to_pu = sqrt(2.0 / 3.0) * conversion.i_to_pu / v_base.toValidate();
 
-            m_pu_to_v = 1.0 / m_si_to_pu;
+            conversion.pu_to_v = 1.0 / conversion.si_to_pu;
 
+            m_conversion.set(conversion);
             return {};
         }
 
       private:
-        double m_wl{0.0};
-        double m_si_to_pu{0.0};
-        double m_pu_to_v{0.0};
-        double m_i_to_pu{0.0};
-        double m_va_to_pu{0.0};
+        //! Conversion constants derived from the Parameters
+        struct Conversion
+        {
+            double wl{0.0};
+            double si_to_pu{0.0};
+            double pu_to_v{0.0};
+            double i_to_pu{0.0};
+            double va_to_pu{0.0};
+        };
+
+        vslib::BankedValue<Conversion> m_conversion{};   //!< Conversion constants, per bank
 
         double m_delayed_start2{0.0};
         double m_delayed_start{0.0};
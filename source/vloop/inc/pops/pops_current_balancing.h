@@ -66,7 +66,8 @@ namespace user
             const double i_c_balanced = i_c_mav - i_abc_av;
 
             // multiply mean-subtracted currents by I_base and matrix elements to calculate scaled current of each
-            // component
+            // component, with the matrix of the active bank
+            const auto& [factors_a, factors_b, factors_c] = m_factors.value();
             const double i_a_scaled
                 = i_base * maverage_notch_frequency
                   * (factors_a[0] * i_a_balanced + factors_a[1] * i_b_balanced + factors_a[2] * i_c_balanced);
@@ -113,30 +114,23 @@ namespace user
         //! Third column of the scaling matrix for balancing current
         vslib::Parameter<std::array<double, 3>> c_factors;
 
-        //! Sets the matrix factos to a local copy for faster access
+        //! Sets the matrix factos to a local copy of the bank being loaded for faster access
         std::optional<fgc4::utils::Warning> verifyParameters() override
         {
-            factors_a[0] = a_factors.toValidate()[0];
-            factors_a[1] = a_factors.toValidate()[1];
-            factors_a[2] = a_factors.toValidate()[2];
-
-            factors_b[0] = b_factors.toValidate()[0];
-            factors_b[1] = b_factors.toValidate()[1];
-            factors_b[2] = b_factors.toValidate()[2];
-
-            factors_c[0] = c_factors.toValidate()[0];
-            factors_c[1] = c_factors.toValidate()[1];
-            factors_c[2] = c_factors.toValidate()[2];
+            m_factors.set({a_factors.toValidate(), b_factors.toValidate(), c_factors.toValidate()});
 
             return {};
         }
 
       private:
-        //! Local copy of the first column of the scaling matrix for balancing current
-        std::array<double, 3> factors_a;
-        //! Local copy of the second column of the scaling matrix for balancing current
-        std::array<double, 3> factors_b;
-        //! Local copy of the third column of the scaling matrix for balancing current
-        std::array<double, 3> factors_c;
+        //! Local copy of the scaling matrix for balancing current
+        struct Factors
+        {
+            std::array<double, 3> a{0.0};   //!< First column of the scaling matrix
+            std::array<double, 3> b{0.0};   //!< Second column of the scaling matrix
+            std::array<double, 3> c{0.0};   //!< Third column of the scaling matrix
+        };
+
+        vslib::BankedValue<Factors> m_factors{};   //!< Local copy of the scaling matrix, per bank
     };
 }
\ No newline at end of file
@@ -360,18 +360,15 @@ namespace user
         {
             if (operating_mode.toValidate() == OperatingMode::normal)
             {
-                m_n_floaters = 4;
-                m_n_chargers = 2;
+                m_dcdc_counts.set({4, 2});
             }
             else if (operating_mode.toValidate() == OperatingMode::degraded_1)
             {
-                m_n_floaters = 4;
-                m_n_chargers = 1;
+                m_dcdc_counts.set({4, 1});
             }
             else if (operating_mode.toValidate() == OperatingMode::degraded_2)
             {
-                m_n_floaters = 3;
-                m_n_chargers = 2;
+                m_dcdc_counts.set({3, 2});
             }
             return {};
         }
@@ -388,8 +385,14 @@ namespace user
         const double m_level_2{8 * m_v_min};      //!< Threshold to start using 6 DCDC, below: 2 DCDC
         const double m_open_loop_limit{4900.0};   //!< Minimum voltage during the open loop to engage 2 chargers DCDC
 
-        int m_n_floaters;   //! number of floaters DCDC
-        int m_n_chargers;   //! number of chargers DCDC
+        //! Numbers of DCDC of each kind, depending on the operating mode
+        struct DcdcCounts
+        {
+            int floaters{0};   //! number of floaters DCDC
+            int chargers{0};   //! number of chargers DCDC
+        };
+
+        vslib::BankedValue<DcdcCounts> m_dcdc_counts{};   //! numbers of DCDC, per bank
 
         // factors in dispatcher:
         const double m_k{0.5 * 0.247};             // ???
@@ -410,6 +413,8 @@ namespace user
         //! @param v_l Inductive voltage component [V]
         void dispatchRecharging(const double v_ref, const double i_mag_meas, const double v_r, const double v_l)
         {
+            const int n_chargers = m_dcdc_counts.value().chargers;   // count of the active bank
+
             double kc = 0;
             double kf = 0;
 
@@ -484,7 +489,7 @@ namespace user
                     }
                 }
                 // floaters:
-                for (size_t index = m_n_chargers; index < m_dEc.size(); index++)
+                for (size_t index = n_chargers; index < m_dEc.size(); index++)
                 {
                     m_v_ref_dispatch[index] = v_l * kf * (m_dEc[index] / Ef);
                 }
@@ -518,6 +523,8 @@ namespace user
         //! @param n_dcdc Number of DCDC that are active
         void dispatchCycle(const double v_ref, const double v_r, const double v_l, const int n_dcdc)
         {
+            const auto& [n_floaters, n_chargers] = m_dcdc_counts.value();   // counts of the active bank
+
             double kf = 0;
             if (n_dcdc == 1)
             {
@@ -544,18 +551,18 @@ namespace user
                         // assuming original calculation:
                         // energy needed to bring floaters to nominal voltage:
                         const double Ef
-                            = m_n_floaters * m_k * (std::pow(m_Udc_max_chargers, 2) - std::pow(m_Udc_min_chargers, 2));
+                            = n_floaters * m_k * (std::pow(m_Udc_max_chargers, 2) - std::pow(m_Udc_min_chargers, 2));
                         // energy needed to bring chargers to nominal voltage:
                         const double Ech
-                            = m_n_chargers * m_k * (std::pow(m_Udc_max_floaters, 2) - std::pow(m_Udc_min_floaters, 2));
+                            = n_chargers * m_k * (std::pow(m_Udc_max_floaters, 2) - std::pow(m_Udc_min_floaters, 2));
 
                         const double E = Ef + Ech;
                         kf             = Ef / E;
 
-                        m_v_ref_dispatch[0] = v_ref * (1 - kf) / m_n_chargers;
+                        m_v_ref_dispatch[0] = v_ref * (1 - kf) / n_chargers;
                         m_v_ref_dispatch[1] = m_v_ref_dispatch[0];
                         m_v_ref_dispatch[5] = m_v_ref_dispatch[4] = m_v_ref_dispatch[3] = m_v_ref_dispatch[2]
-                            = v_ref * kf / m_n_floaters;
+                            = v_ref * kf / n_floaters;
                         if (operating_mode == OperatingMode::degraded_2)
                         {
                             m_v_ref_dispatch[5] = 0.0;
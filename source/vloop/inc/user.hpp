@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <fmt/format.h>
 #include <string>
 #include <unistd.h>
@@ -9,6 +10,7 @@
 #include "halfBridge.hpp"
 #include "peripherals/bus.hpp"
 #include "peripherals/xil_axi_spi.hpp"
+#include "pollCpuClock.hpp"
 #include "vslib.hpp"
 
 namespace user
@@ -158,10 +160,13 @@ namespace user
             return std::bit_cast<TargetType>(input);
         }
 
+        //! Bound on the ADC conversion within a tick, 50 us at the frequency of the system counter
+        inline static const uint64_t adc_timeout_cycles = fgc4::utils::toCounterCycles(std::chrono::microseconds(50));
+
         static void RTTask(Converter& converter)
         {
-            converter.adc_1.start();
-            std::cout << converter.adc_1.readConverted(1) << "\n";
+            // the conversion runs while the rest of the tick is computed, and is collected at its end
+            converter.adc_1.trigger();
             // const auto success0 = converter.pwm_0.setModulationIndex(static_cast<float>(converter.counter) / 10'000);
             // const auto success1 = converter.pwm_1.setModulationIndex(static_cast<float>(converter.counter) / 10'000);
             // const auto success5 = converter.pwm_5.setModulationIndex(static_cast<float>(converter.counter) / 10'000);
@@ -196,6 +201,12 @@ namespace user
             // {
             //     converter.count_up = true;
             // }
+
+            // only the port in use is read, as every port read is a bus transaction
+            if (converter.adc_1.poll(adc_timeout_cycles))
+            {
+                std::cout << converter.adc_1.readConverted(1) << "\n";
+            }
         }
 
         vslib::HalfBridge<0>  pwm_0;
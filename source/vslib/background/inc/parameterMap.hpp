@@ -31,6 +31,13 @@ namespace vslib
         //! reinitialized each time this method is called.
         void uploadParameterMap();
 
+        //! Creates and uploads the current values of the requested Parameters to the shared memory, without any
+        //! metadata. The values are listed in the order of the request, with null for unknown Parameter names. The
+        //! message is tagged as parameter values, to be told apart from the parameter map sharing the queue.
+        //!
+        //! @param names JSON array with full names of the Parameters to be read back
+        void uploadParameterValues(const fgc4::utils::StaticJson& names);
+
       private:
         fgc4::utils::MessageQueueWriter<void> m_write_parameter_map_queue;   //!< Write-direction queue
         const RootComponent&                  m_root_component;              //!< Root Component to the running binary
@@ -6,10 +6,15 @@
 #pragma once
 
 #include <nlohmann/json-schema.hpp>
+#include <optional>
+#include <string>
 
+#include "commandStatusRecord.hpp"
 #include "component.hpp"
 #include "jsonCommandSchema.hpp"
 #include "messageQueue.hpp"
+#include "parameterBank.hpp"
+#include "parameterMap.hpp"
 #include "rootComponent.hpp"
 #include "staticJson.hpp"
 #include "vslibMessageQueue.hpp"
@@ -20,9 +25,11 @@ namespace vslib
     {
       public:
         //! Creates the ParameterSetting background task object and initializes the JSON schema validator as well as
-        //! read and write JSON queues
+        //! read and write JSON queues. Get commands are answered through the provided ParameterMap, and rejected if
+        //! there is none.
         ParameterSetting(
-            uint8_t* read_command_queue_address, uint8_t* write_status_queue_address, RootComponent& root_component
+            uint8_t* read_command_queue_address, uint8_t* write_status_queue_address, RootComponent& root_component,
+            ParameterMap* parameter_map = nullptr
         )
             : m_read_commands_queue{fgc4::utils::createMessageQueue<fgc4::utils::MessageQueueReader<void>>(
                 read_command_queue_address, fgc4::utils::constants::json_memory_pool_size
@@ -30,16 +37,24 @@ namespace vslib
               m_write_command_status{fgc4::utils::createMessageQueue<fgc4::utils::MessageQueueWriter<void>>(
                   write_status_queue_address, fgc4::utils::constants::string_memory_pool_size
               )},
-              m_root_component(root_component)
+              m_root_component(root_component),
+              m_parameter_map(parameter_map)
         {
             m_validator.set_root_schema(utils::json_command_schema);
+            // commands modify the active bank until a command selects another one
+            ParameterBank::load(ParameterBank::active());
         }
 
         //! Checks if a new command has arrived in shared memory, processes it, and when
         //! new command has come previously switches buffers and calls to synchronise them
-        void receiveJsonCommand();
+        //!
+        //! @return True if a message has been processed and all Components validated their Parameters, false otherwise
+        bool receiveJsonCommand();
 
-        //! Processes the received JSON commands, checking whether one or many commands were received.
+        //! Processes the received JSON commands, checking whether one or many commands were received. A single
+        //! command is answered with a text status, while an array of commands is answered with a single binary
+        //! CommandStatusRecord holding the result of each command. A get command is answered with the values of
+        //! the requested Parameters, uploaded by the ParameterMap.
         //!
         //! @param command JSON object containing one or more JSON commands to be executed
         void processJsonCommands(const fgc4::utils::StaticJson& command);
@@ -57,9 +72,20 @@ namespace vslib
         //! to be inserted
         void executeJsonCommand(const fgc4::utils::StaticJson& command);
 
-        //! Calls verifyParameters of all Components with initialized Parameters attached to the root Component.
+        //! Calls verifyParameters of all Components with initialized Parameters attached to the root Component, so
+        //! that they derive their values for the bank being loaded. Valid values are moved to the bank being loaded.
         //! Any raised warnings are forwarded to the output status queue.
-        void validateComponents();
+        //!
+        //! @return True if no Component raised a warning, false otherwise
+        bool validateComponents();
+
+        //! Provides the index of the bank receiving the values of the commands, selected by the last command.
+        //!
+        //! @return Index of the bank being loaded
+        [[nodiscard]] uint16_t getLoadingBank() const noexcept
+        {
+            return ParameterBank::loading();
+        }
 
         //! Checks if there are any new commands available in the queue.
         //!
@@ -67,7 +93,7 @@ namespace vslib
         bool checkNewSettingsAvailable();
 
       private:
-        nlohmann::json_schema::json_validator m_validator{};            //!< JSON schema for incoming commands
+        nlohmann::json_schema::json_validator m_validator{};            //!< Generic validator, debug cross-check
         fgc4::utils::MessageQueueReader<void> m_read_commands_queue;    //!< Incoming commands queue
         fgc4::utils::MessageQueueWriter<void> m_write_command_status;   //!< Command execution status queue
 
@@ -75,9 +101,83 @@ namespace vslib
         std::array<uint8_t, fgc4::utils::constants::json_memory_pool_size> m_read_commands_buffer{0};
 
         RootComponent& m_root_component;   //!< Root Component
+        ParameterMap*  m_parameter_map;    //!< Parameter map answering the get commands, if any
+
+        uint32_t m_batch_sequence{0};   //!< Sequence number of the next batch of commands
+
+        std::optional<uint64_t> m_activation{};              //!< Activation tick of the bank being loaded, if any
+        bool                    m_schedule_required{false};   //!< Whether the loaded bank needs to be scheduled
+
+        //! State of a chunked transfer of an array Parameter, staged in its write buffer until the transfer ends
+        struct ChunkedTransfer
+        {
+            IParameter* parameter;         //!< Parameter receiving the chunks
+            size_t      length;            //!< Number of elements to be transferred
+            size_t      received;          //!< Number of elements received so far, offset of the next chunk
+            uint64_t    checksum;          //!< Checksum of the chunks received so far
+            bool        was_initialized;   //!< Initialization flag of the Parameter before the transfer
+        };
+
+        std::optional<ChunkedTransfer> m_transfer{};   //!< Chunked transfer in progress, if any
+
+        //! Validates the provided json command against the schema and the interface version.
+        //!
+        //! @param command JSON object to be validated as a valid command
+        //! @param message Set to the explanation of the result if the command is invalid
+        //! @return Result code of the validation
+        utils::CommandResult checkCommand(const fgc4::utils::StaticJson& command, std::string& message);
+
+        //! Validates the major version of the communication interface of the provided command.
+        //!
+        //! @param command JSON object holding the version to be validated
+        //! @param message Set to the explanation of the result if the version is invalid
+        //! @return Result code of the validation
+        utils::CommandResult checkVersion(const fgc4::utils::StaticJson& command, std::string& message);
+
+        //! Validates a get command and uploads the current values of the requested Parameters.
+        //!
+        //! @param command JSON object containing the list of full names of the Parameters to be read back
+        void executeGetCommand(const fgc4::utils::StaticJson& command);
+
+        //! Validates and executes a single JSON command, without writing its status.
+        //!
+        //! @param command JSON object containing name of the parameter to be modified, and the new value
+        //! @param message Set to the explanation of the result if the command failed
+        //! @return Result code of the command execution
+        utils::CommandResult executeCommand(const fgc4::utils::StaticJson& command, std::string& message);
+
+        //! Executes a single command of a chunked transfer.
+        //!
+        //! @param command JSON object containing the stage of the transfer and its value
+        //! @param parameter Parameter identified by the command's parameter name
+        //! @param message Set to the explanation of the result if the command failed
+        //! @return Result code of the command execution
+        utils::CommandResult
+        executeTransfer(const fgc4::utils::StaticJson& command, IParameter& parameter, std::string& message);
+
+        //! Aborts the chunked transfer in progress, if any, and discards the elements staged so far.
+        void abortTransfer();
+
+        //! Checks whether the Component owns the Parameter of the chunked transfer in progress.
+        //!
+        //! @param component Component to be checked
+        //! @return True if the Component owns the Parameter being transferred, false otherwise
+        [[nodiscard]] bool isTransferring(const Component& component) const noexcept;
+
+        //! Writes the status record of a batch of commands to the status queue.
+        //!
+        //! @param record Status record to be written
+        void writeStatusRecord(utils::CommandStatusRecord& record);
+
+        //! Selects the bank receiving the values of the following commands, and sets the values of the source bank to
+        //! it and to the write buffers of all validated Parameters.
+        //!
+        //! @param bank Index of the bank to be loaded
+        //! @param source Index of the bank holding the initial values, must not be active if different from bank
+        void loadBank(const uint16_t bank, const uint16_t source);
 
         //! Recursive function to call verifyParameters on the component and its children
-        void validateComponent(const ChildrenList&);
+        bool validateComponent(const ChildrenList&);
     };
 
 }   // namespace vslib
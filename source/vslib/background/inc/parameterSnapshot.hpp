@@ -0,0 +1,79 @@
+//! @file
+//! @brief Header file containing background task class responsible for persisting validated Parameter values in a
+//! binary snapshot and restoring them on boot.
+//! @author Dominik Arominski
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace vslib
+{
+    //! Binary snapshot of all validated Parameter values, stored in a reserved memory region that survives a reboot
+    //! of the real-time core. Restoring the snapshot on boot sets the values directly to the Parameter buffers, so
+    //! that the converter can be configured with a single validation pass instead of waiting for the Linux side to
+    //! re-send all Parameters as JSON commands.
+    //!
+    //! The snapshot consists of a header, protected by a checksum, followed by one entry per Parameter. Each entry
+    //! is identified by the hash of the full Parameter name and the hash of its type label, and holds the raw bytes of
+    //! the value. Entries of Parameters that no longer exist, or that changed type, are ignored on restore.
+    class ParameterSnapshot
+    {
+      public:
+        //! Marker identifying a memory region holding a snapshot
+        constexpr static uint32_t magic = 0x56534E50;   // "VSNP"
+        //! Version of the snapshot layout, snapshots of other versions are not restored
+        constexpr static uint16_t schema_version = 1;
+
+        //! Creates the ParameterSnapshot background task object using the provided memory region.
+        //!
+        //! @param address Pointer to the beginning of the memory region reserved for the snapshot
+        //! @param size Size of the memory region in bytes
+        ParameterSnapshot(uint8_t* address, const size_t size) noexcept
+            : m_region{address, size}
+        {
+        }
+
+        //! Stores the read-buffer values of all validated Parameters in the snapshot, replacing the previous one. The
+        //! entries are staged before the previous snapshot is invalidated, so that it is kept if the new one does not
+        //! fit.
+        //!
+        //! @return True if the snapshot has been stored, false if it does not fit in the memory region
+        bool save();
+
+        //! Restores all Parameters stored in the snapshot to their write buffers and marks them as initialized. The
+        //! restored values still need to be validated by their Components, e.g. with
+        //! ParameterSetting::validateComponents.
+        //!
+        //! @return Number of restored Parameters, zero if there is no valid snapshot in the memory region
+        size_t restore();
+
+        //! Invalidates the snapshot, so that nothing is restored on the next boot.
+        void invalidate() noexcept;
+
+      private:
+        struct Header
+        {
+            uint32_t magic;
+            uint16_t schema_version;
+            uint16_t reserved;
+            uint32_t number_entries;
+            uint32_t payload_size;
+            uint64_t checksum;
+        };
+
+        struct EntryHeader
+        {
+            uint64_t name_hash;
+            uint32_t type_id;
+            uint32_t size;
+        };
+
+        std::span<uint8_t>   m_region;      //!< Memory region holding the snapshot
+        std::vector<uint8_t> m_staging{};   //!< Entries of the snapshot being saved
+    };
+
+}   // namespace vslib
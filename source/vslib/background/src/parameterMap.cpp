@@ -4,6 +4,8 @@
 //! @author Dominik Arominski
 
 #include "parameterMap.hpp"
+#include "parameterRegistry.hpp"
+#include "parameterSerializer.hpp"
 #include "versions.hpp"
 #include "vslibMessageQueue.hpp"
 
@@ -14,7 +16,8 @@ namespace vslib
         auto parameter_map = fgc4::utils::StaticJsonFactory::getJsonObject();
         parameter_map      = nlohmann::json::array();
         parameter_map.push_back(
-            {{"version",
+            {{"type", utils::parameter_map_message::parameter_map},
+             {"version",
               {
                   version::json_parameter_map.major,
                   version::json_parameter_map.minor,
@@ -24,4 +27,34 @@ namespace vslib
         parameter_map.push_back(m_root_component.serialize());
         utils::writeJsonToMessageQueue(parameter_map, m_write_parameter_map_queue);
     }
+
+    void ParameterMap::uploadParameterValues(const fgc4::utils::StaticJson& names)
+    {
+        const auto&         parameters = ParameterRegistry::instance().getParameters();
+        ParameterSerializer serializer;
+
+        auto parameter_values       = fgc4::utils::StaticJsonFactory::getJsonObject();
+        parameter_values["type"]    = utils::parameter_map_message::parameter_values;
+        parameter_values["version"] = {
+            version::json_parameter_map.major,
+            version::json_parameter_map.minor,
+            version::json_parameter_map.revision,
+        };
+        parameter_values["values"] = nlohmann::json::array();
+
+        auto& values = parameter_values["values"];
+        for (const auto& name : names)
+        {
+            const auto parameter = name.is_string() ? parameters.find(name.get<std::string>()) : parameters.end();
+            if (parameter == parameters.end())
+            {
+                values.push_back(nullptr);
+            }
+            else
+            {
+                values.push_back(serializer.serializeValue(parameter->second.get()));
+            }
+        }
+        utils::writeJsonToMessageQueue(parameter_values, m_write_parameter_map_queue);
+    }
 }   // namespace vslib
@@ -3,10 +3,17 @@
 //! validation of incoming commands, their execution, and triggering synchronisation of buffers.
 //! @author Dominik Arominski
 
+#include <algorithm>
+#include <cassert>
+
+#include "chunkedTransfer.hpp"
 #include "constants.hpp"
 #include "errorCodes.hpp"
 #include "fmt/format.h"
+#include "fnvHash.hpp"
+#include "jsonCommandValidator.hpp"
 #include "parameter.hpp"
+#include "parameterBank.hpp"
 #include "parameterRegistry.hpp"
 #include "parameterSetting.hpp"
 #include "versions.hpp"
@@ -15,139 +22,523 @@
 namespace vslib
 {
 
-    void ParameterSetting::receiveJsonCommand()
+    bool ParameterSetting::receiveJsonCommand()
     {
         auto message = m_read_commands_queue.read(m_read_commands_buffer);
-        if (message.has_value())
+        if (!message.has_value())
         {
-            auto json_object = fgc4::utils::StaticJsonFactory::getJsonObject();
-            json_object      = utils::readJsonFromMessageQueue(message.value());
-            // execute the command from the incoming stream, synchronises write and background buffers
-            processJsonCommands(json_object);
-
-            // after the processing, validate all Components
-            validateComponents();
+            return false;
         }
+        auto json_object = fgc4::utils::StaticJsonFactory::getJsonObject();
+        json_object      = utils::readJsonFromMessageQueue(message.value());
+        // execute the command from the incoming stream, synchronises write and background buffers
+        processJsonCommands(json_object);
+
+        // after the processing, validate all Components
+        return validateComponents();
     }
 
     void ParameterSetting::processJsonCommands(const fgc4::utils::StaticJson& commands)
     {
-        if (commands.is_object())   // single command
+        if (commands.is_object() && commands.contains("get"))   // read back of Parameter values
+        {
+            executeGetCommand(commands);
+        }
+        else if (commands.is_object())   // single command
         {
             executeJsonCommand(commands);
         }
-        else if (commands.is_array())   // multiple commands
+        else if (commands.is_array())   // multiple commands, answered with a single status record
         {
+            utils::CommandStatusRecord record(m_batch_sequence++);
+            uint16_t                   command_id = 0;
             for (const auto& command : commands)
             {
-                executeJsonCommand(command);
+                std::string message;
+                const auto  result = executeCommand(command, message);
+                if (!record.add(command_id, result, message))
+                {
+                    // batch does not fit in a single record, the rest follows in a record with the same sequence
+                    writeStatusRecord(record);
+                    record.clear();
+                    record.add(command_id, result, message);
+                }
+                command_id++;
             }
+            writeStatusRecord(record);
         }
     }
 
     bool ParameterSetting::validateJsonCommand(const fgc4::utils::StaticJson& command)
     {
-        bool valid = true;
+        std::string message;
+        const bool  valid = (checkCommand(command, message) == utils::CommandResult::success);
+        if (!valid)
+        {
+            utils::writeStringToMessageQueue(message, m_write_command_status);
+        }
+        return valid;
+    }
+
+    void ParameterSetting::executeJsonCommand(const fgc4::utils::StaticJson& command)
+    {
+        std::string message;
+        const auto  result = executeCommand(command, message);
+        if (result == utils::CommandResult::success)
+        {
+            utils::writeStringToMessageQueue("Parameter value updated successfully.\n", m_write_command_status);
+        }
+        else
+        {
+            utils::writeStringToMessageQueue(message, m_write_command_status);
+        }
+    }
+
+    utils::CommandResult
+    ParameterSetting::checkCommand(const fgc4::utils::StaticJson& command, std::string& message)
+    {
+        std::string schema_error;
+        const bool  schema_valid = utils::validateCommandSchema(command, schema_error);
+#ifndef NDEBUG
+        // the specialised validator is cross-checked against the generic validator of the schema in debug builds
+        bool generic_schema_valid = true;
         try
         {
             m_validator.validate(command);
         }
-        catch (const std::exception& e)
+        catch (const std::exception&)
+        {
+            generic_schema_valid = false;
+        }
+        assert(schema_valid == generic_schema_valid);
+#endif
+        if (!schema_valid)
+        {
+            const fgc4::utils::Warning warning("Command invalid: " + schema_error);
+            message = warning.warning_str.data();
+            return utils::CommandResult::invalid_command;
+        }
+
+        const auto version_result = checkVersion(command, message);
+        if (version_result != utils::CommandResult::success)
         {
-            valid = false;
-            const fgc4::utils::Warning message(std::string("Command invalid: ") + e.what());
-            utils::writeStringToMessageQueue(message.warning_str.data(), m_write_command_status);
+            return version_result;
         }
-        // check that major version is consistent
-        if (valid)
+
+        // the bank is optional, the active bank is loaded by default
+        if (command.contains("bank"))
         {
-            // The try-catch avoids fatal failure in case version is severely malformed: e.g. if it is not a list,
-            // or contains elements not comparable with integers
-            try
+            const auto& bank = command["bank"];
+            if (!bank.is_number_integer() || bank.get<int64_t>() < 0 || bank.get<int64_t>() >= number_banks)
             {
-                valid = (command["version"][0] == vslib::version::json_command.major);
+                const fgc4::utils::Warning warning(fmt::format(
+                    "Command invalid: bank needs to be an integer between 0 and {}.\n", number_banks - 1
+                ));
+                message = warning.warning_str.data();
+                return utils::CommandResult::invalid_command;
             }
-            catch (const std::exception& e)
+        }
+
+        // the offset is optional, the whole value is set by default
+        if (command.contains("offset"))
+        {
+            const auto& offset = command["offset"];
+            if (!offset.is_number_unsigned() && !(offset.is_number_integer() && offset.get<int64_t>() >= 0))
             {
-                valid = false;
-                const fgc4::utils::Warning message(fmt::format("Command invalid: {}", e.what()));
-                utils::writeStringToMessageQueue(message.warning_str.data(), m_write_command_status);
-                return valid;
+                const fgc4::utils::Warning warning("Command invalid: offset needs to be a non-negative integer.\n");
+                message = warning.warning_str.data();
+                return utils::CommandResult::invalid_command;
             }
-            if (!valid)
+        }
+
+        // the transfer stage is optional, values are set by a single command by default
+        if (command.contains("transfer"))
+        {
+            const auto& stage = command["transfer"];
+            std::string reason;
+            if (!stage.is_string()
+                || (stage != utils::transfer_stage::begin && stage != utils::transfer_stage::chunk
+                    && stage != utils::transfer_stage::end))
             {
-                const int&           version = command["version"][0];
-                fgc4::utils::Warning message(fmt::format(
-                    "Inconsistent major version of the communication interface! Provided version: {}, expected "
-                    "version: {}.\n",
-                    version, vslib::version::json_command.major
-                ));
-                utils::writeStringToMessageQueue(message.warning_str.data(), m_write_command_status);
+                reason = "transfer needs to be one of: begin, chunk, end";
+            }
+            else if (stage == utils::transfer_stage::chunk && !command.contains("offset"))
+            {
+                reason = "transfer chunk needs an offset";
+            }
+            else if (stage != utils::transfer_stage::chunk && !command["value"].is_number_unsigned()
+                     && !(command["value"].is_number_integer() && command["value"].get<int64_t>() >= 0))
+            {
+                reason = "transfer begin and end need a non-negative integer value";
+            }
+            if (!reason.empty())
+            {
+                const fgc4::utils::Warning warning("Command invalid: " + reason + ".\n");
+                message = warning.warning_str.data();
+                return utils::CommandResult::invalid_command;
             }
         }
-        return valid;
+
+        // the activation is optional, values are committed with the validation by default
+        if (command.contains("activation"))
+        {
+            const auto& activation = command["activation"];
+            std::string reason;
+            if (!activation.is_number_unsigned()
+                && !(activation.is_number_integer() && activation.get<int64_t>() >= 0))
+            {
+                reason = "activation needs to be a non-negative integer";
+            }
+            else if (number_banks < 2)
+            {
+                reason = "activation requires at least two banks of Parameter values";
+            }
+            else if (command.contains("bank") && command["bank"].get<uint16_t>() == ParameterBank::active())
+            {
+                reason = "activation cannot be scheduled for the active bank";
+            }
+            if (!reason.empty())
+            {
+                const fgc4::utils::Warning warning("Command invalid: " + reason + ".\n");
+                message = warning.warning_str.data();
+                return utils::CommandResult::invalid_command;
+            }
+        }
+        return utils::CommandResult::success;
     }
 
-    void ParameterSetting::executeJsonCommand(const fgc4::utils::StaticJson& command)
+    utils::CommandResult
+    ParameterSetting::checkVersion(const fgc4::utils::StaticJson& command, std::string& message)
+    {
+        // check that major version is consistent, the version array may still be empty or hold anything
+        const auto& version = command["version"];
+        if (!version.is_array() || version.empty() || !version[0].is_number_integer())
+        {
+            const fgc4::utils::Warning warning("Command invalid: major version needs to be an integer.\n");
+            message = warning.warning_str.data();
+            return utils::CommandResult::invalid_command;
+        }
+        if (version[0].get<int64_t>() != vslib::version::json_command.major)
+        {
+            const fgc4::utils::Warning warning(fmt::format(
+                "Inconsistent major version of the communication interface! Provided version: {}, expected "
+                "version: {}.\n",
+                version[0].get<int64_t>(), vslib::version::json_command.major
+            ));
+            message = warning.warning_str.data();
+            return utils::CommandResult::version_mismatch;
+        }
+        return utils::CommandResult::success;
+    }
+
+    void ParameterSetting::executeGetCommand(const fgc4::utils::StaticJson& command)
     {
-        if (!validateJsonCommand(command))
+        std::string message;
+        if (!command.contains("version") || checkVersion(command, message) != utils::CommandResult::success)
+        {
+            if (message.empty())
+            {
+                const fgc4::utils::Warning warning("Command invalid: required property 'version' not found.\n");
+                message = warning.warning_str.data();
+            }
+            utils::writeStringToMessageQueue(message, m_write_command_status);
+            return;
+        }
+
+        const auto& names       = command["get"];
+        const bool  names_valid = names.is_array()
+                                 && std::all_of(
+                                     names.cbegin(), names.cend(),
+                                     [](const auto& name)
+                                     {
+                                         return name.is_string();
+                                     }
+                                 );
+        if (!names_valid)
         {
-            const fgc4::utils::Warning message("Command invalid, ignored.\n");
+            const fgc4::utils::Warning warning("Command invalid: get needs to be an array of Parameter names.\n");
+            utils::writeStringToMessageQueue(warning.warning_str.data(), m_write_command_status);
             return;
         }
+        if (m_parameter_map == nullptr)
+        {
+            const fgc4::utils::Warning warning("Get commands are not supported, no parameter map available.\n");
+            utils::writeStringToMessageQueue(warning.warning_str.data(), m_write_command_status);
+            return;
+        }
+
+        // the values are answered through the parameter map queue, as they do not fit in a status message
+        m_parameter_map->uploadParameterValues(names);
+    }
+
+    utils::CommandResult
+    ParameterSetting::executeCommand(const fgc4::utils::StaticJson& command, std::string& message)
+    {
+        const auto result = checkCommand(command, message);
+        if (result != utils::CommandResult::success)
+        {
+            return result;
+        }
         const std::string& parameter_name     = command["name"];
         const auto&        parameter_registry = ParameterRegistry::instance().getParameters();
         const auto&        parameter          = parameter_registry.find(parameter_name);
         if (parameter == parameter_registry.end())
         {
-            const fgc4::utils::Warning message("Parameter ID: " + parameter_name + " not found. Command ignored.\n");
-            utils::writeStringToMessageQueue(message.warning_str.data(), m_write_command_status);
-            return;
+            const fgc4::utils::Warning warning("Parameter ID: " + parameter_name + " not found. Command ignored.\n");
+            message = warning.warning_str.data();
+            return utils::CommandResult::parameter_not_found;
         }
 
-        // execute the command, parameter will handle the validation of provided value.
-        const auto& warning = (*parameter).second.get().setJsonValue(command["value"]);
-        if (!warning.has_value())
+        // scheduled values are loaded to the bank following the active one by default, starting from the active values
+        const std::optional<uint64_t> activation
+            = command.contains("activation") ? std::optional<uint64_t>(command["activation"].get<uint64_t>())
+                                             : std::nullopt;
+        uint16_t   bank        = 0;
+        uint16_t   source      = 0;
+        const auto select_bank = [&]()
         {
-            // success, otherwise: failure and Warning message already logged by setJsonValue
-            utils::writeStringToMessageQueue("Parameter value updated successfully.\n", m_write_command_status);
+            const uint16_t active = ParameterBank::active();
+            bank                  = active;
+            source                = active;
+            if (command.contains("bank"))
+            {
+                bank   = command["bank"].get<uint16_t>();
+                source = bank;
+            }
+            else if (activation.has_value())
+            {
+                bank = static_cast<uint16_t>((active + 1) % number_banks);
+            }
+        };
+        select_bank();
+
+        if (bank != ParameterBank::loading() || activation != m_activation)
+        {
+            // values staged so far belong to the previously loaded bank, as does a transfer in progress
+            abortTransfer();
+            validateComponents();
         }
-        else
+        // a bank cannot be modified while a switch to it is scheduled, and a new schedule replaces the previous one.
+        // The real-time task may have committed the switch before it could be cancelled, so the bank is selected again
+        // once no switch is pending and the active bank can no longer change under the command.
+        if (activation.has_value() || ParameterBank::scheduled() == bank)
+        {
+            ParameterBank::cancel();
+            select_bank();
+        }
+        if (bank != ParameterBank::loading() || activation != m_activation)
+        {
+            loadBank(bank, source);
+            m_activation = activation;
+        }
+        m_schedule_required = activation.has_value();
+
+        auto& target = (*parameter).second.get();
+        if (command.contains("transfer"))
+        {
+            return executeTransfer(command, target, message);
+        }
+        if (m_transfer.has_value() && m_transfer->parameter == &target)
+        {
+            // a value set by a single command replaces the transfer in progress
+            abortTransfer();
+        }
+
+        // execute the command, parameter will handle the validation of provided value. Commands with an offset set a
+        // slice of an array Parameter only, the Components still validate the whole array.
+        const auto& warning = command.contains("offset")
+                                  ? target.setJsonSlice(command["value"], command["offset"].get<size_t>())
+                                  : target.setJsonValue(command["value"]);
+        if (warning.has_value())
+        {
+            // failure, Warning message already logged by setJsonValue
+            message = warning.value().warning_str.data();
+            return utils::CommandResult::value_rejected;
+        }
+        return utils::CommandResult::success;
+    }
+
+    utils::CommandResult ParameterSetting::executeTransfer(
+        const fgc4::utils::StaticJson& command, IParameter& parameter, std::string& message
+    )
+    {
+        const std::string& parameter_name = command["name"];
+        const auto&        stage          = command["transfer"];
+        const auto&        value          = command["value"];
+
+        const auto reject = [&](const std::string& reason)
+        {
+            abortTransfer();
+            const fgc4::utils::Warning warning(reason);
+            message = warning.warning_str.data();
+            return utils::CommandResult::value_rejected;
+        };
+
+        if (stage == utils::transfer_stage::begin)
+        {
+            // a new transfer replaces the one in progress
+            abortTransfer();
+            if (parameter.getLength() == 0 || value.get<size_t>() != parameter.getLength())
+            {
+                return reject(fmt::format(
+                    "Transfer of {} needs to set all {} elements of an array Parameter, {} announced.\n",
+                    parameter_name, parameter.getLength(), value.get<size_t>()
+                ));
+            }
+            m_transfer = ChunkedTransfer{
+                &parameter, parameter.getLength(), 0, utils::fnv_offset_basis, parameter.isInitialized()};
+            // the Component is not validated until the transfer ends, while chunks are set as slices
+            parameter.setInitialized(true);
+            return utils::CommandResult::success;
+        }
+
+        if (!m_transfer.has_value() || m_transfer->parameter != &parameter)
+        {
+            const fgc4::utils::Warning warning(fmt::format("No transfer of {} in progress.\n", parameter_name));
+            message = warning.warning_str.data();
+            return utils::CommandResult::invalid_command;
+        }
+
+        if (stage == utils::transfer_stage::chunk)
+        {
+            const auto offset = command["offset"].get<size_t>();
+            if (offset != m_transfer->received)
+            {
+                return reject(fmt::format(
+                    "Chunk of {} at offset {}, expected offset: {}. Transfer aborted.\n", parameter_name, offset,
+                    m_transfer->received
+                ));
+            }
+            // the chunk is written straight to the write buffer
+            const auto warning = parameter.setJsonSlice(value, offset);
+            if (warning.has_value())
+            {
+                return reject(std::string(warning.value().warning_str.data()));
+            }
+            m_transfer->received += value.size();
+            m_transfer->checksum  = utils::chunkChecksum(value, m_transfer->checksum);
+            return utils::CommandResult::success;
+        }
+
+        if (m_transfer->received != m_transfer->length)
+        {
+            return reject(fmt::format(
+                "Transfer of {} incomplete, received {} of {} elements. Transfer aborted.\n", parameter_name,
+                m_transfer->received, m_transfer->length
+            ));
+        }
+        if (value.get<uint64_t>() != m_transfer->checksum)
+        {
+            return reject(fmt::format("Transfer of {} checksum incorrect. Transfer aborted.\n", parameter_name));
+        }
+        // the Parameter stays initialized, the transferred value is validated with the Component
+        m_transfer.reset();
+        return utils::CommandResult::success;
+    }
+
+    void ParameterSetting::abortTransfer()
+    {
+        if (!m_transfer.has_value())
+        {
+            return;
+        }
+        auto& parameter = *m_transfer->parameter;
+        parameter.setInitialized(m_transfer->was_initialized);
+        if (parameter.isValidated())
+        {
+            // the elements staged so far are discarded
+            parameter.syncWriteBuffer(ParameterBank::loading());
+        }
+        m_transfer.reset();
+    }
+
+    bool ParameterSetting::isTransferring(const Component& component) const noexcept
+    {
+        if (!m_transfer.has_value())
         {
-            utils::writeStringToMessageQueue(warning.value().warning_str.data(), m_write_command_status);
+            return false;
         }
+        const auto& parameters = component.getParameters();
+        return std::any_of(
+            parameters.cbegin(), parameters.cend(),
+            [this](const auto& parameter)
+            {
+                return &parameter.second.get() == m_transfer->parameter;
+            }
+        );
+    }
+
+    void ParameterSetting::writeStatusRecord(utils::CommandStatusRecord& record)
+    {
+        const auto serialized = record.serialize();
+        // the status is dropped if the queue is full, as is the case for the text status
+        m_write_command_status.write(serialized);
     }
 
-    void ParameterSetting::validateComponents()
+    bool ParameterSetting::validateComponents()
     {
         // The RootComponent has no Parameters, so no validation is required.
         //
         // Validate all children and their children tree indefinitely deeply
-        validateComponent(m_root_component.getChildren());
+        const bool valid = validateComponent(m_root_component.getChildren());
+
+        // the validated bank is selected by the real-time task at the activation tick
+        if (m_schedule_required)
+        {
+            ParameterBank::schedule(ParameterBank::loading(), m_activation.value());
+            m_schedule_required = false;
+        }
+        return valid;
     }
 
-    void ParameterSetting::validateComponent(const ChildrenList& children)
+    bool ParameterSetting::validateComponent(const ChildrenList& children)
     {
+        bool valid = true;
         for (const auto& child : children)
         {
             auto& component = child.get();
-            if (component.parametersInitialized())
+            // a Component is validated once the transfer of its Parameter has ended
+            if (component.parametersInitialized() && !isTransferring(component))
             {
                 const auto& warning = component.verifyParameters();
                 if (!warning.has_value())
                 {
+                    // flipped before being marked as validated, so that first values are set to all banks
+                    component.flipBufferState(ParameterBank::loading());
                     component.setParametersValidated();
-                    component.flipBufferState();
                 }
                 else
                 {
                     // if Parameters have been marked as initialized but are not valid
                     component.revokeValidation();
+                    valid = false;
                 }
                 // if there is an issue: it is logged, the component's buffer is not flipped
-                component.synchroniseParameterBuffers();
+                component.synchroniseParameterBuffers(ParameterBank::loading());
+            }
+            valid = validateComponent(component.getChildren()) && valid;
+        }
+        return valid;
+    }
+
+    void ParameterSetting::loadBank(const uint16_t bank, const uint16_t source)
+    {
+        ParameterBank::load(bank);
+        for (const auto& [name, parameter_reference] : ParameterRegistry::instance().getParameters())
+        {
+            auto& parameter = parameter_reference.get();
+            // Parameters that have never been validated keep their staged value, it is set to all banks once valid
+            if (!parameter.isValidated())
+            {
+                continue;
+            }
+            if (source != bank)
+            {
+                // the bank is not active, its values can be replaced directly
+                parameter.syncWriteBuffer(source);
+                parameter.swapBuffers(bank);
             }
-            validateComponent(component.getChildren());
+            parameter.syncWriteBuffer(bank);
         }
     }
 
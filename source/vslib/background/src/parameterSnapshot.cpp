@@ -0,0 +1,154 @@
+//! @file
+//! @brief Source file containing library-side background task code for persisting validated Parameter values and
+//! restoring them on boot.
+//! @author Dominik Arominski
+
+#include <cstring>
+#include <unordered_map>
+
+#include "fmt/format.h"
+#include "fnvHash.hpp"
+#include "parameterRegistry.hpp"
+#include "parameterSnapshot.hpp"
+#include "warningMessage.hpp"
+
+namespace vslib
+{
+    bool ParameterSnapshot::save()
+    {
+        if (m_region.size() < sizeof(Header))
+        {
+            return false;
+        }
+
+        // entries are staged first, so that the previous snapshot is kept if the new one does not fit
+        const auto payload        = m_region.subspan(sizeof(Header));
+        uint32_t   number_entries = 0;
+        m_staging.clear();
+        for (const auto& [name, parameter_reference] : ParameterRegistry::instance().getParameters())
+        {
+            const auto& parameter = parameter_reference.get();
+            if (!parameter.isValidated())
+            {
+                continue;
+            }
+            const auto value = parameter.getSnapshotValue();
+            if (!value.has_value())
+            {
+                continue;
+            }
+
+            const EntryHeader entry{
+                utils::fnv1aHash(name), parameter.getSnapshotTypeId(), static_cast<uint32_t>(value->size())};
+            const size_t offset = m_staging.size();
+            if (offset + sizeof(EntryHeader) + value->size() > payload.size())
+            {
+                const fgc4::utils::Warning warning(fmt::format(
+                    "Parameter snapshot does not fit in {} bytes, previous snapshot kept.\n", m_region.size()
+                ));
+                return false;
+            }
+            m_staging.resize(offset + sizeof(EntryHeader) + value->size());
+            std::memcpy(m_staging.data() + offset, &entry, sizeof(EntryHeader));
+            std::memcpy(m_staging.data() + offset + sizeof(EntryHeader), value->data(), value->size());
+            number_entries++;
+        }
+
+        // entries are written before the header, so that an interrupted save never leaves a valid-looking snapshot
+        invalidate();
+        const size_t payload_size = m_staging.size();
+        std::memcpy(payload.data(), m_staging.data(), payload_size);
+
+        const Header header{
+            magic,
+            schema_version,
+            0,
+            number_entries,
+            static_cast<uint32_t>(payload_size),
+            utils::fnv1aHash(std::as_bytes(payload.first(payload_size))),
+        };
+        std::memcpy(m_region.data(), &header, sizeof(Header));
+        return true;
+    }
+
+    size_t ParameterSnapshot::restore()
+    {
+        if (m_region.size() < sizeof(Header))
+        {
+            return 0;
+        }
+
+        Header header;
+        std::memcpy(&header, m_region.data(), sizeof(Header));
+        if (header.magic != magic)
+        {
+            // nothing has ever been stored, e.g. first boot after power-up
+            return 0;
+        }
+        if (header.schema_version != schema_version)
+        {
+            const fgc4::utils::Warning warning(fmt::format(
+                "Parameter snapshot version: {} not supported, expected version: {}. Snapshot ignored.\n",
+                header.schema_version, schema_version
+            ));
+            return 0;
+        }
+        if (header.payload_size > m_region.size() - sizeof(Header))
+        {
+            const fgc4::utils::Warning warning("Parameter snapshot size is corrupted. Snapshot ignored.\n");
+            return 0;
+        }
+        const auto payload = m_region.subspan(sizeof(Header), header.payload_size);
+        if (utils::fnv1aHash(std::as_bytes(payload)) != header.checksum)
+        {
+            const fgc4::utils::Warning warning("Parameter snapshot checksum incorrect. Snapshot ignored.\n");
+            return 0;
+        }
+
+        std::unordered_map<uint64_t, IParameter*> parameters;
+        for (const auto& [name, parameter_reference] : ParameterRegistry::instance().getParameters())
+        {
+            parameters.emplace(utils::fnv1aHash(name), &parameter_reference.get());
+        }
+
+        size_t restored = 0;
+        size_t offset   = 0;
+        for (uint32_t index = 0; index < header.number_entries; index++)
+        {
+            EntryHeader entry;
+            if (offset + sizeof(EntryHeader) > payload.size())
+            {
+                break;
+            }
+            std::memcpy(&entry, payload.data() + offset, sizeof(EntryHeader));
+            offset += sizeof(EntryHeader);
+            if (offset + entry.size > payload.size())
+            {
+                break;
+            }
+            const auto value  = std::as_bytes(payload.subspan(offset, entry.size));
+            offset           += entry.size;
+
+            const auto parameter = parameters.find(entry.name_hash);
+            if (parameter == parameters.end() || parameter->second->getSnapshotTypeId() != entry.type_id)
+            {
+                // Parameter removed or changed since the snapshot has been stored, needs to be set by a command
+                continue;
+            }
+            // the Parameter logs the Warning in case its value is rejected
+            if (!parameter->second->restoreSnapshotValue(value).has_value())
+            {
+                restored++;
+            }
+        }
+        return restored;
+    }
+
+    void ParameterSnapshot::invalidate() noexcept
+    {
+        if (m_region.size() >= sizeof(uint32_t))
+        {
+            std::memset(m_region.data(), 0, sizeof(uint32_t));
+        }
+    }
+}   // namespace vslib
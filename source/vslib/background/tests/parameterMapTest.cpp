@@ -8,7 +8,9 @@
 #include "json/json.hpp"
 #include "messageQueue.hpp"
 #include "mockRoot.hpp"
+#include "parameter.hpp"
 #include "parameterMap.hpp"
+#include "parameterRegistry.hpp"
 
 using namespace vslib;
 
@@ -17,6 +19,7 @@ class ParameterMapTest : public ::testing::Test
   protected:
     void SetUp() override
     {
+        ParameterRegistry::instance().clearRegistry();
     }
 
     void TearDown() override
@@ -52,6 +55,34 @@ TEST_F(ParameterMapTest, ParameterMapUploadSimpleMap)
     auto json_object = nlohmann::json::parse(message.value().begin(), message.value().end());
     EXPECT_EQ(
         json_object.dump(),
-        "[{\"version\":[0,1,0]},{\"components\":[],\"name\":\"root\",\"parameters\":[],\"type\":\"Root\"}]"
+        "[{\"type\":\"parameter_map\",\"version\":[0,1,0]},{\"components\":[],\"name\":\"root\",\"parameters\":[],\"type\":\"Root\"}]"
     );
 }
+
+//! Checks that a ParameterMap uploads the values of the requested Parameters only, in the order of the request
+TEST_F(ParameterMapTest, ParameterMapUploadValues)
+{
+    MockRoot                          root_component;
+    constexpr size_t                  queue_size = 1000;   // 1000 bytes
+    std::array<uint8_t, queue_size>   buffer{};
+    ParameterMap                      parameter_map(buffer.data(), queue_size, root_component);
+    Component                         component("type", "name", root_component);
+    Parameter<double>                 gain(component, "gain");
+    Parameter<std::array<int32_t, 3>> table(component, "table");
+
+    ASSERT_FALSE(gain.setJsonValue(1.5).has_value());
+    ASSERT_FALSE(table.setJsonValue(std::array<int32_t, 3>{1, 2, 3}).has_value());
+    component.flipBufferState();
+
+    auto read_queue
+        = fgc4::utils::createMessageQueue<fgc4::utils::MessageQueueReader<void>>((uint8_t*)buffer.data(), queue_size);
+    std::array<uint8_t, queue_size> read_buffer;
+
+    const nlohmann::json names = {"root.name.table", "root.name.unknown", "root.name.gain"};
+    ASSERT_NO_THROW(parameter_map.uploadParameterValues(names));
+
+    auto message = read_queue.read(read_buffer);
+    ASSERT_TRUE(message.has_value());
+    auto json_object = nlohmann::json::parse(message.value().begin(), message.value().end());
+    EXPECT_EQ(json_object.dump(), "{\"type\":\"parameter_values\",\"values\":[[1,2,3],null,1.5],\"version\":[0,1,0]}");
+}
@@ -5,11 +5,14 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include "chunkedTransfer.hpp"
 #include "component.hpp"
+#include "firFilter.hpp"
 #include "json/json.hpp"
 #include "messageQueue.hpp"
 #include "mockRoot.hpp"
 #include "parameter.hpp"
+#include "parameterMap.hpp"
 #include "parameterSetting.hpp"
 #include "staticJson.hpp"
 #include "typeTraits.hpp"
@@ -23,6 +26,8 @@ class ParameterSettingTest : public ::testing::Test
     {
         ParameterRegistry& parameter_registry = ParameterRegistry::instance();
         parameter_registry.clearRegistry();
+        ParameterBank::select(0);
+        ParameterBank::cancel();
     }
 
     void TearDown() override
@@ -56,6 +61,34 @@ class MockComponent : public Component
     }
 };
 
+//! Component holding a table of coefficients, validated as a whole
+class MockTableComponent : public Component
+{
+  public:
+    MockTableComponent(std::string_view name, Component& parent)
+        : Component("type", name, parent),
+          coefficients(*this, "coefficients", -10, 10)
+    {
+    }
+
+    Parameter<std::array<int32_t, 8>> coefficients;
+
+    //! Validation workflow, the sum of all coefficients needs to be even
+    std::optional<fgc4::utils::Warning> verifyParameters() override
+    {
+        int32_t sum = 0;
+        for (const auto& coefficient : coefficients.toValidate())
+        {
+            sum += coefficient;
+        }
+        if (sum % 2 != 0)
+        {
+            return fgc4::utils::Warning("Sum of coefficients must be even\n");
+        }
+        return {};
+    }
+};
+
 //! Checks that a ParameterSetting object can be constructed
 TEST_F(ParameterSettingTest, DefaultConstruction)
 {
@@ -345,6 +378,476 @@ TEST_F(ParameterSettingTest, ProcessArrayInvalidCommand)
     EXPECT_EQ(test.parameter, new_accepted_value);
 }
 
+//! Checks that commands with an offset set a slice of an array Parameter, while the Component validates the whole
+//! array
+TEST_F(ParameterSettingTest, ProcessSliceCommand)
+{
+    MockRoot                        root;
+    constexpr size_t                queue_size = 1e4;
+    std::array<uint8_t, queue_size> read_buffer{};
+    std::array<uint8_t, queue_size> write_buffer{};
+    Component                       root_component("root", "root", root);
+
+    ParameterSetting   parameter_setting(read_buffer.data(), write_buffer.data(), root);
+    MockTableComponent table("table", root_component);
+
+    nlohmann::json command
+        = {{"name", std::string(root_component.getFullName()) + ".table.coefficients"},
+           {"value", std::array<int32_t, 8>{1, 1, 2, 2, 3, 3, 4, 4}},
+           {"version", std::array<int, 2>{0, 1}}};
+    parameter_setting.processJsonCommands(command);
+    parameter_setting.validateComponents();
+    ASSERT_TRUE(table.coefficients.isValidated());
+
+    command["offset"] = 2;
+    command["value"]  = std::array<int32_t, 3>{5, 7, 9};
+    parameter_setting.processJsonCommands(command);
+    parameter_setting.validateComponents();
+    EXPECT_EQ(table.coefficients.value(), (std::array<int32_t, 8>{1, 1, 5, 7, 9, 3, 4, 4}));
+
+    // the slice on its own is valid, but the whole array is rejected by the Component
+    command["offset"] = 7;
+    command["value"]  = std::array<int32_t, 1>{5};
+    parameter_setting.processJsonCommands(command);
+    parameter_setting.validateComponents();
+    EXPECT_EQ(table.coefficients.value(), (std::array<int32_t, 8>{1, 1, 5, 7, 9, 3, 4, 4}));
+
+    command["offset"] = -1;
+    EXPECT_FALSE(parameter_setting.validateJsonCommand(command));
+}
+
+//! Checks that an array Parameter is set by a chunked transfer, with the Component validated once it has ended
+TEST_F(ParameterSettingTest, ProcessChunkedTransfer)
+{
+    MockRoot                        root;
+    constexpr size_t                queue_size = 1e4;
+    std::array<uint8_t, queue_size> read_buffer{};
+    std::array<uint8_t, queue_size> write_buffer{};
+    Component                       root_component("root", "root", root);
+
+    ParameterSetting   parameter_setting(read_buffer.data(), write_buffer.data(), root);
+    MockTableComponent table("table", root_component);
+
+    nlohmann::json command
+        = {{"name", std::string(root_component.getFullName()) + ".table.coefficients"},
+           {"value", std::array<int32_t, 8>{1, 1, 2, 2, 3, 3, 4, 4}},
+           {"version", std::array<int, 2>{0, 1}}};
+    const auto first_transfer = utils::splitIntoChunks(command, 3);
+    ASSERT_EQ(first_transfer.size(), 5);
+    // each command is received separately, followed by the validation
+    for (const auto& part : first_transfer)
+    {
+        EXPECT_FALSE(table.coefficients.isValidated());
+        parameter_setting.processJsonCommands(part);
+        parameter_setting.validateComponents();
+    }
+    ASSERT_TRUE(table.coefficients.isValidated());
+    EXPECT_EQ(table.coefficients.value(), (std::array<int32_t, 8>{1, 1, 2, 2, 3, 3, 4, 4}));
+
+    // a partially received transfer is not validated, even if the Parameter already has a valid value
+    command["value"]           = std::array<int32_t, 8>{-1, -1, -2, -2, -3, -3, -4, -4};
+    const auto second_transfer = utils::splitIntoChunks(command, 5);
+    parameter_setting.processJsonCommands(second_transfer[0]);
+    parameter_setting.processJsonCommands(second_transfer[1]);
+    parameter_setting.validateComponents();
+    EXPECT_EQ(table.coefficients.value(), (std::array<int32_t, 8>{1, 1, 2, 2, 3, 3, 4, 4}));
+
+    // commands of a transfer can also be sent in a single batch
+    parameter_setting.processJsonCommands(nlohmann::json(second_transfer));
+    parameter_setting.validateComponents();
+    EXPECT_EQ(table.coefficients.value(), (std::array<int32_t, 8>{-1, -1, -2, -2, -3, -3, -4, -4}));
+}
+
+//! Checks that incorrect chunked transfers are aborted without modifying the Parameter
+TEST_F(ParameterSettingTest, ProcessChunkedTransferInvalid)
+{
+    MockRoot                        root;
+    constexpr size_t                queue_size = fgc4::utils::constants::string_memory_pool_size;
+    std::array<uint8_t, queue_size> read_buffer{};
+    std::array<uint8_t, queue_size> write_buffer{};
+    Component                       root_component("root", "root", root);
+
+    ParameterSetting   parameter_setting(read_buffer.data(), write_buffer.data(), root);
+    MockTableComponent table("table", root_component);
+
+    auto status_queue
+        = fgc4::utils::createMessageQueue<fgc4::utils::MessageQueueReader<void>>(write_buffer.data(), queue_size);
+    std::array<uint8_t, queue_size> status_buffer{};
+
+    const auto last_status = [&]()
+    {
+        std::string status;
+        auto        message = status_queue.read(status_buffer);
+        while (message.has_value())
+        {
+            status  = std::string(message.value().begin(), message.value().end());
+            message = status_queue.read(status_buffer);
+        }
+        return status;
+    };
+
+    nlohmann::json command
+        = {{"name", std::string(root_component.getFullName()) + ".table.coefficients"},
+           {"value", std::array<int32_t, 8>{1, 1, 2, 2, 3, 3, 4, 4}},
+           {"version", std::array<int, 2>{0, 1}}};
+    parameter_setting.processJsonCommands(command);
+    parameter_setting.validateComponents();
+    ASSERT_TRUE(table.coefficients.isValidated());
+    last_status();
+
+    command["value"] = std::array<int32_t, 8>{0, 0, 0, 0, 0, 0, 0, 0};
+    auto transfer    = utils::splitIntoChunks(command, 4);
+
+    // chunk without a transfer in progress
+    parameter_setting.processJsonCommands(transfer[1]);
+    EXPECT_EQ(last_status(), "No transfer of root.root.table.coefficients in progress.\n");
+
+    // chunk out of order
+    parameter_setting.processJsonCommands(transfer[0]);
+    parameter_setting.processJsonCommands(transfer[2]);
+    EXPECT_EQ(
+        last_status(), "Chunk of root.root.table.coefficients at offset 4, expected offset: 0. Transfer aborted.\n"
+    );
+
+    // incorrect checksum
+    transfer[3]["value"] = transfer[3]["value"].get<uint64_t>() + 1;
+    for (const auto& part : transfer)
+    {
+        parameter_setting.processJsonCommands(part);
+    }
+    EXPECT_EQ(last_status(), "Transfer of root.root.table.coefficients checksum incorrect. Transfer aborted.\n");
+    // the elements staged by the aborted transfer are discarded
+    parameter_setting.validateComponents();
+    EXPECT_EQ(table.coefficients.value(), (std::array<int32_t, 8>{1, 1, 2, 2, 3, 3, 4, 4}));
+    EXPECT_TRUE(table.coefficients.isInitialized());
+
+    // the whole array needs to be announced
+    transfer[0]["value"] = 4;
+    parameter_setting.processJsonCommands(transfer[0]);
+    EXPECT_EQ(
+        last_status(),
+        "Transfer of root.root.table.coefficients needs to set all 8 elements of an array Parameter, 4 announced.\n"
+    );
+
+    transfer[0]["transfer"] = "start";
+    EXPECT_FALSE(parameter_setting.validateJsonCommand(transfer[0]));
+}
+
+//! Checks that a get command is answered with the current values of the requested Parameters
+TEST_F(ParameterSettingTest, ProcessGetCommand)
+{
+    MockRoot                        root;
+    constexpr size_t                queue_size = fgc4::utils::constants::string_memory_pool_size;
+    std::array<uint8_t, queue_size> read_buffer{};
+    std::array<uint8_t, queue_size> write_buffer{};
+    std::array<uint8_t, queue_size> map_buffer{};
+    Component                       root_component("root", "root", root);
+
+    ParameterMap           parameter_map(map_buffer.data(), queue_size, root);
+    ParameterSetting       parameter_setting(read_buffer.data(), write_buffer.data(), root, &parameter_map);
+    MockComponent<int32_t> first("type", "first", root_component);
+    MockComponent<double>  second("type", "second", root_component);
+
+    const std::string prefix = std::string(root_component.getFullName()) + '.';
+    parameter_setting.processJsonCommands(nlohmann::json{
+        {{"name", prefix + "first.parameter"}, {"value", 4}, {"version", std::array<int, 2>{0, 1}}},
+        {{"name", prefix + "second.parameter"}, {"value", 0.5}, {"version", std::array<int, 2>{0, 1}}}});
+    parameter_setting.validateComponents();
+
+    auto map_queue
+        = fgc4::utils::createMessageQueue<fgc4::utils::MessageQueueReader<void>>(map_buffer.data(), queue_size);
+    std::array<uint8_t, queue_size> map_read_buffer{};
+
+    parameter_setting.processJsonCommands(nlohmann::json{
+        {"get", {prefix + "second.parameter", prefix + "first.parameter"}}, {"version", std::array<int, 2>{0, 1}}});
+    auto message = map_queue.read(map_read_buffer);
+    ASSERT_TRUE(message.has_value());
+    const auto answer = nlohmann::json::parse(message.value().begin(), message.value().end());
+    EXPECT_EQ(answer["values"].dump(), "[0.5,4]");
+
+    // get commands need to be consistent with the interface version and list Parameter names
+    auto status_queue
+        = fgc4::utils::createMessageQueue<fgc4::utils::MessageQueueReader<void>>(write_buffer.data(), queue_size);
+    std::array<uint8_t, queue_size> status_buffer{};
+    while (status_queue.read(status_buffer).has_value())
+    {
+    }
+
+    parameter_setting.processJsonCommands(nlohmann::json{{"get", {1, 2}}, {"version", std::array<int, 2>{0, 1}}});
+    EXPECT_FALSE(map_queue.read(map_read_buffer).has_value());
+    message = status_queue.read(status_buffer);
+    ASSERT_TRUE(message.has_value());
+    EXPECT_EQ(
+        std::string(message.value().begin(), message.value().end()),
+        "Command invalid: get needs to be an array of Parameter names.\n"
+    );
+
+    parameter_setting.processJsonCommands(nlohmann::json{{"get", nlohmann::json::array()}});
+    EXPECT_FALSE(map_queue.read(map_read_buffer).has_value());
+    EXPECT_TRUE(status_queue.read(status_buffer).has_value());
+}
+
+//! Checks that a ParameterSetting answers an array of commands with a single status record
+TEST_F(ParameterSettingTest, ProcessArrayCommandStatusRecord)
+{
+    MockRoot                        root;
+    constexpr size_t                queue_size = fgc4::utils::constants::string_memory_pool_size;
+    std::array<uint8_t, queue_size> read_buffer{};
+    std::array<uint8_t, queue_size> write_buffer{};
+    Component                       root_component("root", "root", root);
+
+    ParameterSetting parameter_setting(read_buffer.data(), write_buffer.data(), root);
+
+    std::string             type = "type";
+    std::string             name = "name";
+    MockComponent<uint32_t> test(type, name, root_component);
+
+    std::array<uint8_t, queue_size> read_message_buffer;
+    auto                            read_queue = fgc4::utils::createMessageQueue<fgc4::utils::MessageQueueReader<void>>(
+        (uint8_t*)write_buffer.data(), queue_size
+    );
+
+    nlohmann::json single_command
+        = {{"name", std::string(root_component.getFullName()) + '.' + name + ".parameter"},
+           {"value", (uint32_t)1},
+           {"version", std::array<int, 2>{0, 1}}};
+    nlohmann::json multiple_commands = {single_command, single_command, single_command, single_command};
+    multiple_commands[1]["name"]     = "invalid";
+    multiple_commands[2]["value"]    = -5;
+    multiple_commands[3]["version"]  = std::array<int, 2>{99, 0};
+
+    for (uint32_t batch_sequence = 0; batch_sequence < 2; batch_sequence++)
+    {
+        ASSERT_NO_THROW(parameter_setting.processJsonCommands(multiple_commands));
+
+        auto message = read_queue.read(read_message_buffer);
+        ASSERT_TRUE(message.has_value());
+        EXPECT_FALSE(read_queue.read(read_message_buffer).has_value());   // one message per batch
+
+        const auto record = utils::CommandStatusRecord::decode(message.value());
+        ASSERT_TRUE(record.has_value());
+        EXPECT_EQ(record->batch_sequence, batch_sequence);
+        ASSERT_EQ(record->statuses.size(), 4);
+        EXPECT_EQ(
+            record->statuses[0],
+            (utils::CommandStatus{0, utils::CommandResult::success, utils::CommandStatusRecord::no_message})
+        );
+        EXPECT_EQ(record->statuses[1], (utils::CommandStatus{1, utils::CommandResult::parameter_not_found, 0}));
+        EXPECT_EQ(record->statuses[2], (utils::CommandStatus{2, utils::CommandResult::value_rejected, 1}));
+        EXPECT_EQ(record->statuses[3], (utils::CommandStatus{3, utils::CommandResult::version_mismatch, 2}));
+        ASSERT_EQ(record->messages.size(), 3);
+        EXPECT_EQ(record->messages[0], "Parameter ID: invalid not found. Command ignored.\n");
+        EXPECT_EQ(
+            record->messages[1],
+            "The provided command value: -5 is not an unsigned integer, while Parameter type is an unsigned integer.\n"
+        );
+        EXPECT_EQ(
+            record->messages[2],
+            "Inconsistent major version of the communication interface! Provided version: 99, expected version: 0.\n"
+        );
+    }
+}
+
+//! Checks that a ParameterSetting loads a bank while another one is active, switched with a single selection
+TEST_F(ParameterSettingTest, LoadBankCommand)
+{
+    if constexpr (number_banks < 2)
+    {
+        GTEST_SKIP() << "Several banks of Parameter values are required.";
+    }
+
+    MockRoot                        root;
+    constexpr size_t                queue_size = fgc4::utils::constants::string_memory_pool_size;
+    std::array<uint8_t, queue_size> read_buffer{};
+    std::array<uint8_t, queue_size> write_buffer{};
+    Component                       root_component("root", "root", root);
+
+    ParameterSetting parameter_setting(read_buffer.data(), write_buffer.data(), root);
+
+    std::string            type = "type";
+    std::string            name = "name";
+    MockComponent<int32_t> test(type, name, root_component);
+
+    std::array<uint8_t, queue_size> read_message_buffer;
+    auto                            read_queue = fgc4::utils::createMessageQueue<fgc4::utils::MessageQueueReader<void>>(
+        (uint8_t*)write_buffer.data(), queue_size
+    );
+
+    nlohmann::json command
+        = {{"name", std::string(root_component.getFullName()) + '.' + name + ".parameter"},
+           {"value", 2},
+           {"version", std::array<int, 2>{0, 1}}};
+    // the first valid value is set to all banks
+    parameter_setting.processJsonCommands(command);
+    parameter_setting.validateComponents();
+    EXPECT_EQ(parameter_setting.getLoadingBank(), 0);
+    EXPECT_EQ(test.parameter, 2);
+
+    command["bank"]  = 1;
+    command["value"] = 4;
+    parameter_setting.processJsonCommands(command);
+    parameter_setting.validateComponents();
+    EXPECT_EQ(parameter_setting.getLoadingBank(), 1);
+    EXPECT_EQ(test.parameter, 2);   // bank 0 still active
+
+    ASSERT_TRUE(ParameterBank::select(1));
+    EXPECT_EQ(test.parameter, 4);
+    ASSERT_TRUE(ParameterBank::select(0));
+    EXPECT_EQ(test.parameter, 2);
+
+    // a command without a bank loads the active bank
+    command.erase("bank");
+    command["value"] = 6;
+    parameter_setting.processJsonCommands(command);
+    parameter_setting.validateComponents();
+    EXPECT_EQ(parameter_setting.getLoadingBank(), 0);
+    EXPECT_EQ(test.parameter, 6);
+    ASSERT_TRUE(ParameterBank::select(1));
+    EXPECT_EQ(test.parameter, 4);
+    ASSERT_TRUE(ParameterBank::select(0));
+
+    // drop the text statuses of the commands so far
+    while (read_queue.read(read_message_buffer).has_value())
+    {
+    }
+
+    command["bank"] = number_banks;
+    parameter_setting.processJsonCommands(command);
+    const auto message = read_queue.read(read_message_buffer);
+    ASSERT_TRUE(message.has_value());
+    EXPECT_EQ(
+        std::string(message.value().begin(), message.value().end()),
+        fmt::format("Command invalid: bank needs to be an integer between 0 and {}.\n", number_banks - 1)
+    );
+    EXPECT_EQ(parameter_setting.getLoadingBank(), 0);
+}
+
+//! Checks that loading a bank that is not active leaves the values derived by the Components for the active bank
+//! untouched until the loaded bank is selected
+TEST_F(ParameterSettingTest, LoadBankDerivedValues)
+{
+    if constexpr (number_banks < 2)
+    {
+        GTEST_SKIP() << "Several banks of Parameter values are required.";
+    }
+
+    MockRoot                        root;
+    constexpr size_t                queue_size = fgc4::utils::constants::string_memory_pool_size;
+    std::array<uint8_t, queue_size> read_buffer{};
+    std::array<uint8_t, queue_size> write_buffer{};
+    Component                       root_component("root", "root", root);
+
+    ParameterSetting parameter_setting(read_buffer.data(), write_buffer.data(), root);
+
+    FIRFilter<1> filter("filter", root_component);
+
+    nlohmann::json command
+        = {{"name", std::string(root_component.getFullName()) + ".filter.coefficients"},
+           {"value", std::array<double, 2>{1.0, 0.0}},
+           {"version", std::array<int, 2>{0, 1}}};
+    parameter_setting.processJsonCommands(command);
+    parameter_setting.validateComponents();
+    EXPECT_EQ(filter.filter(2.0), 2.0);
+
+    // the coefficients of bank 1 double the input
+    command["bank"]  = 1;
+    command["value"] = std::array<double, 2>{2.0, 0.0};
+    parameter_setting.processJsonCommands(command);
+    parameter_setting.validateComponents();
+    EXPECT_EQ(filter.filter(2.0), 2.0);   // bank 0 still active
+
+    ASSERT_TRUE(ParameterBank::select(1));
+    EXPECT_EQ(filter.filter(2.0), 4.0);
+    ASSERT_TRUE(ParameterBank::select(0));
+    EXPECT_EQ(filter.filter(2.0), 2.0);
+}
+
+//! Checks that scheduled commands are loaded to a spare bank, starting from the active values, and committed at the
+//! activation tick
+TEST_F(ParameterSettingTest, ScheduledCommand)
+{
+    if constexpr (number_banks < 2)
+    {
+        GTEST_SKIP() << "Several banks of Parameter values are required.";
+    }
+
+    MockRoot                        root;
+    constexpr size_t                queue_size = fgc4::utils::constants::string_memory_pool_size;
+    std::array<uint8_t, queue_size> read_buffer{};
+    std::array<uint8_t, queue_size> write_buffer{};
+    Component                       root_component("root", "root", root);
+
+    ParameterSetting parameter_setting(read_buffer.data(), write_buffer.data(), root);
+
+    MockComponent<int32_t> first("type", "first", root_component);
+    MockComponent<int32_t> second("type", "second", root_component);
+
+    const std::string prefix = std::string(root_component.getFullName()) + '.';
+    nlohmann::json    first_command
+        = {{"name", prefix + "first.parameter"}, {"value", 2}, {"version", std::array<int, 2>{0, 1}}};
+    nlohmann::json second_command
+        = {{"name", prefix + "second.parameter"}, {"value", 2}, {"version", std::array<int, 2>{0, 1}}};
+    parameter_setting.processJsonCommands(nlohmann::json{first_command, second_command});
+    parameter_setting.validateComponents();
+
+    // the spare bank holds an outdated value of the second Parameter
+    second_command["bank"]  = 1;
+    second_command["value"] = 8;
+    parameter_setting.processJsonCommands(second_command);
+    parameter_setting.validateComponents();
+
+    first_command["value"]      = 4;
+    first_command["activation"] = 1000;
+    parameter_setting.processJsonCommands(first_command);
+    parameter_setting.validateComponents();
+    EXPECT_EQ(parameter_setting.getLoadingBank(), 1);
+    ASSERT_TRUE(ParameterBank::scheduled().has_value());
+    EXPECT_EQ(ParameterBank::scheduled().value(), 1);
+
+    ParameterBank::update(999);
+    EXPECT_EQ(first.parameter, 2);
+    ParameterBank::update(1000);
+    EXPECT_EQ(ParameterBank::active(), 1);
+    EXPECT_EQ(first.parameter, 4);
+    EXPECT_EQ(second.parameter, 2);
+
+    // the next scheduled command is loaded to the bank following the new active one
+    first_command["value"]      = 6;
+    first_command["activation"] = 2000;
+    parameter_setting.processJsonCommands(first_command);
+    parameter_setting.validateComponents();
+    EXPECT_EQ(parameter_setting.getLoadingBank(), 2 % number_banks);
+    ParameterBank::update(2000);
+    EXPECT_EQ(first.parameter, 6);
+    EXPECT_EQ(second.parameter, 2);
+}
+
+//! Checks that invalid activations of scheduled commands are rejected
+TEST_F(ParameterSettingTest, ScheduledCommandInvalid)
+{
+    MockRoot                        root;
+    constexpr size_t                queue_size = fgc4::utils::constants::string_memory_pool_size;
+    std::array<uint8_t, queue_size> read_buffer{};
+    std::array<uint8_t, queue_size> write_buffer{};
+    Component                       root_component("root", "root", root);
+
+    ParameterSetting parameter_setting(read_buffer.data(), write_buffer.data(), root);
+
+    nlohmann::json command
+        = {{"name", "root.root.name.parameter"},
+           {"value", 2},
+           {"version", std::array<int, 2>{0, 1}},
+           {"activation", -1}};
+    EXPECT_FALSE(parameter_setting.validateJsonCommand(command));
+
+    command["activation"] = 1000;
+    command["bank"]       = ParameterBank::active();
+    EXPECT_FALSE(parameter_setting.validateJsonCommand(command));
+
+    command.erase("bank");
+    EXPECT_EQ(parameter_setting.validateJsonCommand(command), number_banks > 1);
+}
+
 //! Checks that a ParameterSetting executes a json command correctly
 TEST_F(ParameterSettingTest, ExecuteCorrectCommand)
 {
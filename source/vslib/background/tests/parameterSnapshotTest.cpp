@@ -0,0 +1,246 @@
+//! @file
+//! @brief File with unit tests of ParameterSnapshot background-task class.
+//! @author Dominik Arominski
+
+#include <array>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include "component.hpp"
+#include "mockRoot.hpp"
+#include "parameter.hpp"
+#include "parameterRegistry.hpp"
+#include "parameterSetting.hpp"
+#include "parameterSnapshot.hpp"
+
+using namespace vslib;
+
+class ParameterSnapshotTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        ParameterRegistry::instance().clearRegistry();
+    }
+
+    void TearDown() override
+    {
+        ParameterRegistry::instance().clearRegistry();
+    }
+};
+
+namespace
+{
+    enum class Mode
+    {
+        off,
+        on,
+        standby
+    };
+
+    //! Component with Parameters of the different supported kinds of types, accepting even integers only
+    class MockComponent : public Component
+    {
+      public:
+        MockComponent(Component& parent)
+            : Component("type", "name", parent),
+              integer(*this, "integer", -100, 100),
+              floating(*this, "floating"),
+              mode(*this, "mode"),
+              array(*this, "array"),
+              text(*this, "text")
+        {
+        }
+
+        Parameter<int32_t>               integer;
+        Parameter<double>                floating;
+        Parameter<Mode>                  mode;
+        Parameter<std::array<double, 3>> array;
+        Parameter<std::string>           text;
+
+        std::optional<fgc4::utils::Warning> verifyParameters() override
+        {
+            if (integer.toValidate() % 2 != 0)
+            {
+                return fgc4::utils::Warning("Parameter value must be even\n");
+            }
+            return {};
+        }
+    };
+
+    //! Component with a Parameter of the same name as MockComponent, but a different type
+    class ChangedMockComponent : public Component
+    {
+      public:
+        ChangedMockComponent(Component& parent)
+            : Component("type", "name", parent),
+              integer(*this, "integer")
+        {
+        }
+
+        Parameter<float> integer;
+    };
+
+    //! Sets all Parameters of the component and validates them
+    void configure(MockComponent& component, ParameterSetting& parameter_setting, const int32_t integer)
+    {
+        component.integer.setJsonValue(integer);
+        component.floating.setJsonValue(2.5);
+        component.mode.setJsonValue("standby");
+        component.array.setJsonValue(std::array<double, 3>{1.0, 2.0, 3.0});
+        component.text.setJsonValue("converter");
+        parameter_setting.validateComponents();
+    }
+}
+
+//! Checks that nothing is restored from a memory region that has never held a snapshot
+TEST_F(ParameterSnapshotTest, RestoreEmptyRegion)
+{
+    MockRoot             root;
+    MockComponent        component(root);
+    std::vector<uint8_t> region(1024, 0);
+    ParameterSnapshot    snapshot(region.data(), region.size());
+    EXPECT_EQ(snapshot.restore(), 0);
+    EXPECT_FALSE(component.integer.isInitialized());
+}
+
+//! Checks that validated values are restored to new Parameters with the same names, as after a reboot
+TEST_F(ParameterSnapshotTest, SaveAndRestore)
+{
+    std::array<uint8_t, 100> read_buffer{};
+    std::array<uint8_t, 100> write_buffer{};
+    std::vector<uint8_t>     region(1024, 0);
+    {
+        MockRoot          root;
+        MockComponent     component(root);
+        ParameterSetting  parameter_setting(read_buffer.data(), write_buffer.data(), root);
+        ParameterSnapshot snapshot(region.data(), region.size());
+        configure(component, parameter_setting, 42);
+        ASSERT_TRUE(ParameterRegistry::instance().parametersValidated());
+        EXPECT_TRUE(snapshot.save());
+    }
+    ParameterRegistry::instance().clearRegistry();
+
+    MockRoot          root;
+    MockComponent     component(root);
+    ParameterSetting  parameter_setting(read_buffer.data(), write_buffer.data(), root);
+    ParameterSnapshot snapshot(region.data(), region.size());
+    EXPECT_EQ(snapshot.restore(), 5);
+    EXPECT_TRUE(ParameterRegistry::instance().parametersInitialized());
+
+    parameter_setting.validateComponents();
+    EXPECT_TRUE(ParameterRegistry::instance().parametersValidated());
+    EXPECT_EQ(component.integer, 42);
+    EXPECT_EQ(component.floating, 2.5);
+    EXPECT_EQ(component.mode.value(), Mode::standby);
+    EXPECT_EQ(component.array.value(), (std::array<double, 3>{1.0, 2.0, 3.0}));
+    EXPECT_EQ(component.text.value(), "converter");
+}
+
+//! Checks that Parameters which have not been validated are not stored in the snapshot
+TEST_F(ParameterSnapshotTest, SaveValidatedOnly)
+{
+    std::array<uint8_t, 100> read_buffer{};
+    std::array<uint8_t, 100> write_buffer{};
+    std::vector<uint8_t>     region(1024, 0);
+    {
+        MockRoot          root;
+        MockComponent     component(root);
+        ParameterSetting  parameter_setting(read_buffer.data(), write_buffer.data(), root);
+        ParameterSnapshot snapshot(region.data(), region.size());
+        configure(component, parameter_setting, 41);   // rejected by the component
+        ASSERT_FALSE(ParameterRegistry::instance().parametersValidated());
+        EXPECT_TRUE(snapshot.save());
+    }
+    ParameterRegistry::instance().clearRegistry();
+
+    MockRoot          root;
+    MockComponent     component(root);
+    ParameterSnapshot snapshot(region.data(), region.size());
+    EXPECT_EQ(snapshot.restore(), 0);
+    EXPECT_FALSE(component.integer.isInitialized());
+}
+
+//! Checks that a corrupted snapshot is not restored
+TEST_F(ParameterSnapshotTest, RestoreCorrupted)
+{
+    std::array<uint8_t, 100> read_buffer{};
+    std::array<uint8_t, 100> write_buffer{};
+    std::vector<uint8_t>     region(1024, 0);
+
+    MockRoot          root;
+    MockComponent     component(root);
+    ParameterSetting  parameter_setting(read_buffer.data(), write_buffer.data(), root);
+    ParameterSnapshot snapshot(region.data(), region.size());
+    configure(component, parameter_setting, 42);
+    ASSERT_TRUE(snapshot.save());
+
+    region[100] ^= 0x01;
+    EXPECT_EQ(snapshot.restore(), 0);
+
+    region[100] ^= 0x01;
+    EXPECT_EQ(snapshot.restore(), 5);
+
+    snapshot.invalidate();
+    EXPECT_EQ(snapshot.restore(), 0);
+}
+
+//! Checks that a snapshot which does not fit in the memory region leaves the previous one intact
+TEST_F(ParameterSnapshotTest, SaveOverflowKeepsPrevious)
+{
+    std::array<uint8_t, 100> read_buffer{};
+    std::array<uint8_t, 100> write_buffer{};
+    std::vector<uint8_t>     region(1024, 0);
+
+    MockRoot          root;
+    MockComponent     component(root);
+    ParameterSetting  parameter_setting(read_buffer.data(), write_buffer.data(), root);
+    ParameterSnapshot snapshot(region.data(), region.size());
+    configure(component, parameter_setting, 42);
+    ASSERT_TRUE(snapshot.save());
+
+    component.text.setJsonValue(std::string(region.size(), 'x'));
+    EXPECT_TRUE(parameter_setting.validateComponents());
+    EXPECT_FALSE(snapshot.save());
+    EXPECT_EQ(snapshot.restore(), 5);
+}
+
+//! Checks that a Parameter that changed type since the snapshot has been stored is not restored
+TEST_F(ParameterSnapshotTest, RestoreChangedType)
+{
+    std::array<uint8_t, 100> read_buffer{};
+    std::array<uint8_t, 100> write_buffer{};
+    std::vector<uint8_t>     region(1024, 0);
+    {
+        MockRoot          root;
+        MockComponent     component(root);
+        ParameterSetting  parameter_setting(read_buffer.data(), write_buffer.data(), root);
+        ParameterSnapshot snapshot(region.data(), region.size());
+        configure(component, parameter_setting, 42);
+        ASSERT_TRUE(snapshot.save());
+    }
+    ParameterRegistry::instance().clearRegistry();
+
+    MockRoot             root;
+    ChangedMockComponent component(root);
+    ParameterSnapshot    snapshot(region.data(), region.size());
+    EXPECT_EQ(snapshot.restore(), 0);
+    EXPECT_FALSE(component.integer.isInitialized());
+}
+
+//! Checks that a snapshot larger than the memory region is not stored
+TEST_F(ParameterSnapshotTest, SaveTooLarge)
+{
+    std::array<uint8_t, 100> read_buffer{};
+    std::array<uint8_t, 100> write_buffer{};
+    std::vector<uint8_t>     region(64, 0);
+
+    MockRoot          root;
+    MockComponent     component(root);
+    ParameterSetting  parameter_setting(read_buffer.data(), write_buffer.data(), root);
+    ParameterSnapshot snapshot(region.data(), region.size());
+    configure(component, parameter_setting, 42);
+    EXPECT_FALSE(snapshot.save());
+    EXPECT_EQ(snapshot.restore(), 0);
+}
@@ -0,0 +1,11 @@
+//! @file
+//! @brief  Benchmarks main function
+//! @author Dominik Arominski
+
+#include <gtest/gtest.h>
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,80 @@
+//! @file
+//! @brief File comparing the throughput of the validator specialised for the command schema against the generic
+//! schema validator, on a batch of commands.
+//! @author Dominik Arominski
+
+#include <array>
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <nlohmann/json-schema.hpp>
+#include <string>
+#include <vector>
+
+#include "benchmarkTimer.hpp"
+#include "jsonCommandSchema.hpp"
+#include "jsonCommandValidator.hpp"
+#include "staticJson.hpp"
+
+using namespace vslib;
+
+class CommandValidationBenchmark : public ::testing::Test
+{
+  protected:
+    static constexpr size_t batch_size = 1000;   //!< Number of commands in the benchmarked batch
+
+    //! Creates a batch of commands, as received by ParameterSetting.
+    fgc4::utils::StaticJson createBatch()
+    {
+        fgc4::utils::StaticJson batch = fgc4::utils::StaticJsonFactory::getJsonObject();
+        for (size_t index = 0; index < batch_size; index++)
+        {
+            fgc4::utils::StaticJson command = fgc4::utils::StaticJsonFactory::getJsonObject();
+            command["name"]                 = fmt::format("root.component_{}.parameter", index);
+            command["value"]                = std::array<double, 3>{1.0, 2.0, static_cast<double>(index)};
+            command["version"]              = std::array<int, 2>{0, 1};
+            batch.push_back(command);
+        }
+        return batch;
+    }
+};
+
+//! Compares the number of validations per second of both validators on a 1000-command batch
+TEST_F(CommandValidationBenchmark, ValidationsPerSecond)
+{
+    const auto batch = createBatch();
+
+    nlohmann::json_schema::json_validator generic_validator;
+    generic_validator.set_root_schema(utils::json_command_schema);
+
+    std::string error;
+    size_t      valid_commands = 0;
+    const double specialised   = utils::averageCallDuration(
+        [&](const size_t index)
+        {
+            valid_commands += utils::validateCommandSchema(batch[index], error);
+        },
+        batch_size
+    );
+    EXPECT_EQ(valid_commands, batch_size + 1);   // including the warm-up call
+
+    const double generic = utils::averageCallDuration(
+        [&](const size_t index)
+        {
+            try
+            {
+                generic_validator.validate(batch[index]);
+            }
+            catch (const std::exception&)
+            {
+                valid_commands--;
+            }
+        },
+        batch_size
+    );
+    EXPECT_EQ(valid_commands, batch_size + 1);
+
+    utils::printBenchmark("Specialised command validation", specialised, generic);
+    fmt::print(
+        "[ benchmark ] Validations per second: specialised {:.0f}, generic {:.0f}\n", 1e9 / specialised, 1e9 / generic
+    );
+}
@@ -0,0 +1,76 @@
+//! @file
+//! @brief File comparing the conversion of enumeration names received in JSON commands with the compile-time lookup
+//! against the conversion with magic_enum.
+//! @author Dominik Arominski
+
+#include <array>
+#include <gtest/gtest.h>
+#include <string>
+
+#include "benchmarkTimer.hpp"
+#include "enumLookup.hpp"
+#include "magic_enum.hpp"
+#include "staticJson.hpp"
+
+using namespace vslib;
+
+class EnumLookupBenchmark : public ::testing::Test
+{
+  protected:
+    static constexpr size_t repetitions = 100'000;   //!< Number of measured conversions
+};
+
+namespace
+{
+    enum class Command
+    {
+        off,
+        on,
+        standby,
+        blocking,
+        direct,
+        cycling,
+        idle,
+        armed,
+        running,
+        aborting,
+        to_standby,
+        slow_abort,
+        fault_off,
+        fault_stopping,
+        stopping,
+        starting
+    };
+}
+
+//! Compares the conversion of names held by JSON values, as done by Parameters setting enumeration values
+TEST_F(EnumLookupBenchmark, NameConversion)
+{
+    constexpr auto                                    names = magic_enum::enum_names<Command>();
+    std::array<fgc4::utils::StaticJson, names.size()> values;
+    for (size_t index = 0; index < names.size(); index++)
+    {
+        values[index] = std::string(names[index]);
+    }
+
+    size_t     found  = 0;
+    const auto lookup = utils::averageCallDuration(
+        [&](const size_t index)
+        {
+            const auto& value = values[index % values.size()];
+            found += utils::EnumLookup<Command>::fromName(value.get_ref<const std::string&>()).has_value();
+        },
+        repetitions
+    );
+    const auto baseline = utils::averageCallDuration(
+        [&](const size_t index)
+        {
+            const auto& value = values[index % values.size()];
+            found += magic_enum::enum_cast<Command>(std::string(value)).has_value();
+        },
+        repetitions
+    );
+    EXPECT_EQ(found, 2 * (repetitions + 1));   // including the warm-up calls
+
+    utils::printBenchmark("EnumLookup::fromName vs magic_enum::enum_cast", lookup, baseline);
+}
@@ -0,0 +1,115 @@
+//! @file
+//! @brief File comparing the update of the table-driven Finite State Machine against the map-based one.
+//! @author Dominik Arominski
+
+#include <gtest/gtest.h>
+
+#include "benchmarkTimer.hpp"
+#include "fsm.hpp"
+#include "tableFsm.hpp"
+
+class FsmBenchmark : public ::testing::Test
+{
+  protected:
+    static constexpr size_t repetitions = 1'000'000;   //!< Number of measured updates
+};
+
+namespace
+{
+    enum class Phase
+    {
+        idle,
+        ramp,
+        hold,
+        discharge
+    };
+
+    //! Machine going through its states in turn, staying for a few updates in each of them
+    class Cycle
+    {
+        using Result = ::utils::FsmTransitionResult<Phase>;
+
+      public:
+        static const ::utils::FsmTable<Phase, Cycle, 4, 2> table;
+
+        Cycle()
+        {
+            // clang-format off
+            map_fsm.addState(Phase::idle,      &Cycle::count, {&Cycle::toFault, &Cycle::toRamp});
+            map_fsm.addState(Phase::ramp,      &Cycle::count, {&Cycle::toFault, &Cycle::toHold});
+            map_fsm.addState(Phase::hold,      &Cycle::count, {&Cycle::toFault, &Cycle::toDischarge});
+            map_fsm.addState(Phase::discharge, &Cycle::count, {&Cycle::toIdle});
+            // clang-format on
+        }
+
+        void count()
+        {
+            updates++;
+        }
+
+        Result toFault()
+        {
+            return fault ? Result{Phase::discharge, ::utils::FsmCascade} : Result{};
+        }
+
+        Result toRamp()
+        {
+            return (updates % 4 == 0) ? Result{Phase::ramp} : Result{};
+        }
+
+        Result toHold()
+        {
+            return (updates % 4 == 0) ? Result{Phase::hold} : Result{};
+        }
+
+        Result toDischarge()
+        {
+            return (updates % 4 == 0) ? Result{Phase::discharge} : Result{};
+        }
+
+        Result toIdle()
+        {
+            return (updates % 4 == 0) ? Result{Phase::idle} : Result{};
+        }
+
+        size_t                                 updates{0};
+        bool                                   fault{false};
+        ::utils::TableFsm<Phase, Cycle, table> table_fsm{*this, Phase::idle};
+        ::utils::Fsm<Phase, Cycle>             map_fsm{*this, Phase::idle};
+    };
+
+    // clang-format off
+    constexpr ::utils::FsmTable<Phase, Cycle, 4, 2> Cycle::table{{
+        {Phase::idle,      &Cycle::count, {&Cycle::toFault, &Cycle::toRamp}},
+        {Phase::ramp,      &Cycle::count, {&Cycle::toFault, &Cycle::toHold}},
+        {Phase::hold,      &Cycle::count, {&Cycle::toFault, &Cycle::toDischarge}},
+        {Phase::discharge, &Cycle::count, {&Cycle::toIdle}},
+    }};
+    // clang-format on
+}
+
+//! Compares the update of the FSMs going through all of their states
+TEST_F(FsmBenchmark, Update)
+{
+    Cycle table_cycle;
+    Cycle map_cycle;
+
+    const auto table = vslib::utils::averageCallDuration(
+        [&](const size_t)
+        {
+            table_cycle.table_fsm.update();
+        },
+        repetitions
+    );
+    const auto baseline = vslib::utils::averageCallDuration(
+        [&](const size_t)
+        {
+            map_cycle.map_fsm.update();
+        },
+        repetitions
+    );
+    EXPECT_EQ(table_cycle.updates, map_cycle.updates);
+    EXPECT_EQ(table_cycle.table_fsm.getState(), map_cycle.map_fsm.getState());
+
+    vslib::utils::printBenchmark("TableFsm::update vs Fsm::update", table, baseline);
+}
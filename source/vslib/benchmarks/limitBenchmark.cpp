@@ -0,0 +1,212 @@
+//! @file
+//! @brief File comparing the execution time of the limit Components reading plain values cached from their
+//! Parameters against reading the Parameters on each call.
+//! @author Dominik Arominski
+
+#include <array>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+#include "benchmarkTimer.hpp"
+#include "limitRange.hpp"
+#include "limitRate.hpp"
+#include "mockRoot.hpp"
+
+using namespace vslib;
+
+namespace
+{
+    //! LimitRange reading its Parameters on each call, as before the thresholds were cached
+    class ParameterReadingLimitRange : public Component
+    {
+      public:
+        ParameterReadingLimitRange(std::string_view name, Component& parent)
+            : Component("LimitRange", name, parent),
+              min(*this, "lower_threshold"),
+              max(*this, "upper_threshold"),
+              dead_zone(*this, "dead_zone")
+        {
+        }
+
+        [[nodiscard]] double limit(const double input) noexcept
+        {
+            if (std::isnan(input))
+            {
+                return std::numeric_limits<double>::min();
+            }
+            if (m_dead_zone_defined && (input > dead_zone[0] && input < dead_zone[1]))
+            {
+                return (fabs(dead_zone[0] - input) > fabs(dead_zone[1] - input)) ? dead_zone[1] : dead_zone[0];
+            }
+            if (input < min)
+            {
+                return min;
+            }
+            if (input > max)
+            {
+                return max;
+            }
+            return input;
+        }
+
+        std::optional<fgc4::utils::Warning> verifyParameters() override
+        {
+            m_dead_zone_defined = (dead_zone.toValidate()[0] != dead_zone.toValidate()[1]);
+            return {};
+        }
+
+        Parameter<double>                min;
+        Parameter<double>                max;
+        Parameter<std::array<double, 2>> dead_zone;
+
+      private:
+        bool m_dead_zone_defined{false};
+    };
+
+    //! LimitRate reading its Parameter on each call, as before the rate of change was cached
+    class ParameterReadingLimitRate : public Component
+    {
+      public:
+        ParameterReadingLimitRate(std::string_view name, Component& parent)
+            : Component("LimitRate", name, parent),
+              change_rate(*this, "change_rate")
+        {
+        }
+
+        [[nodiscard]] double limit(double input, const double time_difference) noexcept
+        {
+            if (std::isnan(input))
+            {
+                return std::numeric_limits<double>::min();
+            }
+            if (time_difference == 0)
+            {
+                return std::numeric_limits<double>::max();
+            }
+            const double rate = fabs(input - m_previous_value) / time_difference;
+            if (rate > change_rate)
+            {
+                input = m_previous_value + change_rate * time_difference;
+            }
+            m_previous_value = input;
+            return input;
+        }
+
+        Parameter<double> change_rate;
+
+      private:
+        double m_previous_value{0.0};
+    };
+}
+
+class LimitBenchmark : public ::testing::Test
+{
+  protected:
+    static constexpr size_t repetitions = 1'000'000;   //!< Number of measured calls
+
+    void TearDown() override
+    {
+        ParameterRegistry::instance().clearRegistry();
+    }
+
+    //! Sets and validates the thresholds of both LimitRange implementations.
+    template<typename Limit>
+    static void setThresholds(Limit& limit)
+    {
+        ASSERT_FALSE(limit.min.setJsonValue(-10.0).has_value());
+        ASSERT_FALSE(limit.max.setJsonValue(10.0).has_value());
+        ASSERT_FALSE(limit.dead_zone.setJsonValue(std::array<double, 2>{-0.5, 0.5}).has_value());
+        ASSERT_FALSE(limit.verifyParameters().has_value());
+        limit.flipBufferState();
+        limit.synchroniseParameterBuffers();
+        limit.setParametersValidated();
+    }
+
+    //! Creates inputs covering the dead zone, the allowed range and both thresholds.
+    static std::vector<double> createInputs()
+    {
+        std::vector<double>                    inputs(repetitions);
+        std::mt19937                           generator(1234);
+        std::uniform_real_distribution<double> distribution(-12.0, 12.0);
+        for (auto& input : inputs)
+        {
+            input = distribution(generator);
+        }
+        return inputs;
+    }
+};
+
+//! Benchmarks LimitRange with cached thresholds
+TEST_F(LimitBenchmark, LimitRange)
+{
+    MockRoot                   root;
+    LimitRange<double>         limit("limit", root);
+    ParameterReadingLimitRange baseline_limit("baseline_limit", root);
+    setThresholds(limit);
+    setThresholds(baseline_limit);
+
+    const auto inputs = createInputs();
+    for (const auto& input : inputs)
+    {
+        ASSERT_EQ(limit.limit(input), baseline_limit.limit(input));
+    }
+
+    double     sink{0.0};   // keeps the compiler from optimising the calls away
+    const auto baseline = utils::averageCallDuration(
+        [&](const size_t index)
+        {
+            sink += baseline_limit.limit(inputs[index]);
+        },
+        repetitions
+    );
+    const auto duration = utils::averageCallDuration(
+        [&](const size_t index)
+        {
+            sink += limit.limit(inputs[index]);
+        },
+        repetitions
+    );
+    utils::printBenchmark("LimitRange with cached thresholds", duration, baseline);
+    EXPECT_TRUE(std::isfinite(sink));
+}
+
+//! Benchmarks LimitRate with a cached rate of change
+TEST_F(LimitBenchmark, LimitRate)
+{
+    MockRoot                  root;
+    LimitRate<double>         limit("limit", root);
+    ParameterReadingLimitRate baseline_limit("baseline_limit", root);
+    for (auto* change_rate : {&limit.change_rate, &baseline_limit.change_rate})
+    {
+        ASSERT_FALSE(change_rate->setJsonValue(5.0).has_value());
+    }
+    limit.flipBufferState();
+    baseline_limit.flipBufferState();
+
+    const auto inputs = createInputs();
+    ASSERT_EQ(limit.limit(0.0, 1.0), 0.0);   // the first call only stores the previous value
+    for (const auto& input : inputs)
+    {
+        ASSERT_EQ(limit.limit(input, 1.0), baseline_limit.limit(input, 1.0));
+    }
+
+    double     sink{0.0};   // keeps the compiler from optimising the calls away
+    const auto baseline = utils::averageCallDuration(
+        [&](const size_t index)
+        {
+            sink += baseline_limit.limit(inputs[index], 1.0);
+        },
+        repetitions
+    );
+    const auto duration = utils::averageCallDuration(
+        [&](const size_t index)
+        {
+            sink += limit.limit(inputs[index], 1.0);
+        },
+        repetitions
+    );
+    utils::printBenchmark("LimitRate with a cached rate of change", duration, baseline);
+    EXPECT_TRUE(std::isfinite(sink));
+}
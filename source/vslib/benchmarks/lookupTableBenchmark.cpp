@@ -0,0 +1,107 @@
+//! @file
+//! @brief File comparing the execution time of CompactLookupTable against LookupTable, for sequential and random
+//! access, with and without equal binning.
+//! @author Dominik Arominski
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <numbers>
+#include <random>
+#include <vector>
+
+#include "benchmarkTimer.hpp"
+#include "compactLookupTable.hpp"
+#include "lookupTable.hpp"
+#include "mockRoot.hpp"
+
+using namespace vslib;
+
+class LookupTableBenchmark : public ::testing::Test
+{
+  protected:
+    static constexpr size_t number_points = 1000;     //!< Number of points of the benchmarked tables
+    static constexpr size_t repetitions   = 200'000;   //!< Number of measured interpolations
+
+    //! Creates a sine table over one period, optionally with non-uniform binning denser around the zero-crossings.
+    std::vector<std::pair<double, double>> createTable(const bool equal_binning)
+    {
+        std::vector<std::pair<double, double>> values(number_points);
+        for (size_t index = 0; index < number_points; index++)
+        {
+            const double uniform = 2.0 * std::numbers::pi * index / (number_points - 1);
+            const double x       = equal_binning ? uniform : uniform - 0.5 * std::sin(uniform);
+            values[index]        = {x, std::sin(x)};
+        }
+        return values;
+    }
+
+    //! Creates the inputs sweeping the table monotonically or in random order.
+    std::vector<double> createInputs(const bool random_access)
+    {
+        std::vector<double>                    inputs(repetitions);
+        std::mt19937                           generator(1234);
+        std::uniform_real_distribution<double> distribution(0.0, 2.0 * std::numbers::pi);
+        for (size_t index = 0; index < repetitions; index++)
+        {
+            inputs[index] = random_access ? distribution(generator) : 2.0 * std::numbers::pi * index / repetitions;
+        }
+        return inputs;
+    }
+
+    //! Benchmarks both tables on the same inputs, checks that the results agree and prints the timings.
+    void compare(const std::string_view name, const bool equal_binning, const bool random_access)
+    {
+        MockRoot                   root;
+        LookupTable<double>        table("table", root, createTable(equal_binning), equal_binning);
+        CompactLookupTable<double> compact_table("compact_table", root, createTable(equal_binning), equal_binning);
+
+        // the interpolation error of the sine is bounded by the squared bin size over 8, which is about 5e-6
+        const auto inputs = createInputs(random_access);
+        for (const auto& input : inputs)
+        {
+            ASSERT_NEAR(compact_table.interpolate(input, random_access), std::sin(input), 1e-5);
+        }
+
+        double     sink{0.0};   // keeps the compiler from optimising the interpolations away
+        const auto baseline = utils::averageCallDuration(
+            [&](const size_t index)
+            {
+                sink += table.interpolate(inputs[index], random_access);
+            },
+            repetitions
+        );
+        const auto duration = utils::averageCallDuration(
+            [&](const size_t index)
+            {
+                sink += compact_table.interpolate(inputs[index], random_access);
+            },
+            repetitions
+        );
+        utils::printBenchmark(name, duration, baseline);
+        EXPECT_TRUE(std::isfinite(sink));
+    }
+};
+
+//! Benchmarks monotonic access of a table with non-uniform binning
+TEST_F(LookupTableBenchmark, SequentialAccess)
+{
+    compare("CompactLookupTable sequential access", false, false);
+}
+
+//! Benchmarks random access of a table with non-uniform binning
+TEST_F(LookupTableBenchmark, RandomAccess)
+{
+    compare("CompactLookupTable random access", false, true);
+}
+
+//! Benchmarks monotonic access of an equally-binned table
+TEST_F(LookupTableBenchmark, SequentialAccessEqualBinning)
+{
+    compare("CompactLookupTable sequential access, equal binning", true, false);
+}
+
+//! Benchmarks random access of an equally-binned table
+TEST_F(LookupTableBenchmark, RandomAccessEqualBinning)
+{
+    compare("CompactLookupTable random access, equal binning", true, true);
+}
@@ -0,0 +1,138 @@
+//! @file
+//! @brief File comparing the time and heap footprint of storing the names of a Component tree in the NameArena
+//! against storing them in separate strings, as Components and Parameters did before.
+//! @author Dominik Arominski
+
+#include <fmt/format.h>
+#include <functional>
+#include <gtest/gtest.h>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "benchmarkTimer.hpp"
+#include "nameArena.hpp"
+
+using namespace vslib;
+
+class NameArenaBenchmark : public ::testing::Test
+{
+  protected:
+    static constexpr size_t number_components = 64;    //!< Number of Components of the benchmarked tree
+    static constexpr size_t number_parameters = 8;     //!< Number of Parameters of each Component
+    static constexpr size_t repetitions       = 100;   //!< Number of measured tree constructions
+
+    //! Names of the Components of the tree
+    std::vector<std::string> m_components = createNames("converter_controller_", number_components);
+    //! Names of the Parameters of each Component
+    std::vector<std::string> m_parameters = createNames("parameter_", number_parameters);
+
+    static std::vector<std::string> createNames(const std::string_view prefix, const size_t count)
+    {
+        std::vector<std::string> names;
+        for (size_t index = 0; index < count; index++)
+        {
+            names.push_back(fmt::format("{}{}", prefix, index));
+        }
+        return names;
+    }
+};
+
+namespace
+{
+    //! Names held the way Components and Parameters held them before, in separate strings
+    struct StringNames
+    {
+        std::vector<std::string>   component_strings;
+        std::vector<std::string>   parameter_strings;
+        std::map<std::string, int> registry;
+    };
+
+    //! Provides the number of bytes allocated on the heap for the provided string, zero if it fits in the string
+    size_t heapBytes(const std::string& string)
+    {
+        return string.capacity() > std::string().capacity() ? string.capacity() + 1 : 0;
+    }
+}
+
+//! Compares the construction time of the names of a tree of 64 Components with 8 Parameters each, and reports the
+//! heap footprint of both layouts
+TEST_F(NameArenaBenchmark, ComponentTreeNames)
+{
+    const std::string root = "root";
+
+    StringNames strings;
+    const auto  baseline = utils::averageCallDuration(
+        [&](const size_t)
+        {
+            strings = StringNames{};
+            for (const auto& component : m_components)
+            {
+                // type, name and full name of each Component
+                strings.component_strings.emplace_back("ConverterController");
+                strings.component_strings.emplace_back(component);
+                const auto& full_name = strings.component_strings.emplace_back(root + "." + component);
+                for (const auto& parameter : m_parameters)
+                {
+                    // name of each Parameter and its full name in the registry
+                    strings.parameter_strings.emplace_back(parameter);
+                    strings.registry.emplace(full_name + "." + parameter, 0);
+                }
+            }
+        },
+        repetitions
+    );
+
+    auto&                                        arena = utils::NameArena::instance();
+    std::map<std::string_view, int, std::less<>> registry;
+    std::vector<std::string_view>                views;
+    const size_t                                 bytes_before  = arena.usedBytes();
+    const size_t                                 blocks_before = arena.blockCount();
+    const auto                                   duration      = utils::averageCallDuration(
+        [&](const size_t)
+        {
+            registry.clear();
+            views.clear();
+            const auto root_name = arena.intern(root);
+            for (const auto& component : m_components)
+            {
+                views.push_back(arena.internShared("ConverterController"));
+                const auto full_name = arena.intern(root_name, ".", component);
+                for (const auto& parameter : m_parameters)
+                {
+                    registry.emplace(arena.intern(full_name, ".", parameter), 0);
+                }
+            }
+        },
+        repetitions
+    );
+    EXPECT_EQ(registry.size(), strings.registry.size());
+
+    size_t string_bytes       = 0;
+    size_t string_allocations = 0;
+    for (const auto* container : {&strings.component_strings, &strings.parameter_strings})
+    {
+        for (const auto& string : *container)
+        {
+            string_bytes       += heapBytes(string);
+            string_allocations += heapBytes(string) > 0;
+        }
+    }
+    for (const auto& [name, value] : strings.registry)
+    {
+        string_bytes       += heapBytes(name);
+        string_allocations += heapBytes(name) > 0;
+    }
+
+    // each construction of the tree appends it to the arena, the footprint of a single tree is reported
+    const size_t arena_bytes  = (arena.usedBytes() - bytes_before) / (repetitions + 1);
+    const double arena_blocks = static_cast<double>(arena.blockCount() - blocks_before) / (repetitions + 1);
+    utils::printBenchmark("NameArena vs strings, names of a Component tree", duration, baseline);
+    fmt::print(
+        "[ benchmark ] Heap footprint of the names: arena {} bytes in {:.1f} allocations, strings {} bytes in {} "
+        "allocations\n",
+        arena_bytes, arena_blocks, string_bytes, string_allocations
+    );
+    EXPECT_LT(arena_bytes, string_bytes);
+    EXPECT_LT(arena_blocks, 10.0);
+}
@@ -0,0 +1,199 @@
+//! @file
+//! @brief File comparing the cache footprint of reading the values of many Parameters in the real-time task, with
+//! values kept in the value arena against values interleaved with the metadata of each Parameter.
+//! @author Dominik Arominski
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <memory>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "benchmarkTimer.hpp"
+#include "component.hpp"
+#include "mockRoot.hpp"
+#include "parameter.hpp"
+#include "parameterRegistry.hpp"
+
+using namespace vslib;
+
+class ParameterLayoutBenchmark : public ::testing::Test
+{
+  protected:
+    static constexpr size_t number_components = 32;    //!< Number of Components read by the interrupt
+    static constexpr size_t number_parameters = 8;     //!< Number of scalar Parameters of each Component
+    static constexpr size_t repetitions       = 500;   //!< Number of measured interrupts
+
+    void SetUp() override
+    {
+        ParameterRegistry::instance().clearRegistry();
+    }
+
+    void TearDown() override
+    {
+        ParameterRegistry::instance().clearRegistry();
+    }
+
+    //! Evicts the data of the previous interrupt from the caches, as done by the rest of the real-time task
+    void evictCaches()
+    {
+        for (size_t index = 0; index < m_eviction.size(); index += utils::BumpArena::cache_line_size)
+        {
+            m_eviction[index]++;
+        }
+    }
+
+    std::vector<uint8_t> m_eviction = std::vector<uint8_t>(8 * 1024 * 1024);   //!< Buffer larger than the caches
+};
+
+namespace
+{
+    //! Component with scalar Parameters read by the interrupt, and a Parameter only used in the background
+    class MockComponent : public Component
+    {
+      public:
+        MockComponent(Component& parent, const size_t index)
+            : Component("type", fmt::format("component_{}", index), parent),
+              gains{
+                  Parameter<double>(*this, "gain_0", -1e3, 1e3), Parameter<double>(*this, "gain_1", -1e3, 1e3),
+                  Parameter<double>(*this, "gain_2", -1e3, 1e3), Parameter<double>(*this, "gain_3", -1e3, 1e3),
+                  Parameter<double>(*this, "gain_4", -1e3, 1e3), Parameter<double>(*this, "gain_5", -1e3, 1e3),
+                  Parameter<double>(*this, "gain_6", -1e3, 1e3), Parameter<double>(*this, "gain_7", -1e3, 1e3)},
+              description(*this, "description")
+        {
+        }
+
+        std::array<Parameter<double>, 8> gains;
+        Parameter<std::string>           description;
+    };
+
+    //! Layout of a scalar Parameter before the split, with the values interleaved with the metadata
+    struct InterleavedParameter
+    {
+        virtual ~InterleavedParameter() = default;
+
+        std::string_view                   full_name;
+        std::string_view                   name;
+        Component*                         parent{nullptr};
+        std::array<double, number_buffers> value{};
+        std::array<double*, number_banks>  banks{};
+        double*                            write_buffer{nullptr};
+        double                             limit_min{0.0};
+        double                             limit_max{0.0};
+        bool                               limit_min_defined{false};
+        bool                               limit_max_defined{false};
+        bool                               initialized{false};
+        bool                               validated{false};
+
+        InterleavedParameter()
+        {
+            for (uint16_t index = 0; index < number_banks; index++)
+            {
+                banks[index] = &value[index];
+            }
+            write_buffer = &value[number_banks];
+        }
+
+        [[nodiscard]] const double& read() const noexcept
+        {
+            return *banks[ParameterBank::active()];
+        }
+    };
+
+    //! Layout of the Component above before the split
+    struct InterleavedComponent
+    {
+        std::array<std::byte, sizeof(Component)> base{};
+        std::array<InterleavedParameter, 8>      gains;
+        std::array<std::byte, 136>               description{};
+    };
+
+    //! Adds the cache lines spanned by the provided object to the set
+    template<typename T>
+    void addCacheLines(std::set<uintptr_t>& lines, const T& object)
+    {
+        const auto address = reinterpret_cast<uintptr_t>(&object);
+        for (auto line = address / utils::BumpArena::cache_line_size;
+             line <= (address + sizeof(T) - 1) / utils::BumpArena::cache_line_size; line++)
+        {
+            lines.insert(line);
+        }
+    }
+}
+
+//! Compares the number of cache lines touched and the duration of an interrupt reading 256 Parameters, starting
+//! from cold caches
+TEST_F(ParameterLayoutBenchmark, ColdReads)
+{
+    MockRoot                                    root;
+    std::vector<std::unique_ptr<MockComponent>> components;
+    for (size_t index = 0; index < number_components; index++)
+    {
+        components.push_back(std::make_unique<MockComponent>(root, index));
+    }
+    std::vector<std::unique_ptr<InterleavedComponent>> interleaved_components;
+    for (size_t index = 0; index < number_components; index++)
+    {
+        interleaved_components.push_back(std::make_unique<InterleavedComponent>());
+    }
+
+    // the interrupt reads the reference to the values held by the handle, the pointer to the active bank and the value
+    std::set<uintptr_t> lines;
+    std::set<uintptr_t> interleaved_lines;
+    for (size_t index = 0; index < number_components; index++)
+    {
+        for (size_t parameter = 0; parameter < number_parameters; parameter++)
+        {
+            const auto& handle = components[index]->gains[parameter];
+            addCacheLines(lines, handle);
+            addCacheLines(lines, handle.value());
+
+            const auto& interleaved = interleaved_components[index]->gains[parameter];
+            addCacheLines(interleaved_lines, interleaved.banks);
+            addCacheLines(interleaved_lines, interleaved.read());
+        }
+    }
+
+    double sink = 0.0;   // keeps the compiler from optimising the reads away
+    double duration{0.0};
+    double baseline{0.0};
+    for (size_t repetition = 0; repetition < repetitions; repetition++)
+    {
+        evictCaches();
+        auto start = std::chrono::steady_clock::now();
+        for (const auto& component : components)
+        {
+            for (const auto& gain : component->gains)
+            {
+                sink += gain.value();
+            }
+        }
+        duration += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+        evictCaches();
+        start = std::chrono::steady_clock::now();
+        for (const auto& component : interleaved_components)
+        {
+            for (const auto& gain : component->gains)
+            {
+                sink += gain.read();
+            }
+        }
+        baseline += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    }
+    EXPECT_EQ(sink, 0.0);
+    EXPECT_LT(lines.size(), interleaved_lines.size());
+
+    utils::printBenchmark(
+        "Parameter value arena vs interleaved values, cold interrupt", duration / repetitions, baseline / repetitions
+    );
+    fmt::print(
+        "[ benchmark ] Cache lines touched per interrupt reading {} Parameters: value arena {}, interleaved {}\n",
+        number_components * number_parameters, lines.size(), interleaved_lines.size()
+    );
+}
@@ -0,0 +1,54 @@
+//! @file
+//! @brief File comparing the execution time of the fused sine and cosine look-up against two separate look-ups.
+//! @author Dominik Arominski
+
+#include <gtest/gtest.h>
+#include <numbers>
+#include <random>
+#include <vector>
+
+#include "benchmarkTimer.hpp"
+#include "cosLookupTable.hpp"
+#include "mockRoot.hpp"
+#include "sinCosLookupTable.hpp"
+#include "sinLookupTable.hpp"
+
+using namespace vslib;
+
+//! Compares the execution time of a fused sine and cosine interpolation against two separate look-ups
+TEST(SinCosLookupTableBenchmark, FusedLookup)
+{
+    MockRoot                  root;
+    SinCosLookupTable<double> table("table", root, 1000);
+    SinLookupTable<double>    sin_table("sin_table", root, 1000);
+    CosLookupTable<double>    cos_table("cos_table", root, 1000);
+
+    constexpr size_t                       repetitions = 200'000;
+    std::vector<double>                    inputs(repetitions);
+    std::mt19937                           generator(1234);
+    std::uniform_real_distribution<double> distribution(0.0, 2.0 * std::numbers::pi);
+    for (auto& input : inputs)
+    {
+        input = distribution(generator);
+    }
+
+    volatile double sink  = 0.0;
+    const double    fused = utils::averageCallDuration(
+        [&](const size_t index)
+        {
+            const auto [sin_x, cos_x] = table(inputs[index]);
+            sink                      = sin_x + cos_x;
+        },
+        repetitions
+    );
+    const double separate = utils::averageCallDuration(
+        [&](const size_t index)
+        {
+            sink = sin_table(inputs[index]) + cos_table(inputs[index]);
+        },
+        repetitions
+    );
+
+    utils::printBenchmark("SinCosLookupTable vs SinLookupTable + CosLookupTable", fused, separate);
+    EXPECT_GT(fused, 0.0);
+}
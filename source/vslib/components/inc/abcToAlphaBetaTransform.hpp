@@ -9,9 +9,11 @@
 #include <tuple>
 
 #include "component.hpp"
+#include "typeTraits.hpp"
 
 namespace vslib
 {
+    template<fgc4::utils::Floating T = double>
     class AbcToAlphaBetaTransform : public Component
     {
       public:
@@ -30,7 +32,7 @@ namespace vslib
         //! @param f_b b-phase value of abc-frame component
         //! @param f_c c-phase value of abc-frame component
         //! @return Tuple of alpha, beta, zero orthogonal values in the stationary alpha-beta reference frame
-        [[nodiscard]] std::tuple<double, double, double>
-        transform(const double f_a, const double f_b, const double f_c) const noexcept;
+        [[nodiscard]] std::tuple<T, T, T>
+        transform(const T f_a, const T f_b, const T f_c) const noexcept;
     };
 }   // namespace vslib
\ No newline at end of file
@@ -10,9 +10,11 @@
 #include "abcToAlphaBetaTransform.hpp"
 #include "alphaBetaToDq0Transform.hpp"
 #include "component.hpp"
+#include "typeTraits.hpp"
 
 namespace vslib
 {
+    template<fgc4::utils::Floating T = double>
     class AbcToDq0Transform : public Component
     {
       public:
@@ -38,12 +40,12 @@ namespace vslib
         //! @param wt angle (in radians) between q and a
         //! @param offset Offset angle alignment (in radians): 0 is q alignment, pi/2 for d and a alignment
         //! @return Tuple of d, q, 0 values
-        [[nodiscard]] std::tuple<double, double, double> transform(
-            const double f_a, const double f_b, const double f_c, const double wt, const double offset = 0
+        [[nodiscard]] std::tuple<T, T, T> transform(
+            const T f_a, const T f_b, const T f_c, const T wt, const T offset = 0
         ) noexcept;
 
       private:
-        AbcToAlphaBetaTransform m_abc_to_alphabeta;
-        AlphaBetaToDq0Transform m_alphabeta_to_dq0;
+        AbcToAlphaBetaTransform<T> m_abc_to_alphabeta;
+        AlphaBetaToDq0Transform<T> m_alphabeta_to_dq0;
     };
 }   // namespace vslib
@@ -9,9 +9,11 @@
 #include <tuple>
 
 #include "component.hpp"
+#include "typeTraits.hpp"
 
 namespace vslib
 {
+    template<fgc4::utils::Floating T = double>
     class AlphaBetaToAbcTransform : public Component
     {
       public:
@@ -30,7 +32,7 @@ namespace vslib
         //! @param f_beta beta-component of alpha-beta-zero-frame component
         //! @param f_0 zero-component of alpha-beta-zero-frame component
         //! @return Tuple of a, b, and c values
-        [[nodiscard]] std::tuple<double, double, double>
-        transform(const double f_alpha, const double f_beta, const double f_0) const noexcept;
+        [[nodiscard]] std::tuple<T, T, T>
+        transform(const T f_alpha, const T f_beta, const T f_0) const noexcept;
     };
 }   // namespace vslib
\ No newline at end of file
@@ -9,11 +9,12 @@
 #include <tuple>
 
 #include "component.hpp"
-#include "cosLookupTable.hpp"
-#include "sinLookupTable.hpp"
+#include "sinCosLookupTable.hpp"
+#include "typeTraits.hpp"
 
 namespace vslib
 {
+    template<fgc4::utils::Floating T = double>
     class AlphaBetaToDq0Transform : public Component
     {
       public:
@@ -24,8 +25,7 @@ namespace vslib
         //! @param number_points Number of points for the sine and cosine lookup tables
         AlphaBetaToDq0Transform(std::string_view name, Component& parent, const uint64_t number_points = 1000)
             : Component("AlphaBetaToDq0Transform", name, parent),
-              m_sin("sin", *this, number_points),
-              m_cos("cos", *this, number_points)
+              m_sin_cos("sin_cos", *this, number_points)
         {
         }
 
@@ -38,12 +38,11 @@ namespace vslib
         //! @param a_alignment Whether the frame alignment at t=0 is aligned with A-axis (true) or 90 degrees behind
         //! A-axis (false)
         //! @return Tuple of d, q, 0 values
-        [[nodiscard]] std::tuple<double, double, double> transform(
-            const double f_alpha, const double f_beta, const double f_0, const double wt, const bool a_alignment = true
+        [[nodiscard]] std::tuple<T, T, T> transform(
+            const T f_alpha, const T f_beta, const T f_0, const T wt, const bool a_alignment = true
         ) noexcept;
 
       private:
-        SinLookupTable m_sin;   //!< Lookup table holding sine function
-        CosLookupTable m_cos;   //!< Lookup table holding cosine function
+        SinCosLookupTable<T> m_sin_cos;   //!< Lookup table holding both sine and cosine functions
     };
 }   // namespace vslib
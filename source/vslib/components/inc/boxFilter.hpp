@@ -15,7 +15,7 @@
 namespace vslib
 {
     template<int64_t filter_order, double maximal_filtered_value = 1e5>
-    class BoxFilter : public Filter
+    class BoxFilter : public Filter<>
     {
         constexpr static int64_t buffer_length = filter_order + 1;
 
@@ -78,7 +78,7 @@ namespace vslib
     // Benchmarking showed 126% gain for the first order, and 50% for the 2nd order.
 
     template<>
-    class BoxFilter<1> : public Filter
+    class BoxFilter<1> : public Filter<>
     {
       public:
         //! Constructor of the box filter component
@@ -114,7 +114,7 @@ namespace vslib
     };
 
     template<>
-    class BoxFilter<2> : public Filter
+    class BoxFilter<2> : public Filter<>
     {
       public:
         //! Constructor of the box filter component
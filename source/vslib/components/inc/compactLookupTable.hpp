@@ -0,0 +1,180 @@
+//! @file
+//! @brief Defines the Component class for look-up table stored as separate arrays with precomputed slopes.
+//! @author Dominik Arominski
+
+#pragma once
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "component.hpp"
+#include "typeTraits.hpp"
+
+namespace vslib
+{
+    //! Look-up table performing linear interpolation without any division at run-time. The x- and y-axis values
+    //! are stored in separate arrays, and the x-axis is not stored at all for equally-binned tables. The slope of
+    //! each section and the reciprocal of the bin width are calculated once on construction, so that each
+    //! interpolation is reduced to a section search followed by a multiply-add.
+    template<fgc4::utils::Floating IndexType, fgc4::utils::Floating StoredType = IndexType>
+    class CompactLookupTable : public Component
+    {
+      public:
+        //! Defines constructor for CompactLookupTable Component.
+        //!
+        //! @param name Name of this Component
+        //! @param parent Parent of this Component
+        //! @param values Vector with lookup table index-value pairs, with at least two elements
+        //! @param equal_binning Flag signalling whether the lookup table indexing has equal spaced binning
+        CompactLookupTable(
+            std::string_view name, Component& parent, std::vector<std::pair<IndexType, StoredType>>&& values,
+            const bool equal_binning = false
+        ) noexcept
+            : Component("CompactLookupTable", name, parent),
+              m_equal_binning{equal_binning}
+        {
+            const size_t number_points = values.size();
+            m_lower_edge_x             = values[0].first;
+            m_upper_edge_x             = values[number_points - 1].first;
+            m_bin_size                 = values[1].first - values[0].first;
+            m_reciprocal_bin_size      = IndexType(1) / m_bin_size;
+
+            m_y.reserve(number_points);
+            m_slopes.reserve(number_points - 1);
+            if (!m_equal_binning)
+            {
+                m_x.reserve(number_points);
+            }
+
+            for (size_t index = 0; index < number_points; index++)
+            {
+                m_y.push_back(values[index].second);
+                if (!m_equal_binning)
+                {
+                    m_x.push_back(values[index].first);
+                }
+                if (index + 1 < number_points)
+                {
+                    // equally-binned tables are indexed in units of bins, so their slopes are expressed per bin
+                    const IndexType width
+                        = m_equal_binning ? IndexType(1) : values[index + 1].first - values[index].first;
+                    m_slopes.push_back((values[index + 1].second - values[index].second) / width);
+                }
+            }
+        }
+
+        //! Provides an interpolated y-axis value from the stored values closest to the provided x-axis input.
+        //!
+        //! @param input_x X-axis input value
+        //! @param random_access Switch informing if the input_x is coming linearly or randomly, allows for binary
+        //! search optimisation in the latter case
+        //! @return Y-axis value result of the interpolation
+        [[nodiscard]] StoredType interpolate(const IndexType input_x, const bool random_access = false) noexcept
+        {
+            // handle interpolation saturation cases: return the function value at the edge in case of under or overflow
+            if (input_x <= m_lower_edge_x)
+            {
+                return m_y.front();
+            }
+
+            if (input_x >= m_upper_edge_x)
+            {
+                return m_y.back();
+            }
+
+            if (m_equal_binning)
+            {
+                const IndexType position = (input_x - m_lower_edge_x) * m_reciprocal_bin_size;
+                // rounding of the position can only point past the last section, never before the first one
+                const size_t index = std::min(static_cast<size_t>(position), m_slopes.size() - 1);
+                return m_y[index] + (position - static_cast<IndexType>(index)) * m_slopes[index];
+            }
+
+            const size_t index = findSection(input_x, random_access);
+            return m_y[index] + (input_x - m_x[index]) * m_slopes[index];
+        }
+
+        //! Provides random-access operator overload to the index-th element of the stored lookup table's y-axis value.
+        //!
+        //! @param index Index of the element to be returned
+        //! @return Y-axis value of the function at the index
+        [[nodiscard]] const StoredType& operator[](const size_t index) const
+        {
+            return m_y[index];
+        }
+
+        //! Returns the number of points stored in the table.
+        //!
+        //! @return Number of stored points
+        [[nodiscard]] size_t size() const noexcept
+        {
+            return m_y.size();
+        }
+
+        //! Provides a const reference to the precomputed slopes of each section.
+        //!
+        //! @return Slopes of the sections, per unit of the x-axis or per bin in the equal-binning case
+        [[nodiscard]] const auto& getSlopes() const
+        {
+            return m_slopes;
+        }
+
+        //! Resets the Component to its initial state.
+        void reset() noexcept
+        {
+            m_section_index = 0;
+        }
+
+      protected:
+        std::vector<IndexType>  m_x;        //!< X-axis values, empty in the equal-binning case
+        std::vector<StoredType> m_y;        //!< Y-axis values
+        std::vector<StoredType> m_slopes;   //!< Slope of each section between two consecutive points
+
+        size_t m_section_index{0};   //!< Index of the last found section
+
+        IndexType m_lower_edge_x;          //!< Minimum x-axis value of the stored table
+        IndexType m_upper_edge_x;          //!< Maximum x-axis value of the stored table
+        IndexType m_bin_size;              //!< Bin size in equal-binning case
+        IndexType m_reciprocal_bin_size;   //!< Inverse of the bin size, to index the table with a multiplication
+
+        bool m_equal_binning{false};   //!< Flag informing whether the stored table has equally-binned x-axis
+
+        //! Finds the section containing the input, starting from the last found section. The input needs to be
+        //! strictly within the edges of the table.
+        //!
+        //! @param input_x X-axis input value
+        //! @param random_access Flag to inform whether the lookup table is accessed in random order
+        //! @return Index of the lower edge of the section containing the input
+        [[nodiscard]] size_t findSection(const IndexType input_x, const bool random_access) noexcept
+        {
+            size_t index = m_section_index;
+            if (input_x >= m_x[index] && input_x < m_x[index + 1])   // same section
+            {
+                return index;
+            }
+
+            if (random_access)
+            {
+                // binary search is more efficient with random access
+                index = std::upper_bound(m_x.cbegin(), m_x.cend(), input_x) - m_x.cbegin() - 1;
+            }
+            else
+            {
+                // linear search is more efficient for monotonic access, as the next point is likely to be close
+                while (input_x < m_x[index])
+                {
+                    index--;
+                }
+                while (input_x >= m_x[index + 1])
+                {
+                    index++;
+                }
+            }
+            m_section_index = index;
+            return index;
+        }
+    };
+
+}   // namespace vslib
@@ -10,7 +10,9 @@
 #include <vector>
 
 #include "iparameter.hpp"
+#include "nameArena.hpp"
 #include "nonCopyableNonMovable.hpp"
+#include "parameterBank.hpp"
 #include "parameterRegistry.hpp"
 #include "parameterSerializer.hpp"
 #include "staticJson.hpp"
@@ -26,7 +28,7 @@ namespace vslib
         using ComponentRef  = std::reference_wrapper<Component>;
         using ChildrenList  = std::vector<ComponentRef>;
         using ParameterRef  = std::reference_wrapper<IParameter>;
-        using ParameterList = std::vector<std::pair<std::string, ParameterRef>>;
+        using ParameterList = std::vector<std::pair<std::string_view, ParameterRef>>;
         using StaticJson    = fgc4::utils::StaticJson;
 
         //! Creates the Component object with the provided type, name, and inside the hierarchy specified by parent.
@@ -35,11 +37,10 @@ namespace vslib
         //! @param name Name of the Component, needs to be unique in the type
         //! @param parent Possible parent of this Component, for the root Component should be nullptr
         Component(std::string_view component_type, std::string_view name, Component& parent) noexcept
-            : m_component_type(component_type),
-              m_name(name),
-              m_full_name(name)
+            : m_component_type(utils::NameArena::instance().internShared(component_type)),
+              m_full_name(utils::NameArena::instance().intern(parent.getFullName(), ".", name)),
+              m_name(m_full_name.substr(m_full_name.size() - name.size()))
         {
-            m_full_name = std::string(parent.getFullName()) + "." + std::string(m_name);
             parent.addChild(*this);
         }
 
@@ -94,9 +95,7 @@ namespace vslib
         //! @param parameter Reference to the added Parameter
         void registerParameter(IParameter& parameter)
         {
-            ParameterRegistry::instance().addToRegistry(
-                std::string(this->getFullName()) + "." + std::string(parameter.getName()), parameter
-            );
+            ParameterRegistry::instance().addToRegistry(parameter.getFullName(), parameter);
             m_parameters.emplace_back(parameter.getName(), parameter);
         }
 
@@ -132,21 +131,26 @@ namespace vslib
         // ************************************************************
         // Methods for interacting with owned Parameters
 
-        //! Flips the buffer state of all Parameters registered with this component.
-        void flipBufferState() noexcept
+        //! Flips the buffer state of all Parameters registered with this component, so that the provided bank holds
+        //! the new values.
+        //!
+        //! @param bank Index of the bank receiving the new values, the active bank by default
+        void flipBufferState(const uint16_t bank = ParameterBank::active()) noexcept
         {
             for (auto& parameter : m_parameters)
             {
-                parameter.second.get().swapBuffers();
+                parameter.second.get().swapBuffers(bank);
             }
         }
 
-        //! Synchronises buffers for all Parameters registered with this component.
-        void synchroniseParameterBuffers() noexcept
+        //! Synchronises buffers for all Parameters registered with this component with the provided bank.
+        //!
+        //! @param bank Index of the bank to synchronise with, the active bank by default
+        void synchroniseParameterBuffers(const uint16_t bank = ParameterBank::active()) noexcept
         {
             for (auto& parameter : m_parameters)
             {
-                parameter.second.get().syncWriteBuffer();
+                parameter.second.get().syncWriteBuffer(bank);
             }
         }
 
@@ -198,9 +202,10 @@ namespace vslib
         }
 
       protected:
-        std::string m_component_type;   //!< Type of this Component
-        std::string m_name;             //!< Name of this Component
-        std::string m_full_name;        //!< Full name of this component, including hierarchy
+        // names are interned in the NameArena, the name is the last part of the full name
+        std::string_view m_component_type;   //!< Type of this Component
+        std::string_view m_full_name;        //!< Full name of this component, including hierarchy
+        std::string_view m_name;             //!< Name of this Component
 
         ChildrenList  m_children{};     //!< Container with all children component registered to this component
         ParameterList m_parameters{};   //!< Container with all Parameters registered to this component
@@ -212,9 +217,9 @@ namespace vslib
         //! @param name Name of the Component, needs to be unique in the type
         //! @param parent Possible parent of this Component, for the root Component should be nullptr
         Component(std::string_view component_type, std::string_view name) noexcept
-            : m_component_type(component_type),
-              m_name(name),
-              m_full_name(name)
+            : m_component_type(utils::NameArena::instance().internShared(component_type)),
+              m_full_name(utils::NameArena::instance().intern(name)),
+              m_name(m_full_name)
         {
         }
     };
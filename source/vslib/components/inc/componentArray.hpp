@@ -5,17 +5,29 @@
 
 #pragma once
 
+#include <array>
+#include <cstddef>
 #include <memory>
+#include <new>
 #include <string>
+#include <utility>
 
 #include "component.hpp"
 #include "constants.hpp"
 
 namespace vslib
 {
+    //! Fixed-size array of Components, stored in-place in contiguous storage. The elements are constructed without
+    //! any heap allocation and are laid out one after the other, so that iterating over them in the real-time task
+    //! touches contiguous cache lines.
+    //!
+    //! @tparam ComponentType Type of the held Components
+    //! @tparam array_length Number of held Components
     template<typename ComponentType, size_t array_length>
     class ComponentArray : public Component
     {
+        static_assert(array_length > 0, "ComponentArray needs to hold at least one Component.");
+
       public:
         //! Constructor for the ComponentArray component.
         //!
@@ -27,7 +39,27 @@ namespace vslib
             : Component("ComponentArray", name, parent)
         {
             static_assert(std::derived_from<ComponentType, Component>, "ComponentType must be derived from Component");
-            createComponents<ComponentSettings...>(name, 0, settings...);   // 0-based indexing for the array
+            // 0-based indexing for the array
+            for (; m_constructed < array_length; m_constructed++)
+            {
+                try
+                {
+                    std::construct_at(
+                        data() + m_constructed, name + "[" + std::to_string(m_constructed) + "]", *this, settings...
+                    );
+                }
+                catch (...)
+                {
+                    destroyComponents();
+                    throw;
+                }
+            }
+        }
+
+        //! Destroys the held Components in the reverse order of their construction.
+        ~ComponentArray()
+        {
+            destroyComponents();
         }
 
         //! Provides seamless access to the value stored at the provided index
@@ -36,70 +68,92 @@ namespace vslib
         //! @return Reference to the Component at the specified address
         [[nodiscard]] const ComponentType& operator[](const size_t index) const
         {
-            return *m_components[index];
+            return data()[index];
         }
 
-        //! Provides an overloaded begin() to return an iterator that automatically handles access to the held
-        //! Components
-        auto begin()
+        //! Provides seamless access to the value stored at the provided index
+        //!
+        //! @param index Index of the array element to be accessed
+        //! @return Reference to the Component at the specified address
+        [[nodiscard]] ComponentType& operator[](const size_t index)
         {
-            return IteratorWrapper(m_components.begin());
+            return data()[index];
         }
 
-        // Provides overloaded end() to return an iterator that automatically handles access to the held Components
-        auto end()
+        //! Calls the provided function on each held Component in order. The calls are expanded at compile time, so
+        //! that the loop is fully unrolled.
+        //!
+        //! @param function Function taking a reference to the Component as the only argument
+        template<typename Function>
+        void forEach(Function&& function)
         {
-            return IteratorWrapper(m_components.end());
+            [&]<size_t... indices>(std::index_sequence<indices...>)
+            {
+                (function(data()[indices]), ...);
+            }(std::make_index_sequence<array_length>{});
         }
 
-      private:
-        std::array<std::unique_ptr<ComponentType>, array_length> m_components;   //!< Array of owned Components
+        //! Provides the number of held Components.
+        //!
+        //! @return Length of the array
+        [[nodiscard]] constexpr static size_t size() noexcept
+        {
+            return array_length;
+        }
 
-        template<typename... CurrentSettings>
-        void createComponents(const std::string& name_base, const size_t index, CurrentSettings... settings)
+        //! Provides the pointer to the first held Component, the others follow contiguously.
+        //!
+        //! @return Pointer to the first Component
+        [[nodiscard]] ComponentType* data() noexcept
         {
-            // Create and initialize the current component
-            m_components[index]
-                = std::make_unique<ComponentType>(name_base + "[" + std::to_string(index) + "]", *this, settings...);
-            // Recursively create the rest of the components
-            if (array_length > (index + 1))
-            {
-                createComponents<CurrentSettings...>(name_base, index + 1, settings...);
-            }
+            return std::launder(reinterpret_cast<ComponentType*>(m_storage.data()));
         }
 
-        // ************************************************************
-        //! Helper class for wrapping dereferencing of the pointers stored in the std::array
+        //! Provides the pointer to the first held Component, the others follow contiguously.
+        //!
+        //! @return Pointer to the first Component
+        [[nodiscard]] const ComponentType* data() const noexcept
+        {
+            return std::launder(reinterpret_cast<const ComponentType*>(m_storage.data()));
+        }
 
-        class IteratorWrapper
+        //! Provides begin() iterator over the held Components
+        ComponentType* begin() noexcept
         {
-          public:
-            explicit IteratorWrapper(typename std::array<std::unique_ptr<ComponentType>, array_length>::iterator iter)
-                : m_iter(iter)
-            {
-            }
+            return data();
+        }
 
-            // Overload operator* to automatically dereference the pointer to the component.
-            ComponentType& operator*()
-            {
-                return *(*m_iter);
-            }
+        //! Provides end() iterator over the held Components
+        ComponentType* end() noexcept
+        {
+            return data() + array_length;
+        }
 
-            // Forward other iterator operations to the wrapped iterator.
-            IteratorWrapper& operator++()
-            {
-                ++m_iter;
-                return *this;
-            }
+        //! Provides begin() iterator over the held Components
+        const ComponentType* begin() const noexcept
+        {
+            return data();
+        }
+
+        //! Provides end() iterator over the held Components
+        const ComponentType* end() const noexcept
+        {
+            return data() + array_length;
+        }
 
-            bool operator!=(const IteratorWrapper& other) const
+      private:
+        //! Storage of the held Components, constructed in-place
+        alignas(ComponentType) std::array<std::byte, sizeof(ComponentType) * array_length> m_storage;
+        size_t m_constructed{0};   //!< Number of Components constructed so far
+
+        //! Destroys the constructed Components in the reverse order of their construction.
+        void destroyComponents() noexcept
+        {
+            while (m_constructed > 0)
             {
-                return m_iter != other.m_iter;
+                std::destroy_at(data() + --m_constructed);
             }
-
-          private:
-            typename std::array<std::unique_ptr<ComponentType>, array_length>::iterator m_iter;
-        };
+        }
     };
 
 }   // namespace vslib
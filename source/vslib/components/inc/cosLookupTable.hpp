@@ -11,9 +11,11 @@
 #include "component.hpp"
 #include "functionGenerator.hpp"
 #include "periodicLookupTable.hpp"
+#include "typeTraits.hpp"
 
 namespace vslib
 {
+    template<fgc4::utils::Floating T = double>
     class CosLookupTable : public Component
     {
       public:
@@ -26,7 +28,15 @@ namespace vslib
             : Component("CosLookupTable", name, parent),
               m_function(
                   "data", *this,
-                  fgc4::utils::generateFunction<double, double>(cos, 0.0, 2.0 * std::numbers::pi, number_points), true
+                  fgc4::utils::generateFunction<T, T>(
+                      [](const T x)
+                      {
+                          // the table is always evaluated in double precision and only then rounded to T
+                          return static_cast<T>(cos(static_cast<double>(x)));
+                      },
+                      T{0}, std::numbers::pi_v<T> * 2, number_points
+                  ),
+                  true
               )
         {
             assert(number_points >= 2);
@@ -36,7 +46,7 @@ namespace vslib
         //!
         //! @param input_x Value to be looked up in the table
         //! @return Interpolated function value closest to the input_x
-        [[nodiscard]] auto interpolate(const double input_x)
+        [[nodiscard]] auto interpolate(const T input_x)
         {
             return m_function.interpolate(input_x);
         }
@@ -45,13 +55,13 @@ namespace vslib
         //!
         //! @param input_x Value to be looked up in the table
         //! @return Interpolated function value closest to the input_x
-        [[nodiscard]] auto operator()(const double input_x)
+        [[nodiscard]] auto operator()(const T input_x)
         {
             return m_function.interpolate(input_x);
         }
 
       private:
         //!< Table holding the cosine function and providing interpolation functionality
-        PeriodicLookupTable<double, double> m_function;
+        PeriodicLookupTable<T, T> m_function;
     };
 }   // namespace vslib
\ No newline at end of file
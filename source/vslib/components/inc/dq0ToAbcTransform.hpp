@@ -10,9 +10,11 @@
 #include "alphaBetaToAbcTransform.hpp"
 #include "component.hpp"
 #include "dq0ToAlphaBetaTransform.hpp"
+#include "typeTraits.hpp"
 
 namespace vslib
 {
+    template<fgc4::utils::Floating T = double>
     class Dq0ToAbcTransform : public Component
     {
       public:
@@ -37,11 +39,11 @@ namespace vslib
         //! @param wt angle (in radians) between q and a
         //! @param offset Offset angle alignment (in radians): 0 is q alignment, pi/2 for d and a alignment
         //! @return Tuple of a, b, c values
-        [[nodiscard]] std::tuple<double, double, double>
-        transform(const double d, const double q, const double zero, const double wt, const double offset = 0) noexcept;
+        [[nodiscard]] std::tuple<T, T, T>
+        transform(const T d, const T q, const T zero, const T wt, const T offset = 0) noexcept;
 
       private:
-        Dq0ToAlphaBetaTransform m_dq0_to_alphabeta;   //!< First stage of transformation
-        AlphaBetaToAbcTransform m_alphabeta_to_abc;   //!< Second stage of transformation
+        Dq0ToAlphaBetaTransform<T> m_dq0_to_alphabeta;   //!< First stage of transformation
+        AlphaBetaToAbcTransform<T> m_alphabeta_to_abc;   //!< Second stage of transformation
     };
 }   // namespace vslib
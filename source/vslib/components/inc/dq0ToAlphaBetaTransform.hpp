@@ -8,11 +8,12 @@
 #include <tuple>
 
 #include "component.hpp"
-#include "cosLookupTable.hpp"
-#include "sinLookupTable.hpp"
+#include "sinCosLookupTable.hpp"
+#include "typeTraits.hpp"
 
 namespace vslib
 {
+    template<fgc4::utils::Floating T = double>
     class Dq0ToAlphaBetaTransform : public Component
     {
       public:
@@ -23,8 +24,7 @@ namespace vslib
         //! @param number_points Number of points for the sine and cosine lookup tables
         Dq0ToAlphaBetaTransform(std::string_view name, Component& parent, const uint64_t number_points = 10'000)
             : Component("Dq0ToAlphaBetaTransform", name, parent),
-              m_sin("sin", *this, number_points),
-              m_cos("cos", *this, number_points)
+              m_sin_cos("sin_cos", *this, number_points)
         {
         }
 
@@ -39,12 +39,11 @@ namespace vslib
         //! @param a_alignment Whether the frame alignment at t=0 is aligned with A-axis (true) or 90 degrees behind
         //! A-axis (false)
         //! @return Tuple of alpha, beta, zero values
-        [[nodiscard]] std::tuple<double, double, double> transform(
-            const double d, const double q, const double zero, const double theta, const bool a_alignment = true
+        [[nodiscard]] std::tuple<T, T, T> transform(
+            const T d, const T q, const T zero, const T theta, const bool a_alignment = true
         ) noexcept;
 
       private:
-        SinLookupTable m_sin;   //!< Lookup table holding sine function
-        CosLookupTable m_cos;   //!< Lookup table holding cosine function
+        SinCosLookupTable<T> m_sin_cos;   //!< Lookup table holding both sine and cosine functions
     };
 }   // namespace vslib
\ No newline at end of file
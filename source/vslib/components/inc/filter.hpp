@@ -7,9 +7,11 @@
 #include <string>
 
 #include "component.hpp"
+#include "typeTraits.hpp"
 
 namespace vslib
 {
+    template<fgc4::utils::Floating T = double>
     class Filter : public Component
     {
       public:
@@ -28,6 +30,6 @@ namespace vslib
         //! Method to implement filtering of the provided input.
         //!
         //! @param input Value to be filtered
-        virtual double filter(const double input) = 0;
+        virtual T filter(const T input) = 0;
     };
 }   // namespace vslib
\ No newline at end of file
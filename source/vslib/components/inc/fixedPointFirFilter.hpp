@@ -0,0 +1,174 @@
+//! @file
+//! @brief Defines class for a finite-impulse filter operating on fixed-point data.
+//! @author Dominik Arominski
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <string>
+
+#include "bankedValue.hpp"
+#include "component.hpp"
+#include "fixedPointType.hpp"
+#include "parameter.hpp"
+
+namespace vslib
+{
+    //! Finite-impulse filter implemented with integer arithmetic only. Coefficients are stored in Q-format with
+    //! coefficient_fractional_bits fractional bits and the data in Q-format with data_fractional_bits fractional bits,
+    //! both held by T. Products are accumulated in a saturating 64-bit accumulator and the output is rounded and
+    //! saturated back to the data format, so the filter never wraps around.
+    template<
+        int64_t filter_order, int16_t coefficient_fractional_bits = 30, int16_t data_fractional_bits = 0,
+        fgc4::utils::Integral T = int32_t>
+    class FixedPointFIRFilter : public Component
+    {
+        constexpr static int64_t buffer_length = filter_order + 1;
+        constexpr static int16_t type_width    = sizeof(T) * 8;
+
+      public:
+        using DataType = FixedPoint<data_fractional_bits, T>;   //!< Type of the filtered data
+
+        //! Constructor of the fixed-point FIR filter component, initializing one Parameter: coefficients.
+        //!
+        //! @param name Name of this Filter Component
+        //! @param parent Parent of this Filter Component
+        FixedPointFIRFilter(std::string_view name, Component& parent)
+            : Component("FixedPointFIRFilter", name, parent),
+              coefficients(*this, "coefficients")
+        {
+            static_assert(filter_order >= 1, "Filter order needs to be a positive number larger than zero.");
+            static_assert(
+                coefficient_fractional_bits > 0 && coefficient_fractional_bits < type_width,
+                "Coefficients need at least one fractional bit and the sign bit."
+            );
+        }
+
+        //! Filters the provided input by convolving coefficients and the input, including previous inputs.
+        //!
+        //! @param input Input value to be filtered, raw ADC codes can be provided with DataType::fromRaw
+        //! @return Filtered value, saturated to the range of the data type
+        [[nodiscard]] DataType filter(const DataType input) noexcept
+        {
+            m_buffer[m_head] = input.value();
+
+            const auto& taps = m_quantisation.value().coefficients;   // coefficients of the active bank
+            int64_t     accumulator{0};
+            for (int64_t index = 0; index < buffer_length; index++)
+            {
+                int64_t buffer_index = (m_head - index);
+                if (buffer_index < 0)
+                {
+                    buffer_index += buffer_length;
+                }
+                accumulator = utils::multiplyAccumulate(accumulator, m_buffer[buffer_index], taps[index]);
+            }
+
+            m_head++;
+            if (m_head >= buffer_length)
+            {
+                m_head -= buffer_length;
+            }
+
+            return DataType::fromRaw(utils::narrow<T>(accumulator, coefficient_fractional_bits));
+        }
+
+        //! Filters the provided input array by convolving coefficients and the input.
+        //!
+        //! @param inputs Input values to be filtered
+        //! @return Filtered values
+        template<size_t N>
+        [[nodiscard]] std::array<DataType, N> filter(const std::array<DataType, N>& inputs) noexcept
+        {
+            std::array<DataType, N> outputs;
+            std::transform(
+                inputs.cbegin(), inputs.cend(), outputs.begin(),
+                [&](const auto& input)
+                {
+                    return filter(input);
+                }
+            );
+            return outputs;
+        }
+
+        // ************************************************************
+        // Getters
+
+        //! Returns the number of spare bits of the accumulator for a full-scale input, found during the last
+        //! successful verification of the coefficients.
+        //!
+        //! @return Accumulator headroom in bits
+        [[nodiscard]] int16_t getAccumulatorHeadroom() const noexcept
+        {
+            return m_quantisation.value().accumulator_headroom;
+        }
+
+        //! Returns the number of spare bits of the output for a full-scale input. Negative value means that the
+        //! gain of the filter can saturate the output for inputs larger than the full-scale divided by 2 to the power
+        //! of the returned number of bits.
+        //!
+        //! @return Output headroom in bits
+        [[nodiscard]] int16_t getOutputHeadroom() const noexcept
+        {
+            return m_quantisation.value().output_headroom;
+        }
+
+        Parameter<std::array<double, buffer_length>> coefficients;   //!< Array of coefficients of this Filter
+
+        //! Quantises the coefficients into the Q-format of this filter and analyses the headroom of the accumulator
+        //! and of the output for a full-scale input, for the bank being loaded.
+        //!
+        //! @return Optionally returns a Warning if a coefficient cannot be represented or the accumulator can overflow
+        std::optional<fgc4::utils::Warning> verifyParameters() override
+        {
+            std::array<T, buffer_length> quantised_coefficients;
+            double                       sum_absolute{0.0};   // in units of the coefficient LSB
+            for (int64_t index = 0; index < buffer_length; index++)
+            {
+                const double coefficient = coefficients.toValidate()[index];
+                const auto   maybe_value = utils::quantise<coefficient_fractional_bits, T>(coefficient);
+                if (!maybe_value.has_value())
+                {
+                    return fgc4::utils::Warning(fmt::format(
+                        "{}: coefficient {} ({}) cannot be represented with {} fractional bits.\n", m_name, index,
+                        coefficient, coefficient_fractional_bits
+                    ));
+                }
+                quantised_coefficients[index] = maybe_value.value();
+                sum_absolute                  += std::abs(static_cast<double>(maybe_value.value()));
+            }
+
+            const double full_scale           = std::ldexp(1.0, type_width - 1);
+            const auto   accumulator_headroom = utils::headroomBits(sum_absolute * full_scale, 64);
+            if (accumulator_headroom < 0)
+            {
+                return fgc4::utils::Warning(fmt::format(
+                    "{}: accumulator can saturate by {} bits for a full-scale input, reduce the number of fractional "
+                    "bits of the coefficients.\n",
+                    m_name, -accumulator_headroom
+                ));
+            }
+
+            m_quantisation.set(
+                {quantised_coefficients, accumulator_headroom,
+                 utils::headroomBits(std::ldexp(sum_absolute, -coefficient_fractional_bits) * full_scale, type_width)}
+            );
+            return {};
+        }
+
+      private:
+        //! Coefficients quantised from the Parameter, with the headroom they leave for a full-scale input
+        struct Quantisation
+        {
+            std::array<T, buffer_length> coefficients{0};           //!< Quantised coefficients
+            int16_t                      accumulator_headroom{0};   //!< Spare bits of the accumulator
+            int16_t                      output_headroom{0};        //!< Spare bits of the output
+        };
+
+        BankedValue<Quantisation>    m_quantisation{};   //!< Quantised coefficients, per bank
+        std::array<T, buffer_length> m_buffer{0};        //!< History of previous inputs
+        int64_t                      m_head{0};          //!< Points to where the newest entry to history is
+    };
+}   // namespace vslib
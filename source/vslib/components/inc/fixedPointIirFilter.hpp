@@ -0,0 +1,232 @@
+//! @file
+//! @brief Defines class for an infinite-impulse filter operating on fixed-point data.
+//! @author Dominik Arominski
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <string>
+
+#include "bankedValue.hpp"
+#include "component.hpp"
+#include "fixedPointType.hpp"
+#include "parameter.hpp"
+
+namespace vslib
+{
+    //! Infinite-impulse filter implemented with integer arithmetic only. Coefficients are stored in Q-format with
+    //! coefficient_fractional_bits fractional bits and the data in Q-format with data_fractional_bits fractional bits,
+    //! both held by T. Products are accumulated in a saturating 64-bit accumulator and the output is rounded and
+    //! saturated back to the data format. As in the IIRFilter, the first denominator coefficient is assumed to be 1.
+    template<
+        int64_t filter_order, int16_t coefficient_fractional_bits = 28, int16_t data_fractional_bits = 0,
+        fgc4::utils::Integral T = int32_t>
+    class FixedPointIIRFilter : public Component
+    {
+        constexpr static int64_t buffer_length = filter_order + 1;
+        constexpr static int16_t type_width    = sizeof(T) * 8;
+        //! Maximal length of the impulse response used to estimate the gain of the filter
+        constexpr static int64_t impulse_response_length = 10'000;
+
+      public:
+        using DataType = FixedPoint<data_fractional_bits, T>;   //!< Type of the filtered data
+
+        //! Constructor of the fixed-point IIR filter Component, initializing two Parameters: numerator and
+        //! denominator coefficient arrays.
+        //!
+        //! @param name Name of this Filter Component
+        //! @param parent Parent of this Filter Component
+        FixedPointIIRFilter(std::string_view name, Component& parent)
+            : Component("FixedPointIIRFilter", name, parent),
+              numerator(*this, "numerator_coefficients"),
+              denominator(*this, "denominator_coefficients")
+        {
+            static_assert(filter_order >= 1, "Filter order needs to be a positive number larger than zero.");
+            static_assert(
+                coefficient_fractional_bits > 0 && coefficient_fractional_bits < type_width,
+                "Coefficients need at least one fractional bit and the sign bit."
+            );
+        }
+
+        //! Filters the provided input by convolving coefficients and the input, including previous inputs
+        //! and previously filtered values.
+        //!
+        //! @param input Input value to be filtered, raw ADC codes can be provided with DataType::fromRaw
+        //! @return Filtered value, saturated to the range of the data type
+        [[nodiscard]] DataType filter(const DataType input) noexcept
+        {
+            m_inputs_buffer[m_head] = input.value();
+
+            const auto& quantisation = m_quantisation.value();   // coefficients of the active bank
+            const auto& b            = quantisation.numerator;
+            const auto& a            = quantisation.denominator;
+            int64_t     accumulator  = utils::multiplyAccumulate(int64_t{0}, m_inputs_buffer[m_head], b[0]);
+            for (int64_t index = 1; index < buffer_length; index++)
+            {
+                int64_t buffer_index = (m_head - index);
+                if (buffer_index < 0)
+                {
+                    buffer_index += buffer_length;
+                }
+                accumulator = utils::multiplyAccumulate(accumulator, m_inputs_buffer[buffer_index], b[index]);
+                // denominator is stored negated, so that the feedback is accumulated as well
+                accumulator = utils::multiplyAccumulate(accumulator, m_outputs_buffer[buffer_index], a[index]);
+            }
+
+            const T output           = utils::narrow<T>(accumulator, coefficient_fractional_bits);
+            m_outputs_buffer[m_head] = output;
+
+            m_head++;
+            if (m_head >= buffer_length)
+            {
+                m_head -= buffer_length;
+            }
+
+            return DataType::fromRaw(output);
+        }
+
+        //! Filters the provided input array by filtering each element of the input.
+        //!
+        //! @param inputs Array with input values to be filtered
+        //! @return Array with the filtered values
+        template<size_t N>
+        [[nodiscard]] std::array<DataType, N> filter(const std::array<DataType, N>& inputs) noexcept
+        {
+            std::array<DataType, N> outputs;
+            std::transform(
+                inputs.cbegin(), inputs.cend(), outputs.begin(),
+                [&](const auto& input)
+                {
+                    return filter(input);
+                }
+            );
+
+            return outputs;
+        }
+
+        // ************************************************************
+        // Getters
+
+        //! Returns the number of spare bits of the accumulator for a full-scale input and output, found during the
+        //! last successful verification of the coefficients.
+        //!
+        //! @return Accumulator headroom in bits
+        [[nodiscard]] int16_t getAccumulatorHeadroom() const noexcept
+        {
+            return m_quantisation.value().accumulator_headroom;
+        }
+
+        //! Returns the number of spare bits of the output for a full-scale input, estimated from the sum of absolute
+        //! values of the impulse response. Negative value means that the gain of the filter can saturate the output.
+        //!
+        //! @return Output headroom in bits
+        [[nodiscard]] int16_t getOutputHeadroom() const noexcept
+        {
+            return m_quantisation.value().output_headroom;
+        }
+
+        Parameter<std::array<double, buffer_length>> numerator;     //!< Coefficients applied to inputs
+        Parameter<std::array<double, buffer_length>> denominator;   //!< Coefficients applied to outputs
+
+        //! Quantises the coefficients into the Q-format of this filter and analyses the headroom of the accumulator
+        //! and of the output for a full-scale input, for the bank being loaded.
+        //!
+        //! @return Optionally returns a Warning if a coefficient cannot be represented or the accumulator can overflow
+        std::optional<fgc4::utils::Warning> verifyParameters() override
+        {
+            Quantisation quantisation{};
+            double       sum_absolute{0.0};   // in units of the coefficient LSB
+            for (int64_t index = 0; index < buffer_length; index++)
+            {
+                const auto maybe_numerator
+                    = utils::quantise<coefficient_fractional_bits, T>(numerator.toValidate()[index]);
+                // the first denominator coefficient is never used
+                const auto maybe_denominator
+                    = (index == 0) ? std::optional<T>{0}
+                                   : utils::quantise<coefficient_fractional_bits, T>(-denominator.toValidate()[index]);
+                if (!maybe_numerator.has_value() || !maybe_denominator.has_value())
+                {
+                    return fgc4::utils::Warning(fmt::format(
+                        "{}: coefficients at index {} cannot be represented with {} fractional bits.\n", m_name, index,
+                        coefficient_fractional_bits
+                    ));
+                }
+                quantisation.numerator[index]   = maybe_numerator.value();
+                quantisation.denominator[index] = maybe_denominator.value();
+                sum_absolute += std::abs(static_cast<double>(maybe_numerator.value()))
+                                + std::abs(static_cast<double>(maybe_denominator.value()));
+            }
+
+            const double full_scale           = std::ldexp(1.0, type_width - 1);
+            const auto   accumulator_headroom = utils::headroomBits(sum_absolute * full_scale, 64);
+            if (accumulator_headroom < 0)
+            {
+                return fgc4::utils::Warning(fmt::format(
+                    "{}: accumulator can saturate by {} bits for a full-scale input, reduce the number of fractional "
+                    "bits of the coefficients.\n",
+                    m_name, -accumulator_headroom
+                ));
+            }
+
+            quantisation.accumulator_headroom = accumulator_headroom;
+            quantisation.output_headroom
+                = utils::headroomBits(impulseResponseGain(quantisation) * full_scale, type_width);
+            m_quantisation.set(quantisation);
+            return {};
+        }
+
+      private:
+        //! Coefficients quantised from the Parameters, with the headroom they leave for a full-scale input
+        struct Quantisation
+        {
+            std::array<T, buffer_length> numerator{0};              //!< Quantised coefficients applied to inputs
+            std::array<T, buffer_length> denominator{0};            //!< Quantised and negated output coefficients
+            int16_t                      accumulator_headroom{0};   //!< Spare bits of the accumulator
+            int16_t                      output_headroom{0};        //!< Spare bits of the output
+        };
+
+        BankedValue<Quantisation>    m_quantisation{};      //!< Quantised coefficients, per bank
+        std::array<T, buffer_length> m_inputs_buffer{0};    //!< History of the provided inputs
+        std::array<T, buffer_length> m_outputs_buffer{0};   //!< History of the outputs
+        int64_t                      m_head{0};   //!< Points to where is the current head of the history buffers
+
+        //! Estimates the worst-case gain of the quantised filter as the sum of absolute values of its impulse
+        //! response, which is calculated in floating point until it decays or its maximal length is reached.
+        //!
+        //! @param quantisation Quantised coefficients of the filter
+        //! @return Sum of absolute values of the impulse response
+        [[nodiscard]] static double impulseResponseGain(const Quantisation& quantisation) noexcept
+        {
+            std::array<double, buffer_length> outputs{0};
+            double                            gain{0.0};
+            for (int64_t sample = 0; sample < impulse_response_length; sample++)
+            {
+                double output = (sample < buffer_length)
+                                    ? std::ldexp(quantisation.numerator[sample], -coefficient_fractional_bits)
+                                    : 0.0;
+                for (int64_t index = 1; index < buffer_length && index <= sample; index++)
+                {
+                    output += std::ldexp(quantisation.denominator[index], -coefficient_fractional_bits)
+                              * outputs[(sample - index) % buffer_length];
+                }
+                outputs[sample % buffer_length] = output;
+                gain                            += std::abs(output);
+
+                if (sample >= buffer_length
+                    && std::all_of(
+                        outputs.cbegin(), outputs.cend(),
+                        [](const auto& value)
+                        {
+                            return std::abs(value) < 1e-12;
+                        }
+                    ))
+                {
+                    break;
+                }
+            }
+            return gain;
+        }
+    };
+}   // namespace vslib
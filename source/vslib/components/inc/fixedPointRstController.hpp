@@ -0,0 +1,271 @@
+//! @file
+//! @brief Class defining the integer-arithmetic algorithm behind the two-degrees-of-freedom RST controller.
+//! @author Dominik Arominski
+
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "bankedValue.hpp"
+#include "fixedPointType.hpp"
+#include "warningMessage.hpp"
+
+namespace vslib
+{
+    //! RST controller implemented with integer arithmetic only. The R, S, and T polynomials are normalised by the first
+    //! element of S and stored in Q-format with coefficient_fractional_bits fractional bits, while the references,
+    //! measurements and actuations are stored in Q-format with data_fractional_bits fractional bits, both held by T.
+    //! Products are accumulated in a saturating 64-bit accumulator.
+    template<
+        int64_t buffer_length, int16_t coefficient_fractional_bits = 24, int16_t data_fractional_bits = 0,
+        fgc4::utils::Integral T = int32_t>
+    class FixedPointRSTController
+    {
+        constexpr static int16_t type_width = sizeof(T) * 8;
+
+      public:
+        using DataType = FixedPoint<data_fractional_bits, T>;   //!< Type of the references, measurements and actuations
+
+        //! Default constructor for FixedPointRSTController class.
+        explicit FixedPointRSTController(std::string_view name)
+            : m_name(name)
+        {
+            static_assert(
+                coefficient_fractional_bits > 0 && coefficient_fractional_bits < type_width,
+                "Coefficients need at least one fractional bit and the sign bit."
+            );
+        }
+
+        //! Updates histories of measurements and references and moves the head of the history buffer.
+        //!
+        //! @param reference Current value of the set-point reference
+        //! @param measurement Current value of the process value
+        void updateInputHistories(const DataType reference, const DataType measurement) noexcept
+        {
+            m_references[m_head]   = reference.value();
+            m_measurements[m_head] = measurement.value();
+            m_head++;
+            if (m_head == (buffer_length - 1))
+            {
+                m_history_ready = true;
+            }
+        }
+
+        //! Calculates one iteration of the controller algorithm.
+        //!
+        //! @param reference Reference value for the controller
+        //! @param measurement Current process value (measurement)
+        //! @return Controller output of the iteration, saturated to the range of the data type
+        [[nodiscard]] DataType control(const DataType reference, const DataType measurement) noexcept
+        {
+            m_references[m_head]   = reference.value();
+            m_measurements[m_head] = measurement.value();
+
+            // r and s coefficients are stored negated, and all of them are already divided by s[0]
+            const auto& polynomials = m_polynomials.value();
+            const auto& r           = polynomials.r;
+            const auto& s           = polynomials.s;
+            const auto& t           = polynomials.t;
+            int64_t     accumulator = utils::multiplyAccumulate(int64_t{0}, m_references[m_head], t[0]);
+            accumulator             = utils::multiplyAccumulate(accumulator, m_measurements[m_head], r[0]);
+            for (int64_t index = 1; index < buffer_length; index++)
+            {
+                int64_t buffer_index = (m_head - index);
+                if (buffer_index < 0)
+                {
+                    buffer_index += buffer_length;
+                }
+                accumulator = utils::multiplyAccumulate(accumulator, m_references[buffer_index], t[index]);
+                accumulator = utils::multiplyAccumulate(accumulator, m_measurements[buffer_index], r[index]);
+                accumulator = utils::multiplyAccumulate(accumulator, m_actuations[buffer_index], s[index]);
+            }
+
+            const T actuation    = utils::narrow<T>(accumulator, coefficient_fractional_bits);
+            m_actuations[m_head] = actuation;
+
+            m_head++;
+            if (m_head == buffer_length)
+            {
+                m_head = 0;
+            }
+
+            return DataType::fromRaw(actuation);
+        }
+
+        //! Updates the most recent reference in the history, used in cases actuation goes over the limit.
+        //!
+        //! @param updated_actuation Actuation that actually took place after clipping of the calculated actuation
+        void updateReference(const DataType updated_actuation) noexcept
+        {
+            // based on simplified logic of regRstCalcRefRT from CCLIBS libreg's regRst.c for closed-loop
+            int64_t index = m_head - 1;
+            if (m_head == 0)
+            {
+                index = buffer_length - 1;
+            }
+            const int64_t delta_actuation = static_cast<int64_t>(updated_actuation.value()) - m_actuations[index];
+            m_actuations[index]           = updated_actuation.value();
+
+            // the difference of two T values needs one more bit, so the product is accumulated in two steps
+            const int64_t s0_over_t0 = m_polynomials.value().s0_over_t0;
+            const int64_t correction = utils::saturatingAdd(
+                s0_over_t0 * (delta_actuation >> 1), s0_over_t0 * (delta_actuation - (delta_actuation >> 1))
+            );
+            m_references[index] = utils::narrow<T>(
+                utils::saturatingAdd(
+                    static_cast<int64_t>(m_references[index]) << coefficient_fractional_bits, correction
+                ),
+                coefficient_fractional_bits
+            );
+        }
+
+        //! Resets the controller to the initial state by zeroing the history.
+        void reset() noexcept
+        {
+            m_measurements.fill(0);
+            m_references.fill(0);
+            m_actuations.fill(0);
+            m_head          = 0;
+            m_history_ready = false;
+        }
+
+        //! Normalises the R, S, and T polynomials by the first element of S, quantises them into the Q-format of
+        //! this controller and analyses the headroom of the accumulator. Coefficients of the bank being loaded are
+        //! only replaced if no issue was found. Meant to be called from verifyParameters of the owning Component, after
+        //! the stability checks.
+        //!
+        //! @param r Array with R polynomial values to be set
+        //! @param s Array with S polynomial values to be set
+        //! @param t Array with T polynomial values to be set
+        //! @return Optionally returns a Warning if a coefficient cannot be represented or the accumulator can overflow
+        std::optional<fgc4::utils::Warning> setPolynomials(
+            const std::array<double, buffer_length>& r, const std::array<double, buffer_length>& s,
+            const std::array<double, buffer_length>& t
+        )
+        {
+            if (s[0] == 0 || t[0] == 0)
+            {
+                return fgc4::utils::Warning(fmt::format("{}: first element of s or t coefficients is zero.\n", m_name));
+            }
+
+            Polynomials quantised{};
+            double      sum_absolute{0.0};   // in units of the coefficient LSB
+            for (int64_t index = 0; index < buffer_length; index++)
+            {
+                const auto maybe_r = utils::quantise<coefficient_fractional_bits, T>(-r[index] / s[0]);
+                const auto maybe_t = utils::quantise<coefficient_fractional_bits, T>(t[index] / s[0]);
+                // the first element of the normalised s is one and it is never used
+                const auto maybe_s = (index == 0) ? std::optional<T>{0}
+                                                  : utils::quantise<coefficient_fractional_bits, T>(-s[index] / s[0]);
+                if (!maybe_r.has_value() || !maybe_s.has_value() || !maybe_t.has_value())
+                {
+                    return fgc4::utils::Warning(fmt::format(
+                        "{}: normalised coefficients at index {} cannot be represented with {} fractional bits.\n",
+                        m_name, index, coefficient_fractional_bits
+                    ));
+                }
+                quantised.r[index] = maybe_r.value();
+                quantised.s[index] = maybe_s.value();
+                quantised.t[index] = maybe_t.value();
+                sum_absolute += std::abs(static_cast<double>(maybe_r.value()))
+                                + std::abs(static_cast<double>(maybe_s.value()))
+                                + std::abs(static_cast<double>(maybe_t.value()));
+            }
+
+            const auto maybe_s0_over_t0 = utils::quantise<coefficient_fractional_bits, T>(s[0] / t[0]);
+            if (!maybe_s0_over_t0.has_value())
+            {
+                return fgc4::utils::Warning(fmt::format(
+                    "{}: ratio of first elements of s and t cannot be represented with {} fractional bits.\n", m_name,
+                    coefficient_fractional_bits
+                ));
+            }
+
+            const auto accumulator_headroom = utils::headroomBits(sum_absolute * std::ldexp(1.0, type_width - 1), 64);
+            if (accumulator_headroom < 0)
+            {
+                return fgc4::utils::Warning(fmt::format(
+                    "{}: accumulator can saturate by {} bits for full-scale inputs, reduce the number of fractional "
+                    "bits of the coefficients.\n",
+                    m_name, -accumulator_headroom
+                ));
+            }
+
+            quantised.s0_over_t0           = maybe_s0_over_t0.value();
+            quantised.accumulator_headroom = accumulator_headroom;
+            m_polynomials.set(quantised);
+            return {};
+        }
+
+        // ************************************************************
+        // Getters
+
+        //! Returns flag whether the reference and measurement histories are filled and RST is ready to regulate.
+        //!
+        //! @return True if reference and measurement histories are filled, false otherwise
+        [[nodiscard]] bool isReady() const noexcept
+        {
+            return m_history_ready;
+        }
+
+        //! Returns the number of spare bits of the accumulator for full-scale inputs, found during the last
+        //! successful call to setPolynomials.
+        //!
+        //! @return Accumulator headroom in bits
+        [[nodiscard]] int16_t getAccumulatorHeadroom() const noexcept
+        {
+            return m_polynomials.value().accumulator_headroom;
+        }
+
+        //! Returns the actuation history buffer.
+        //!
+        //! @return Reference to the history buffer holding previous actuations, in their stored representation
+        [[nodiscard]] const auto& getActuations() const noexcept
+        {
+            return m_actuations;
+        }
+
+        //! Returns the reference history buffer.
+        //!
+        //! @return Reference to the history buffer holding previous references, in their stored representation
+        [[nodiscard]] const auto& getReferences() const noexcept
+        {
+            return m_references;
+        }
+
+        //! Returns the measurement history buffer.
+        //!
+        //! @return Reference to the history buffer holding previous measurements, in their stored representation
+        [[nodiscard]] const auto& getMeasurements() const noexcept
+        {
+            return m_measurements;
+        }
+
+      private:
+        int64_t     m_head{0};   //!< Index to oldest entry in the history
+        std::string m_name;      //!< Name of this controller
+
+        //! Polynomials quantised by setPolynomials, with the headroom they leave for full-scale inputs
+        struct Polynomials
+        {
+            std::array<T, buffer_length> r{0};   //!< Negated R-polynomial coefficients, normalised by s[0]
+            std::array<T, buffer_length> s{0};   //!< Negated S-polynomial coefficients, normalised by s[0]
+            std::array<T, buffer_length> t{0};   //!< T-polynomial coefficients, normalised by s[0]
+            T       s0_over_t0{0};               //!< Ratio of s[0] and t[0] used to back-calculate references
+            int16_t accumulator_headroom{0};     //!< Spare bits of the accumulator for full-scale inputs
+        };
+
+        BankedValue<Polynomials> m_polynomials{};   //!< Quantised polynomials, per bank
+
+        std::array<T, buffer_length> m_measurements{0};   //!< RST measurement history
+        std::array<T, buffer_length> m_references{0};     //!< RST reference history
+        std::array<T, buffer_length> m_actuations{0};     //!< RST actuation history
+
+        bool m_history_ready{false};   //!< flag to mark RST ref and meas histories are filled
+    };
+}   // namespace vslib
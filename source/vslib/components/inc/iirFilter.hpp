@@ -8,13 +8,14 @@
 #include <array>
 #include <string>
 
+#include "bankedValue.hpp"
 #include "filter.hpp"
 #include "parameter.hpp"
 
 namespace vslib
 {
-    template<int64_t filter_order>
-    class IIRFilter : public Filter
+    template<int64_t filter_order, fgc4::utils::Floating T = double>
+    class IIRFilter : public Filter<T>
     {
         constexpr static int64_t buffer_length = filter_order + 1;
 
@@ -25,7 +26,7 @@ namespace vslib
         //! @param name Name of this Filter Component
         //! @param parent Parent of this Filter Component
         IIRFilter(std::string_view name, Component& parent)
-            : Filter("IIRFilter", name, parent),
+            : Filter<T>("IIRFilter", name, parent),
               numerator(*this, "numerator_coefficients"),
               denominator(*this, "denominator_coefficients")
         {
@@ -37,27 +38,45 @@ namespace vslib
         //!
         //! @param input Input value to be filtered
         //! @return Filtered value
-        [[nodiscard]] double filter(const double input) override
+        [[nodiscard]] T filter(const T input) override
         {
-            updateInputBuffer(input);
-            double output = m_inputs_buffer[m_head] * numerator[0];
+            const auto& [b, a] = m_coefficients.value();   // numerator and denominator of the active bank
+            if constexpr (filter_order == 1)
+            {
+                // Benchmarking showed 19% gain for the first order, and only 4% for the 2nd order. Therefore, only
+                // the first order is unrolled.
+                auto const previous_input  = m_inputs_buffer[0];
+                auto const previous_output = m_outputs_buffer[0];
+
+                T const output = input * b[0] + previous_input * b[1] - previous_output * a[1];
+
+                // update input and output buffers
+                m_inputs_buffer[0]  = input;
+                m_outputs_buffer[0] = output;
 
-            for (int64_t index = 1; index < buffer_length; index++)
+                return output;
+            }
+            else
             {
-                int64_t buffer_index = (m_head - index);
-                // Benchmarking showed a significant speed-up (>30% for orders higher than 2)
-                // when if statement is used instead of modulo to perform the shift below
-                if (buffer_index < 0)
+                updateInputBuffer(input);
+                T output = m_inputs_buffer[m_head] * b[0];
+
+                for (int64_t index = 1; index < buffer_length; index++)
                 {
-                    buffer_index += buffer_length;
+                    int64_t buffer_index = (m_head - index);
+                    // Benchmarking showed a significant speed-up (>30% for orders higher than 2)
+                    // when if statement is used instead of modulo to perform the shift below
+                    if (buffer_index < 0)
+                    {
+                        buffer_index += buffer_length;
+                    }
+                    output += m_inputs_buffer[buffer_index] * b[index] - m_outputs_buffer[buffer_index] * a[index];
                 }
-                output += m_inputs_buffer[buffer_index] * m_numerator[index]
-                          - m_outputs_buffer[buffer_index] * m_denominator[index];
-            }
 
-            shiftOutputBuffer(output);
+                shiftOutputBuffer(output);
 
-            return output;
+                return output;
+            }
         }
 
         //! Filters the provided input array by filtering each element of the input.
@@ -65,9 +84,9 @@ namespace vslib
         //! @param inputs Array with input values to be filtered
         //! @return Array with the filtered values
         template<size_t N>
-        [[nodiscard]] std::array<double, N> filter(const std::array<double, N>& inputs)
+        [[nodiscard]] std::array<T, N> filter(const std::array<T, N>& inputs)
         {
-            std::array<double, N> outputs{0};
+            std::array<T, N> outputs{0};
             std::transform(
                 inputs.cbegin(), inputs.cend(), outputs.begin(),
                 [&](const auto& input)
@@ -82,27 +101,41 @@ namespace vslib
         Parameter<std::array<double, buffer_length>> numerator;     //!< Coefficients applied to inputs
         Parameter<std::array<double, buffer_length>> denominator;   //!< Coefficients applied to outputs
 
-        //! Copies Parameter values into local containers for optimised access.
+        //! Copies Parameter values into local containers of the bank being loaded for optimised access, converting
+        //! them to the filter's scalar type.
         //!
         //! @return Optionally returns a Warning if an issue was found
         std::optional<fgc4::utils::Warning> verifyParameters() override
         {
-            std::copy(numerator.toValidate().cbegin(), numerator.toValidate().cend(), std::begin(m_numerator));
-            std::copy(denominator.toValidate().cbegin(), denominator.toValidate().cend(), std::begin(m_denominator));
+            Coefficients local_coefficients{};
+            std::copy(
+                numerator.toValidate().cbegin(), numerator.toValidate().cend(), local_coefficients.numerator.begin()
+            );
+            std::copy(
+                denominator.toValidate().cbegin(), denominator.toValidate().cend(),
+                local_coefficients.denominator.begin()
+            );
+            m_coefficients.set(local_coefficients);
             return {};
         }
 
       private:
-        std::array<double, buffer_length> m_numerator;           //!< Local copy of coefficients applied to inputs
-        std::array<double, buffer_length> m_denominator;         //!< Local copy of coefficients applied to outputs
-        std::array<double, buffer_length> m_inputs_buffer{0};    //!< History of the provided inputs
-        std::array<double, buffer_length> m_outputs_buffer{0};   //!< History of the outputs
-        int64_t                           m_head{0};   //!< Points to where is the current head of the history buffers
+        //! Local copy of the coefficients, in the filter's scalar type
+        struct Coefficients
+        {
+            std::array<T, buffer_length> numerator{0};     //!< Coefficients applied to inputs
+            std::array<T, buffer_length> denominator{0};   //!< Coefficients applied to outputs
+        };
+
+        BankedValue<Coefficients>    m_coefficients{};      //!< Local copy of the coefficients, per bank
+        std::array<T, buffer_length> m_inputs_buffer{0};    //!< History of the provided inputs
+        std::array<T, buffer_length> m_outputs_buffer{0};   //!< History of the outputs
+        int64_t                      m_head{0};   //!< Points to where is the current head of the history buffers
 
         //! Pushes the provided value into the front of the buffer, overriding the oldest value in effect.
         //!
         //! @param input Input value to be added to the front of the inputs buffer
-        void updateInputBuffer(const double input)
+        void updateInputBuffer(const T input)
         {
             m_inputs_buffer[m_head] = input;
         }
@@ -110,7 +143,7 @@ namespace vslib
         //! Pushes the provided value into the front of the output buffer, overriding the oldest value in effect.
         //!
         //! @param output Output value to be added to the front of the outputs buffer
-        void shiftOutputBuffer(const double output)
+        void shiftOutputBuffer(const T output)
         {
             m_outputs_buffer[m_head] = output;
 
@@ -121,32 +154,4 @@ namespace vslib
             }
         }
     };
-
-    // ************************************************************
-    // Override for the first-order filter. Specialization of functions avoids repetition
-    // of the entire class structure.
-    //
-    // Benchmarking showed 19% gain for the first order, and only 4% for the 2nd order. Therefore, only
-    // the first order is specialized.
-
-    //! Filters the provided input array by filtering each element of the input.
-    //!
-    //! @param input Array with input values to be filtered
-    //! @return Array with the filtered values
-    template<>
-    [[nodiscard]] inline double IIRFilter<1>::filter(const double input)
-    {
-        auto const previous_input  = m_inputs_buffer[0];
-        auto const previous_output = m_outputs_buffer[0];
-
-        double const output
-            = input * m_numerator[0] + previous_input * m_numerator[1] - previous_output * m_denominator[1];
-
-        // update input and output buffers
-        m_inputs_buffer[0]  = input;
-        m_outputs_buffer[0] = output;
-
-        return output;
-    }
-
 }   // namespace vslib
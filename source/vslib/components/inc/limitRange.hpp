@@ -10,6 +10,7 @@
 
 #include "component.hpp"
 #include "parameter.hpp"
+#include "parameterCache.hpp"
 
 namespace vslib
 {
@@ -44,34 +45,39 @@ namespace vslib
                 }
             }
 
-            if (m_dead_zone_defined && (input > dead_zone[0] && input < dead_zone[1]))
+            // thresholds are plain copies of the Parameters, refreshed only after they have changed
+            const auto& thresholds = m_thresholds.get();
+            const T     lower_edge = thresholds.dead_zone[0];
+            const T     upper_edge = thresholds.dead_zone[1];
+
+            if (thresholds.dead_zone_defined && (input > lower_edge && input < upper_edge))
             {
                 if constexpr (std::is_unsigned_v<T>)
                 {
                     // abs is not defined for unsigned integers
-                    return (input - dead_zone[0] > dead_zone[1] - input) ? dead_zone[1] : dead_zone[0];
+                    return (input - lower_edge > upper_edge - input) ? upper_edge : lower_edge;
                 }
                 else
                 {
                     if constexpr (fgc4::utils::Integral<T>)
                     {
-                        return (abs(dead_zone[0] - input) > abs(dead_zone[1] - input)) ? dead_zone[1] : dead_zone[0];
+                        return (abs(lower_edge - input) > abs(upper_edge - input)) ? upper_edge : lower_edge;
                     }
                     else
                     {
-                        return (fabs(dead_zone[0] - input) > fabs(dead_zone[1] - input)) ? dead_zone[1] : dead_zone[0];
+                        return (fabs(lower_edge - input) > fabs(upper_edge - input)) ? upper_edge : lower_edge;
                     }
                 }
             }
 
-            if (input < min)
+            if (input < thresholds.min)
             {
-                return min;
+                return thresholds.min;
             }
 
-            if (input > max)
+            if (input > thresholds.max)
             {
-                return max;
+                return thresholds.max;
             }
 
             return input;
@@ -86,9 +92,9 @@ namespace vslib
         //! @return Optionally returns a warning if any issues have been found
         std::optional<fgc4::utils::Warning> verifyParameters() override
         {
-            m_dead_zone_defined = (dead_zone.toValidate()[0] != dead_zone.toValidate()[1]);
+            const bool dead_zone_defined = (dead_zone.toValidate()[0] != dead_zone.toValidate()[1]);
 
-            if (m_dead_zone_defined && (dead_zone.toValidate()[0] > dead_zone.toValidate()[1]))
+            if (dead_zone_defined && (dead_zone.toValidate()[0] > dead_zone.toValidate()[1]))
             {
                 return fgc4::utils::Warning("Upper edge of the dead_zone is below the lower edge.\n");
             }
@@ -102,6 +108,27 @@ namespace vslib
         }
 
       private:
-        bool m_dead_zone_defined{false};   //!< Flag whether the optional dead zone has been defined
+        //! Plain copies of the Parameters read by limit
+        struct Thresholds
+        {
+            T                min{};                      //!< Minimum allowed value
+            T                max{};                      //!< Maximum allowed value
+            std::array<T, 2> dead_zone{};                //!< Two edges (min, max) of the dead zone
+            bool             dead_zone_defined{false};   //!< Flag whether the optional dead zone has been defined
+        };
+
+        //! Derives the thresholds from the values of the Parameters.
+        //!
+        //! @param minimum Minimum allowed value
+        //! @param maximum Maximum allowed value
+        //! @param edges Two edges of the dead zone
+        //! @return Thresholds read by limit
+        static Thresholds deriveThresholds(const T& minimum, const T& maximum, const std::array<T, 2>& edges) noexcept
+        {
+            return {minimum, maximum, edges, edges[0] != edges[1]};
+        }
+
+        //! Thresholds cached from the Parameters
+        ParameterCache<Thresholds, T, T, std::array<T, 2>> m_thresholds{&deriveThresholds, min, max, dead_zone};
     };
 }   // namespace vslib
\ No newline at end of file
@@ -10,6 +10,7 @@
 
 #include "component.hpp"
 #include "parameter.hpp"
+#include "parameterCache.hpp"
 
 namespace vslib
 {
@@ -49,13 +50,16 @@ namespace vslib
                 return std::numeric_limits<T>::max();   // no meaningful rate can be calculated
             }
 
+            // plain copy of the Parameter, refreshed only after it has changed
+            const T rate_limit = m_change_rate.get();
+
             if (!m_previous_value_set)   // avoids failure at first call to limit
             {
                 if constexpr ((std::is_same_v<T, float> || std::is_same_v<T, double>))
                 {
                     if (std::isinf(input))
                     {
-                        return m_previous_value + change_rate * time_difference;
+                        return m_previous_value + rate_limit * time_difference;
                     }
                 }
                 m_previous_value     = input;
@@ -63,10 +67,10 @@ namespace vslib
                 return input;
             }
             const double rate = fabs(input - m_previous_value) / time_difference;
-            if (rate > change_rate)
+            if (rate > rate_limit)
             {
                 // maximal input to not violate the rate of change
-                input = m_previous_value + change_rate * time_difference;
+                input = m_previous_value + rate_limit * time_difference;
 
                 m_previous_value = input;
                 return input;
@@ -90,5 +94,16 @@ namespace vslib
         T m_previous_value{T{}};   //!< Holds previous input value
 
         bool m_previous_value_set{false};   //!< Flag informing whether the previous value has been set
+
+        //! Provides the rate of change to be cached, the value of the Parameter itself.
+        //!
+        //! @param rate Maximal allowed rate of change
+        //! @return Rate of change read by limit
+        static T deriveRate(const T& rate) noexcept
+        {
+            return rate;
+        }
+
+        ParameterCache<T, T> m_change_rate{&deriveRate, change_rate};   //!< Rate of change cached from the Parameter
     };
 }   // namespace vslib
\ No newline at end of file
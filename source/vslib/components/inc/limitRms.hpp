@@ -7,6 +7,7 @@
 #include <cmath>
 #include <string>
 
+#include "bankedValue.hpp"
 #include "component.hpp"
 #include "parameter.hpp"
 
@@ -41,9 +42,10 @@ namespace vslib
             }
 
             // calculation re-implemented from regLimRmsRT
-            m_cumulative += (pow(input, 2) - m_cumulative) * m_filter_factor;
+            const auto& factors = m_factors.value();
+            m_cumulative        += (pow(input, 2) - m_cumulative) * factors.filter_factor;
 
-            return (m_cumulative >= m_rms_limit_min_squared && m_cumulative <= m_rms_limit_max_squared);
+            return (m_cumulative >= factors.rms_limit_min_squared && m_cumulative <= factors.rms_limit_max_squared);
         }
 
         //! Resets this Limit Component to the initial state of buffers and buffer pointers.
@@ -58,17 +60,24 @@ namespace vslib
 
         std::optional<fgc4::utils::Warning> verifyParameters() override
         {
-            m_filter_factor         = m_iteration_period / (rms_time_constant.toValidate() + 0.5 * m_iteration_period);
-            m_rms_limit_min_squared = pow(rms_limit_min.toValidate(), 2);
-            m_rms_limit_max_squared = pow(rms_limit_max.toValidate(), 2);
+            m_factors.set(
+                {m_iteration_period / (rms_time_constant.toValidate() + 0.5 * m_iteration_period),
+                 pow(rms_limit_min.toValidate(), 2), pow(rms_limit_max.toValidate(), 2)}
+            );
             return {};
         }
 
       private:
-        double m_iteration_period{0.0};        //!< Iteration period for this Limit
-        double m_cumulative{0.0};              //!< Cumulative of the squared inputs
-        double m_filter_factor{0.0};           //!< Convenience factor to avoid re-calculation each call to limit
-        double m_rms_limit_min_squared{0.0};   //!< optimisation method to not recalculate limit to the power of 2
-        double m_rms_limit_max_squared{0.0};   //!< optimisation method to not recalculate limit to the power of 2
+        //! Factors derived from the Parameters to avoid their re-calculation each call to limit
+        struct Factors
+        {
+            double filter_factor{0.0};           //!< Filter factor of the cumulative
+            double rms_limit_min_squared{0.0};   //!< Minimal RMS limit to the power of 2
+            double rms_limit_max_squared{0.0};   //!< Maximal RMS limit to the power of 2
+        };
+
+        double               m_iteration_period{0.0};   //!< Iteration period for this Limit
+        double               m_cumulative{0.0};         //!< Cumulative of the squared inputs
+        BankedValue<Factors> m_factors{};               //!< Factors derived from the Parameters, per bank
     };
 }   // namespace vslib
@@ -15,7 +15,7 @@
 
 namespace vslib
 {
-
+    template<fgc4::utils::Floating ScalarType = double>
     class PID : public Component
     {
         static constexpr unsigned int buffer_length = 3;   // length of the R, S, and T coefficients and history buffers
@@ -46,7 +46,7 @@ namespace vslib
         //!
         //! @param reference Current value of the set-point reference
         //! @param measurement Current value of the process value
-        void updateInputHistories(const double reference, const double measurement) noexcept
+        void updateInputHistories(const ScalarType reference, const ScalarType measurement) noexcept
         {
             rst.updateInputHistories(reference, measurement);
         }
@@ -56,10 +56,10 @@ namespace vslib
         //! @param reference Reference value for the controller
         //! @param measurement Value of the controlled process
         //! @return Result of this iteration
-        [[nodiscard]] double control(const double reference, const double measurement) noexcept
+        [[nodiscard]] ScalarType control(const ScalarType reference, const ScalarType measurement) noexcept
         {
-            const double actuation         = rst.control(reference, measurement);
-            const double clipped_actuation = actuation_limits.limit(actuation);
+            const ScalarType actuation         = rst.control(reference, measurement);
+            const ScalarType clipped_actuation = actuation_limits.limit(actuation);
             if (clipped_actuation != actuation)
             {
                 updateReference(clipped_actuation);
@@ -70,7 +70,7 @@ namespace vslib
         //! Updates the most recent reference in the history, used in cases actuation goes over the limit.
         //!
         //! @param updated_actuation Actuation that actually took place after clipping of the calculated actuation
-        void updateReference(const double updated_actuation)
+        void updateReference(const ScalarType updated_actuation)
         {
             rst.updateReference(updated_actuation);
         }
@@ -124,7 +124,7 @@ namespace vslib
         // ************************************************************
         // Limits of the controller's actuation
 
-        LimitRange<double> actuation_limits;   //!< Range limiting of the actuation output
+        LimitRange<ScalarType> actuation_limits;   //!< Range limiting of the actuation output
 
         // ************************************************************
 
@@ -257,7 +257,7 @@ namespace vslib
         std::array<double, buffer_length> m_s{0};   //!< Array holding a local copy of S coefficients
         std::array<double, buffer_length> m_t{0};   //!< Array holding a local copy of T coefficients
 
-        RSTController<buffer_length> rst;   //!< RST controller responsible for the control logic
+        RSTController<buffer_length, ScalarType> rst;   //!< RST controller responsible for the control logic
 
         bool m_1dof{false};   //!< Flag to define whether the controller has 1 (true) or 2 degrees of freedom
     };
@@ -14,7 +14,7 @@
 
 namespace vslib
 {
-    template<int64_t order>
+    template<int64_t order, fgc4::utils::Floating T = double>
     class RST : public Component
     {
       public:
@@ -37,7 +37,7 @@ namespace vslib
         //!
         //! @param reference Current value of the set-point reference
         //! @param measurement Current value of the process value (measurement)
-        void updateInputHistories(const double reference, const double measurement) noexcept
+        void updateInputHistories(const T reference, const T measurement) noexcept
         {
             rst.updateInputHistories(reference, measurement);
         }
@@ -47,15 +47,15 @@ namespace vslib
         //! @param reference Reference value for the controller
         //! @param measurement Current process value (measurement)
         //! @return Controller output of the iteration
-        [[nodiscard]] double control(const double reference, const double measurement) noexcept
+        [[nodiscard]] T control(const T reference, const T measurement) noexcept
         {
             if (!isReady())
             {
                 rst.updateInputHistories(reference, measurement);
                 return 0.0;
             }
-            const double actuation         = rst.control(reference, measurement);
-            const double clipped_actuation = actuation_limits.limit(actuation);
+            const T actuation         = rst.control(reference, measurement);
+            const T clipped_actuation = actuation_limits.limit(actuation);
             if (clipped_actuation != actuation)
             {
                 updateReference(clipped_actuation);
@@ -66,7 +66,7 @@ namespace vslib
         //! Updates the most recent reference in the history, used in cases actuation goes over the limit.
         //!
         //! @param updated_actuation Actuation that actually took place after clipping of the calculated actuation
-        void updateReference(const double updated_actuation)
+        void updateReference(const T updated_actuation)
         {
             rst.updateReference(updated_actuation);
         }
@@ -122,7 +122,7 @@ namespace vslib
         // ************************************************************
         // Limits of the controller's actuation
 
-        LimitRange<double> actuation_limits;   //!< Range limiting of the actuation output
+        LimitRange<T> actuation_limits;   //!< Range limiting of the actuation output
 
         // ************************************************************
         //! Update parameters method, called after paramaters of this component are modified
@@ -169,6 +169,6 @@ namespace vslib
         }
 
       private:
-        RSTController<order + 1> rst;   //!< RST controller responsible for the control logic
+        RSTController<order + 1, T> rst;   //!< RST controller responsible for the control logic
     };
 }   // namespace vslib
@@ -4,16 +4,19 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cstdint>
 #include <optional>
 #include <string>
 
+#include "bankedValue.hpp"
+#include "typeTraits.hpp"
 #include "warningMessage.hpp"
 
 namespace vslib
 {
-    template<int64_t buffer_length>
+    template<int64_t buffer_length, fgc4::utils::Floating T = double>
     class RSTController
     {
       public:
@@ -27,14 +30,33 @@ namespace vslib
         //!
         //! @param reference Current value of the set-point reference
         //! @param measurement Current value of the process value
-        void updateInputHistories(const double reference, const double measurement) noexcept
+        void updateInputHistories(const T reference, const T measurement) noexcept
         {
-            m_references[m_head]   = reference;
-            m_measurements[m_head] = measurement;
-            m_head++;
-            if (m_head == (buffer_length - 1))
+            if constexpr (buffer_length == 3)
             {
-                m_history_ready = true;
+                m_references[2] = m_references[1];
+                m_references[1] = m_references[0];
+                m_references[0] = reference;
+
+                m_measurements[2] = m_measurements[1];
+                m_measurements[1] = m_measurements[0];
+                m_measurements[0] = measurement;
+
+                m_head++;
+                if (m_head == 2)
+                {
+                    m_history_ready = true;
+                }
+            }
+            else
+            {
+                m_references[m_head]   = reference;
+                m_measurements[m_head] = measurement;
+                m_head++;
+                if (m_head == (buffer_length - 1))
+                {
+                    m_history_ready = true;
+                }
             }
         }
 
@@ -43,78 +65,134 @@ namespace vslib
         //! @param reference Reference value for the controller
         //! @param measurement Current process value (measurement)
         //! @return Controller output of the iteration
-        [[nodiscard]] double control(const double reference, const double measurement) noexcept
+        [[nodiscard]] T control(const T reference, const T measurement) noexcept
         {
-            // based on logic in regRstCalcActRT from CCLIBS libreg regRst.c
-            m_references[m_head]   = reference;
-            m_measurements[m_head] = measurement;
-
-            double actuation = m_t[0] * m_references[m_head] - m_r[0] * m_measurements[m_head];
-            for (int64_t index = 1; index < buffer_length; index++)
+            // polynomials of the active bank
+            const auto& r = m_r.value();
+            const auto& s = m_s.value();
+            const auto& t = m_t.value();
+            if constexpr (buffer_length == 3)
             {
-                int64_t buffer_index = (m_head - index);
-                if (buffer_index < 0)
+                // This unrolled version allows to speed-up the calculation of the RST actuation by about 15%
+                m_references[2] = m_references[1];
+                m_references[1] = m_references[0];
+                m_references[0] = reference;
+
+                m_measurements[2] = m_measurements[1];
+                m_measurements[1] = m_measurements[0];
+                m_measurements[0] = measurement;
+
+                m_actuations[2] = m_actuations[1];
+                m_actuations[1] = m_actuations[0];
+                m_actuations[0] = (t[0] * reference - r[0] * measurement + t[1] * m_references[1]
+                                   - r[1] * m_measurements[1] + t[2] * m_references[2] - r[2] * m_measurements[2]
+                                   - (s[1] * m_actuations[1] + s[2] * m_actuations[2]))
+                                  / s[0];
+
+                return m_actuations[0];
+            }
+            else
+            {
+                // based on logic in regRstCalcActRT from CCLIBS libreg regRst.c
+                m_references[m_head]   = reference;
+                m_measurements[m_head] = measurement;
+
+                T actuation = t[0] * m_references[m_head] - r[0] * m_measurements[m_head];
+                for (int64_t index = 1; index < buffer_length; index++)
                 {
-                    buffer_index += buffer_length;
+                    int64_t buffer_index = (m_head - index);
+                    if (buffer_index < 0)
+                    {
+                        buffer_index += buffer_length;
+                    }
+                    actuation += t[index] * m_references[buffer_index] - r[index] * m_measurements[buffer_index]
+                                 - s[index] * m_actuations[buffer_index];
                 }
-                actuation += m_t[index] * m_references[buffer_index] - m_r[index] * m_measurements[buffer_index]
-                             - m_s[index] * m_actuations[buffer_index];
-            }
-            actuation /= m_s[0];
+                actuation /= s[0];
 
-            m_actuations[m_head] = actuation;   // update actuations
+                m_actuations[m_head] = actuation;   // update actuations
 
-            m_head++;
-            if (m_head == buffer_length)
-            {
-                m_head = 0;
-            }
+                m_head++;
+                if (m_head == buffer_length)
+                {
+                    m_head = 0;
+                }
 
-            return actuation;
+                return actuation;
+            }
         }
 
         //! Updates the most recent reference in the history, used in cases actuation goes over the limit.
         //!
         //! @param updated_actuation Actuation that actually took place after clipping of the calculated actuation
-        void updateReference(const double updated_actuation)
+        void updateReference(const T updated_actuation)
         {
-            // based on simplified logic of regRstCalcRefRT from CCLIBS libreg's regRst.c for closed-loop
-            size_t index = m_head - 1;
-            if (m_head == 0)
+            // polynomials of the active bank
+            const auto& s = m_s.value();
+            const auto& t = m_t.value();
+            if constexpr (buffer_length == 3)
             {
-                index = buffer_length - 1;
+                // based on logic of regRstCalcRefRT from CCLIBS libreg's regRst.c
+                const T delta_actuation = updated_actuation - m_actuations[0];
+                m_actuations[0]         = updated_actuation;
+                m_references[0]         += delta_actuation * s[0] / t[0];
+            }
+            else
+            {
+                // based on simplified logic of regRstCalcRefRT from CCLIBS libreg's regRst.c for closed-loop
+                size_t index = m_head - 1;
+                if (m_head == 0)
+                {
+                    index = buffer_length - 1;
+                }
+                const T delta_actuation = updated_actuation - m_actuations[index];
+                m_actuations[index]     = updated_actuation;
+                m_references[index]     += delta_actuation * s[0] / t[0];
             }
-            const double delta_actuation = updated_actuation - m_actuations[index];
-            m_actuations[index]          = updated_actuation;
-            m_references[index]          += delta_actuation * m_s[0] / m_t[0];
         }
 
         //! Updates the most recent reference in the history, used in cases actuation goes over the limit in the
         //! open-loop case.
         //!
         //! @param updated_actuation Actuation that actually took place after clipping of the calculated actuation
-        void updateReferenceOpenLoop(const double updated_actuation)
+        void updateReferenceOpenLoop(const T updated_actuation)
         {
-            // based on logic of regRstCalcRefRT from CCLIBS libreg's regRst.c for open loop calculation
-            const int64_t prev_head = m_head - 1;
-            if (m_head == 0)
+            // polynomials of the active bank
+            const auto& r = m_r.value();
+            const auto& s = m_s.value();
+            const auto& t = m_t.value();
+            if constexpr (buffer_length == 3)
             {
-                prev_head = buffer_length - 1;
+                // based on logic of regRstCalcRefRT from CCLIBS libreg's regRst.c
+                m_actuations[0] = updated_actuation;
+                m_references[0] = (s[0] * updated_actuation + r[0] * m_measurements[0] + s[1] * m_actuations[1]
+                                   + r[1] * m_measurements[1] - t[1] * m_references[1] + s[2] * m_actuations[2]
+                                   + r[2] * m_measurements[2] - t[2] * m_references[2])
+                                  / t[0];
             }
-            m_actuations[prev_head] = updated_actuation;
-
-            double reference = m_s[0] * updated_actuation + m_r[0] * m_measurements[prev_head];
-            for (int64_t index = 1; index < buffer_length; index++)
+            else
             {
-                int64_t buffer_index = (prev_head - index);
-                if (buffer_index < 0)
+                // based on logic of regRstCalcRefRT from CCLIBS libreg's regRst.c for open loop calculation
+                int64_t prev_head = m_head - 1;
+                if (m_head == 0)
                 {
-                    buffer_index += buffer_length;
+                    prev_head = buffer_length - 1;
                 }
-                reference += m_s[index] * m_actuations[buffer_index] + m_r[index] * m_measurements[buffer_index]
-                             - m_t[index] * m_references[buffer_index];
+                m_actuations[prev_head] = updated_actuation;
+
+                T reference = s[0] * updated_actuation + r[0] * m_measurements[prev_head];
+                for (int64_t index = 1; index < buffer_length; index++)
+                {
+                    int64_t buffer_index = (prev_head - index);
+                    if (buffer_index < 0)
+                    {
+                        buffer_index += buffer_length;
+                    }
+                    reference += s[index] * m_actuations[buffer_index] + r[index] * m_measurements[buffer_index]
+                                 - t[index] * m_references[buffer_index];
+                }
+                m_references[prev_head] = reference / t[0];
             }
-            m_references[prev_head] = reference / m_t[0];
         }
 
         //! Resets the controller to the initial state by zeroing the history.
@@ -241,7 +319,7 @@ namespace vslib
         //! @return Array with R polynomial coefficients
         [[nodiscard]] const auto& getR() const
         {
-            return m_r;
+            return m_r.value();
         }
 
         //! Gets the S polynomial.
@@ -249,7 +327,7 @@ namespace vslib
         //! @return Array with S polynomial coefficients
         [[nodiscard]] const auto& getS() const
         {
-            return m_s;
+            return m_s.value();
         }
 
         //! Gets the T polynomial.
@@ -257,47 +335,53 @@ namespace vslib
         //! @return Array with T polynomial coefficients
         [[nodiscard]] const auto& getT() const
         {
-            return m_t;
+            return m_t.value();
         }
 
         // ************************************************************
         // Setters
 
-        //! Sets the R polynomial.
+        //! Sets the R polynomial of the bank being loaded.
         //!
         //! @param r Array with R polynomial values to be set
         void setR(const std::array<double, buffer_length>& r)
         {
-            m_r = r;
+            std::array<T, buffer_length> polynomial{0};
+            std::copy(r.cbegin(), r.cend(), polynomial.begin());
+            m_r.set(polynomial);
         }
 
-        //! Sets the S polynomial.
+        //! Sets the S polynomial of the bank being loaded.
         //!
         //! @param s Array with S polynomial values to be set
         void setS(const std::array<double, buffer_length>& s)
         {
-            m_s = s;
+            std::array<T, buffer_length> polynomial{0};
+            std::copy(s.cbegin(), s.cend(), polynomial.begin());
+            m_s.set(polynomial);
         }
 
-        //! Sets the T polynomial.
+        //! Sets the T polynomial of the bank being loaded.
         //!
         //! @param t Array with T polynomial values to be set
         void setT(const std::array<double, buffer_length>& t)
         {
-            m_t = t;
+            std::array<T, buffer_length> polynomial{0};
+            std::copy(t.cbegin(), t.cend(), polynomial.begin());
+            m_t.set(polynomial);
         }
 
       private:
         int64_t     m_head{0};   //!< Index to oldest entry in the history
         std::string m_name;      //!< Name of this controller
 
-        std::array<double, buffer_length> m_r{0};   //!< R-polynomial coefficients
-        std::array<double, buffer_length> m_s{0};   //!< S-polynomial coefficients
-        std::array<double, buffer_length> m_t{0};   //!< T-polynomial coefficients
+        BankedValue<std::array<T, buffer_length>> m_r{};   //!< R-polynomial coefficients, per bank
+        BankedValue<std::array<T, buffer_length>> m_s{};   //!< S-polynomial coefficients, per bank
+        BankedValue<std::array<T, buffer_length>> m_t{};   //!< T-polynomial coefficients, per bank
 
-        std::array<double, buffer_length> m_measurements{0};   //!< RST measurement history
-        std::array<double, buffer_length> m_references{0};     //!< RST reference history
-        std::array<double, buffer_length> m_actuations{0};     //!< RST actuation history
+        std::array<T, buffer_length> m_measurements{0};   //!< RST measurement history
+        std::array<T, buffer_length> m_references{0};     //!< RST reference history
+        std::array<T, buffer_length> m_actuations{0};     //!< RST actuation history
 
         bool m_history_ready{false};   //!< flag to mark RST ref and meas histories are filled
 
@@ -305,77 +389,4 @@ namespace vslib
         std::array<double, buffer_length> m_b{0};   // variable used in Jury's test, declaring them here avoids
                                                     // allocation whenever jurysStabilityTest is called
     };
-
-    //! Control method returning the next actuation.
-    //!
-    //! @param measurement Current measurement value
-    //! @param reference Current reference value
-    //! @return Next actuation value
-    template<>
-    [[nodiscard]] inline double RSTController<3>::control(const double reference, const double measurement) noexcept
-    {
-        // This specialization allows to speed-up the calculation of the RST actuation by about 15%
-        m_references[2] = m_references[1];
-        m_references[1] = m_references[0];
-        m_references[0] = reference;
-
-        m_measurements[2] = m_measurements[1];
-        m_measurements[1] = m_measurements[0];
-        m_measurements[0] = measurement;
-
-        m_actuations[2] = m_actuations[1];
-        m_actuations[1] = m_actuations[0];
-        m_actuations[0] = (m_t[0] * reference - m_r[0] * measurement + m_t[1] * m_references[1]
-                           - m_r[1] * m_measurements[1] + m_t[2] * m_references[2] - m_r[2] * m_measurements[2]
-                           - (m_s[1] * m_actuations[1] + m_s[2] * m_actuations[2]))
-                          / m_s[0];
-
-        return m_actuations[0];
-    }
-
-
-    //! Updates the most recent reference in the history, used in cases actuation goes over the limit.
-    //!
-    //! @param updated_actuation Actuation that actually took place after clipping of the calculated actuation
-    template<>
-    inline void RSTController<3>::updateReferenceOpenLoop(const double updated_actuation)
-    {
-        // based on logic of regRstCalcRefRT from CCLIBS libreg's regRst.c
-        m_actuations[0] = updated_actuation;
-        m_references[0] = (m_s[0] * updated_actuation + m_r[0] * m_measurements[0] + m_s[1] * m_actuations[1]
-                           + m_r[1] * m_measurements[1] - m_t[1] * m_references[1] + m_s[2] * m_actuations[2]
-                           + m_r[2] * m_measurements[2] - m_t[2] * m_references[2])
-                          / m_t[0];
-    }
-
-    //! Updates the most recent reference in the history, used in cases actuation goes over the limit.
-    //!
-    //! @param updated_actuation Actuation that actually took place after clipping of the calculated actuation
-    template<>
-    inline void RSTController<3>::updateReference(const double updated_actuation)
-    {
-        // based on logic of regRstCalcRefRT from CCLIBS libreg's regRst.c
-        const double delta_actuation = updated_actuation - m_actuations[0];
-        m_actuations[0]              = updated_actuation;
-        m_references[0]              += delta_actuation * m_s[0] / m_t[0];
-    }
-
-    template<>
-    inline void RSTController<3>::updateInputHistories(const double reference, const double measurement) noexcept
-    {
-        m_references[2] = m_references[1];
-        m_references[1] = m_references[0];
-        m_references[0] = reference;
-
-        m_measurements[2] = m_measurements[1];
-        m_measurements[1] = m_measurements[0];
-        m_measurements[0] = measurement;
-
-        m_head++;
-        if (m_head == 2)
-        {
-            m_history_ready = true;
-        }
-    }
-
 }   // namespace vslib
@@ -0,0 +1,392 @@
+//! @file
+//! @brief Defines the signal-flow graph, compiling Components connected by typed signals into a flat execution
+//! schedule.
+//! @author Dominik Arominski
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fmt/format.h>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "errorCodes.hpp"
+#include "errorMessage.hpp"
+#include "nonCopyableNonMovable.hpp"
+#include "warningMessage.hpp"
+
+namespace vslib
+{
+    //! Handle of a typed signal of a SignalFlowGraph, the index of the slot holding its value.
+    //!
+    //! @tparam T Type of the signal, a trivially-copyable type of at most 8 bytes
+    template<typename T>
+    struct Signal
+    {
+        static_assert(
+            std::is_trivially_copyable_v<T> && sizeof(T) <= sizeof(uint64_t),
+            "Signals need to be trivially copyable and at most 8 bytes long."
+        );
+
+        using value_type = T;
+
+        uint16_t slot;   //!< Index of the slot holding the value of the signal
+    };
+
+    //! Execution time of a block of a SignalFlowGraph, in ticks of the counter provided to execute
+    struct BlockTiming
+    {
+        uint64_t last{0};    //!< Duration of the last execution
+        uint64_t worst{0};   //!< Longest duration observed
+    };
+
+    //! Signal-flow graph of Components. Each block calls a step function on a Component, reading its input signals
+    //! and writing its output signals. Once all blocks have been added, build sorts them topologically into a flat
+    //! schedule, so that every block runs after the blocks producing its inputs, whatever the order they have been
+    //! added in. All signals live in a single preallocated, contiguous buffer.
+    //!
+    //! Each entry of the schedule calls a function generated for its block, in which the step function is called
+    //! directly on the concrete type of the Component and can be inlined, without virtual dispatch. Executing the
+    //! graph is a single loop over the schedule, which is also the single point to measure the execution time of
+    //! each block.
+    //!
+    //! @tparam max_blocks Maximal number of blocks
+    //! @tparam max_signals Maximal number of signals
+    //! @tparam max_ports Maximal number of inputs and outputs of a single block
+    template<size_t max_blocks, size_t max_signals, size_t max_ports = 16>
+    class SignalFlowGraph : public NonCopyableNonMovable
+    {
+        static_assert(max_signals < std::numeric_limits<uint16_t>::max(), "Too many signals requested.");
+        static_assert(max_blocks < std::numeric_limits<uint16_t>::max(), "Too many blocks requested.");
+
+        using Slot = uint64_t;   //!< Storage of a single signal
+
+        //! Function calling the step function of a block
+        using Call = void (*)(void* block, Slot* signals, const uint16_t* ports) noexcept;
+
+        constexpr static uint16_t no_block = std::numeric_limits<uint16_t>::max();   //!< Signal without producer
+
+        //! Block of the graph: the call of its step function and the slots of its inputs, followed by its outputs
+        struct Entry
+        {
+            Call                            call;             //!< Function calling the step function
+            void*                           block;            //!< Component the step function is called on
+            uint16_t                        id;               //!< Index of the block in the order of addition
+            uint8_t                         number_inputs;    //!< Number of input signals
+            uint8_t                         number_outputs;   //!< Number of output signals
+            std::array<uint16_t, max_ports> ports;            //!< Slots of the inputs and outputs
+        };
+
+      public:
+        //! Creates a new signal in the buffer of signals.
+        //!
+        //! @param initial_value Value of the signal until it is first written
+        //! @return Handle of the signal
+        template<typename T>
+        [[nodiscard]] Signal<T> createSignal(const T initial_value = T{})
+        {
+            if (m_number_signals == max_signals)
+            {
+                fgc4::utils::Error message(
+                    fmt::format("Signal-flow graph holds at most {} signals.\n", max_signals),
+                    fgc4::utils::errorCodes::allocation_buffer_overflow
+                );
+                throw std::length_error(fmt::format("{}", message));
+            }
+            const Signal<T> signal{static_cast<uint16_t>(m_number_signals++)};
+            write(signal, initial_value);
+            return signal;
+        }
+
+        //! Writes the value of a signal, e.g. a measurement read by the blocks.
+        //!
+        //! @param signal Handle of the signal
+        //! @param value New value of the signal
+        template<typename T>
+        void write(const Signal<T> signal, const T value) noexcept
+        {
+            store(m_signals.data() + signal.slot, value);
+        }
+
+        //! Reads the value of a signal, e.g. a reference computed by the blocks.
+        //!
+        //! @param signal Handle of the signal
+        //! @return Current value of the signal
+        template<typename T>
+        [[nodiscard]] T read(const Signal<T> signal) const noexcept
+        {
+            return load<T>(m_signals.data() + signal.slot);
+        }
+
+        //! Adds a block calling the step function on the provided Component. The step function takes the Component
+        //! and the values of the inputs, and returns the value of the single output, a tuple of the values of several
+        //! outputs, or nothing if there are no outputs. Adding a block discards the schedule built so far.
+        //!
+        //! @tparam step Captureless callable computing the outputs, called directly on the concrete Component type
+        //! @param block Component the step function is called on, expected to outlive the graph
+        //! @param inputs Signals read by the block
+        //! @param outputs Signals written by the block
+        //! @return Identifier of the block, its index in the order of addition
+        template<auto step, typename Block, typename... Inputs, typename... Outputs>
+        size_t addBlock(
+            Block& block, const std::tuple<Signal<Inputs>...> inputs, const std::tuple<Signal<Outputs>...> outputs
+        )
+        {
+            static_assert(
+                std::is_invocable_v<decltype(step), Block&, const Inputs&...>,
+                "The step function needs to take the Component and the input values."
+            );
+            static_assert(sizeof...(Inputs) + sizeof...(Outputs) <= max_ports, "Too many ports of a single block.");
+
+            if (m_number_blocks == max_blocks)
+            {
+                fgc4::utils::Error message(
+                    fmt::format("Signal-flow graph holds at most {} blocks.\n", max_blocks),
+                    fgc4::utils::errorCodes::allocation_buffer_overflow
+                );
+                throw std::length_error(fmt::format("{}", message));
+            }
+
+            Entry& entry         = m_blocks[m_number_blocks];
+            entry.call           = &callStep<step, Block, std::tuple<Inputs...>, std::tuple<Outputs...>>;
+            entry.block          = &block;
+            entry.id             = static_cast<uint16_t>(m_number_blocks);
+            entry.number_inputs  = sizeof...(Inputs);
+            entry.number_outputs = sizeof...(Outputs);
+            std::apply(
+                [&entry](const auto&... signal)
+                {
+                    size_t port = 0;
+                    ((entry.ports[port++] = signal.slot), ...);
+                },
+                std::tuple_cat(inputs, outputs)
+            );
+
+            m_number_scheduled = 0;
+            return m_number_blocks++;
+        }
+
+        //! Sorts the blocks topologically into the execution schedule. Blocks without dependencies between them keep
+        //! the order they have been added in.
+        //!
+        //! @return Warning if a signal has several producers or the blocks form a loop, nothing otherwise
+        std::optional<fgc4::utils::Warning> build()
+        {
+            m_number_scheduled = 0;
+
+            std::array<uint16_t, max_signals> producers;
+            producers.fill(no_block);
+            for (size_t index = 0; index < m_number_blocks; index++)
+            {
+                const Entry& entry = m_blocks[index];
+                for (size_t port = entry.number_inputs; port < entry.number_inputs + entry.number_outputs; port++)
+                {
+                    auto& producer = producers[entry.ports[port]];
+                    if (producer != no_block)
+                    {
+                        return fgc4::utils::Warning(fmt::format(
+                            "Signal {} is written by blocks {} and {}.\n", entry.ports[port], producer, index
+                        ));
+                    }
+                    producer = static_cast<uint16_t>(index);
+                }
+            }
+
+            // number of inputs of each block produced by blocks not scheduled yet
+            std::array<uint16_t, max_blocks> pending{};
+            std::array<bool, max_blocks>     scheduled{};
+            for (size_t index = 0; index < m_number_blocks; index++)
+            {
+                const Entry& entry = m_blocks[index];
+                for (size_t port = 0; port < entry.number_inputs; port++)
+                {
+                    pending[index] += (producers[entry.ports[port]] != no_block);
+                }
+            }
+
+            for (size_t position = 0; position < m_number_blocks; position++)
+            {
+                size_t ready = 0;
+                while (ready < m_number_blocks && (scheduled[ready] || pending[ready] > 0))
+                {
+                    ready++;
+                }
+                if (ready == m_number_blocks)
+                {
+                    return fgc4::utils::Warning(
+                        fmt::format("{} blocks of the signal-flow graph form a loop.\n", m_number_blocks - position)
+                    );
+                }
+
+                scheduled[ready]         = true;
+                m_schedule[position]     = m_blocks[ready];
+                m_positions[ready]       = static_cast<uint16_t>(position);
+                const Entry& ready_entry = m_blocks[ready];
+                for (size_t index = 0; index < m_number_blocks; index++)
+                {
+                    const Entry& entry = m_blocks[index];
+                    for (size_t port = 0; port < entry.number_inputs; port++)
+                    {
+                        pending[index] -= (producers[entry.ports[port]] == ready_entry.id);
+                    }
+                }
+            }
+
+            m_number_scheduled = m_number_blocks;
+            m_timings.fill(BlockTiming{});
+            return {};
+        }
+
+        //! Executes all blocks in the order of the schedule.
+        void execute() noexcept
+        {
+            for (size_t position = 0; position < m_number_scheduled; position++)
+            {
+                const Entry& entry = m_schedule[position];
+                entry.call(entry.block, m_signals.data(), entry.ports.data());
+            }
+        }
+
+        //! Executes all blocks in the order of the schedule, measuring the execution time of each block.
+        //!
+        //! @param counter Callable returning the current value of a monotonic counter, e.g. the CPU cycle counter
+        template<typename Counter>
+        void execute(Counter&& counter) noexcept
+        {
+            uint64_t start = counter();
+            for (size_t position = 0; position < m_number_scheduled; position++)
+            {
+                const Entry& entry = m_schedule[position];
+                entry.call(entry.block, m_signals.data(), entry.ports.data());
+
+                const uint64_t stop   = counter();
+                auto&          timing = m_timings[entry.id];
+                timing.last           = stop - start;
+                timing.worst          = std::max(timing.worst, timing.last);
+                start                 = stop;
+            }
+        }
+
+        //! Provides the execution time of a block, measured by execute with a counter.
+        //!
+        //! @param block Identifier of the block, as returned by addBlock
+        //! @return Last and longest execution times of the block
+        [[nodiscard]] const BlockTiming& timing(const size_t block) const noexcept
+        {
+            return m_timings[block];
+        }
+
+        //! Provides the position of a block in the execution schedule.
+        //!
+        //! @param block Identifier of the block, as returned by addBlock
+        //! @return Index of the block in the schedule, nothing if the schedule has not been built
+        [[nodiscard]] std::optional<size_t> position(const size_t block) const noexcept
+        {
+            if (m_number_scheduled == 0 || block >= m_number_scheduled)
+            {
+                return {};
+            }
+            return m_positions[block];
+        }
+
+        //! Checks whether the execution schedule holds all added blocks.
+        //!
+        //! @return True if build succeeded after the last block has been added, false otherwise
+        [[nodiscard]] bool isBuilt() const noexcept
+        {
+            return m_number_scheduled == m_number_blocks && m_number_blocks > 0;
+        }
+
+        //! Provides the number of added blocks.
+        //!
+        //! @return Number of blocks
+        [[nodiscard]] size_t numberBlocks() const noexcept
+        {
+            return m_number_blocks;
+        }
+
+        //! Provides the number of created signals.
+        //!
+        //! @return Number of signals
+        [[nodiscard]] size_t numberSignals() const noexcept
+        {
+            return m_number_signals;
+        }
+
+      private:
+        alignas(64) std::array<Slot, max_signals> m_signals{};     //!< Values of all signals
+        std::array<Entry, max_blocks>             m_schedule{};    //!< Blocks in the order of execution
+        std::array<Entry, max_blocks>             m_blocks{};      //!< Blocks in the order of addition
+        std::array<uint16_t, max_blocks>          m_positions{};   //!< Position of each block in the schedule
+        std::array<BlockTiming, max_blocks>       m_timings{};     //!< Execution time of each block
+
+        size_t m_number_signals{0};     //!< Number of created signals
+        size_t m_number_blocks{0};      //!< Number of added blocks
+        size_t m_number_scheduled{0};   //!< Number of blocks in the schedule
+
+        //! Reads the value of a signal from its slot.
+        template<typename T>
+        static T load(const Slot* slot) noexcept
+        {
+            T value;
+            std::memcpy(&value, slot, sizeof(T));
+            return value;
+        }
+
+        //! Writes the value of a signal to its slot.
+        template<typename T>
+        static void store(Slot* slot, const T value) noexcept
+        {
+            std::memcpy(slot, &value, sizeof(T));
+        }
+
+        //! Calls the step function of a block on its concrete Component type, reading the inputs from and writing
+        //! the outputs to their slots.
+        //!
+        //! @param block Component the step function is called on
+        //! @param signals Buffer of all signals
+        //! @param ports Slots of the inputs, followed by the slots of the outputs
+        template<auto step, typename Block, typename InputTuple, typename OutputTuple>
+        static void callStep(void* block, Slot* signals, const uint16_t* ports) noexcept
+        {
+            constexpr size_t number_inputs  = std::tuple_size_v<InputTuple>;
+            constexpr size_t number_outputs = std::tuple_size_v<OutputTuple>;
+
+            [&]<size_t... input, size_t... output>(std::index_sequence<input...>, std::index_sequence<output...>)
+            {
+                const auto call = [&]
+                {
+                    return step(
+                        *static_cast<Block*>(block),
+                        load<std::tuple_element_t<input, InputTuple>>(signals + ports[input])...
+                    );
+                };
+
+                if constexpr (number_outputs == 0)
+                {
+                    call();
+                }
+                else if constexpr (number_outputs == 1)
+                {
+                    store<std::tuple_element_t<0, OutputTuple>>(signals + ports[number_inputs], call());
+                }
+                else
+                {
+                    const auto result = call();
+                    (store<std::tuple_element_t<output, OutputTuple>>(
+                         signals + ports[number_inputs + output], std::get<output>(result)
+                     ),
+                     ...);
+                }
+            }(std::make_index_sequence<number_inputs>{}, std::make_index_sequence<number_outputs>{});
+        }
+    };
+}   // namespace vslib
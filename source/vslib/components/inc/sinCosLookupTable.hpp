@@ -0,0 +1,101 @@
+//! @file
+//! @brief Defines the Component class for a look-up table holding both sine and cosine functions.
+//! @author Dominik Arominski
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <numbers>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "component.hpp"
+#include "typeTraits.hpp"
+
+namespace vslib
+{
+    //! Look-up table returning both sine and cosine of the same angle from a single range reduction and a single
+    //! index computation. Both functions are stored as equally-binned arrays over one period, together with the
+    //! difference between consecutive points, so that each interpolation is a multiply-add.
+    template<fgc4::utils::Floating T = double>
+    class SinCosLookupTable : public Component
+    {
+      public:
+        //! Constructor for the SinCosLookupTable Component.
+        //!
+        //! @param name Name of this Component
+        //! @param parent Parent of this Component
+        //! @param number_points Number of sections of each of the functions, covering 0 to 2 pi, consistently with
+        //! SinLookupTable and CosLookupTable
+        SinCosLookupTable(std::string_view name, Component& parent, const size_t number_points)
+            : Component("SinCosLookupTable", name, parent)
+        {
+            assert(number_points >= 1);
+
+            const size_t number_sections = number_points;
+            const double sections        = static_cast<double>(number_sections);
+            m_sections_per_radian        = static_cast<T>(sections / (2.0 * std::numbers::pi));
+
+            m_sin.resize(number_sections + 1);
+            m_cos.resize(number_sections + 1);
+            for (size_t index = 0; index <= number_sections; index++)
+            {
+                // the table is always evaluated in double precision and only then rounded to T
+                const double x = 2.0 * std::numbers::pi * static_cast<double>(index) / sections;
+                m_sin[index]   = static_cast<T>(std::sin(x));
+                m_cos[index]   = static_cast<T>(std::cos(x));
+            }
+
+            m_sin_slopes.resize(number_sections);
+            m_cos_slopes.resize(number_sections);
+            for (size_t index = 0; index < number_sections; index++)
+            {
+                m_sin_slopes[index] = m_sin[index + 1] - m_sin[index];
+                m_cos_slopes[index] = m_cos[index + 1] - m_cos[index];
+            }
+        }
+
+        //! Interpolates sine and cosine of the provided angle.
+        //!
+        //! @param input_x Angle in radians, brought back to the 0 to 2 pi range if outside of it
+        //! @return Pair of interpolated sine and cosine values
+        [[nodiscard]] std::pair<T, T> interpolate(T input_x) noexcept
+        {
+            constexpr T period = std::numbers::pi_v<T> * 2;
+            if (input_x < 0 || input_x >= period)
+            {
+                input_x = std::fmod(input_x, period);
+                if (input_x < 0)
+                {
+                    input_x += period;
+                }
+            }
+
+            const T position = input_x * m_sections_per_radian;
+            // rounding of the position can only point past the last section, never before the first one
+            const size_t index    = std::min(static_cast<size_t>(position), m_sin_slopes.size() - 1);
+            const T      fraction = position - static_cast<T>(index);
+            return {m_sin[index] + fraction * m_sin_slopes[index], m_cos[index] + fraction * m_cos_slopes[index]};
+        }
+
+        //! Provides intuitive interaction with the underlying table.
+        //!
+        //! @param input_x Angle in radians
+        //! @return Pair of interpolated sine and cosine values
+        [[nodiscard]] std::pair<T, T> operator()(const T input_x) noexcept
+        {
+            return interpolate(input_x);
+        }
+
+      private:
+        std::vector<T> m_sin;          //!< Sine values over one period
+        std::vector<T> m_cos;          //!< Cosine values over one period
+        std::vector<T> m_sin_slopes;   //!< Difference between consecutive sine values, per section
+        std::vector<T> m_cos_slopes;   //!< Difference between consecutive cosine values, per section
+
+        T m_sections_per_radian;   //!< Reciprocal of the section width, to index the table with a multiplication
+    };
+}   // namespace vslib
@@ -8,12 +8,16 @@
 #include <tuple>
 
 #include "abcToDq0Transform.hpp"
+#include "bankedValue.hpp"
 #include "component.hpp"
 #include "parameter.hpp"
+#include "phaseAccumulator.hpp"
 #include "pid.hpp"
+#include "typeTraits.hpp"
 
 namespace vslib
 {
+    template<fgc4::utils::Floating T = double>
     class SRFPLL : public Component
     {
       public:
@@ -38,8 +42,7 @@ namespace vslib
         //! @param b B-phase component of the three-phase system
         //! @param c C-phase component of the three-phase system
         //! @return Pair with balanced angle (omega t), that always fits in 0 to 2pi, d, and q
-        [[nodiscard]] std::tuple<double, double, double>
-        synchroniseWithDQ(const double f_a, const double f_b, const double f_c) noexcept;
+        [[nodiscard]] std::tuple<T, T, T> synchroniseWithDQ(const T f_a, const T f_b, const T f_c) noexcept;
 
         //! Computes one iteration of the the PLL synchronisation and returns wt.
         //!
@@ -47,7 +50,7 @@ namespace vslib
         //! @param b B-phase component of the three-phase system
         //! @param c C-phase component of the three-phase system
         //! @return Balanced angle (omega t), always fits in 0 to 2pi values
-        [[nodiscard]] double synchronise(const double f_a, const double f_b, const double f_c) noexcept;
+        [[nodiscard]] T synchronise(const T f_a, const T f_b, const T f_c) noexcept;
 
         //! Resets the controller to the initial state by zeroing the history.
         void reset() noexcept;
@@ -61,8 +64,8 @@ namespace vslib
         // ************************************************************
         // Components owned by this Component
 
-        AbcToDq0Transform abc_2_dq0;   //!< abc to dq0 transform part of the SRF PLL
-        PID               pi;          //!< PI controller part of the SRF PLL
+        AbcToDq0Transform<T> abc_2_dq0;   //!< abc to dq0 transform part of the SRF PLL
+        PID<T>               pi;          //!< PI controller part of the SRF PLL
 
         // ************************************************************
 
@@ -73,8 +76,14 @@ namespace vslib
         std::optional<fgc4::utils::Warning> verifyParameters() override;
 
       private:
-        double m_wt{0.0};             // Returned wt value of the PLL
-        double m_angle_offset{0.0};   // Angular offset of the PLL output
-        double m_f_rated_2pi{0.0};    // 2 pi * f_rated * (Euler step size)
+        //! Values derived from the Parameters
+        struct Derived
+        {
+            T f_rated_2pi{0.0};    //!< 2 pi * f_rated * (Euler step size)
+            T angle_offset{0.0};   //!< Angular offset of the PLL output
+        };
+
+        PhaseAccumulator     m_phase;       // Returned wt value of the PLL
+        BankedValue<Derived> m_derived{};   // Values derived from the Parameters, per bank
     };
 }   // namespace vslib
@@ -12,14 +12,18 @@ namespace vslib
         constexpr double two_over_3    = 2.0 * one_over_3;
     }
 
-    [[nodiscard]] std::tuple<double, double, double>
-    AbcToAlphaBetaTransform::transform(const double f_a, const double f_b, const double f_c) const noexcept
+    template<fgc4::utils::Floating T>
+    [[nodiscard]] std::tuple<T, T, T>
+    AbcToAlphaBetaTransform<T>::transform(const T f_a, const T f_b, const T f_c) const noexcept
     {
-        const double f_alpha = two_over_3 * (f_a - 0.5 * (f_b + f_c));
-        const double f_beta  = sqrt_3_over_3 * (f_b - f_c);
-        const double f_0     = one_over_3 * (f_a + f_b + f_c);
+        const T f_alpha = static_cast<T>(two_over_3) * (f_a - T{0.5} * (f_b + f_c));
+        const T f_beta  = static_cast<T>(sqrt_3_over_3) * (f_b - f_c);
+        const T f_0     = static_cast<T>(one_over_3) * (f_a + f_b + f_c);
 
         return {f_alpha, f_beta, f_0};
     }
 
-}   // namespace vslib
\ No newline at end of file
+    template class AbcToAlphaBetaTransform<double>;
+    template class AbcToAlphaBetaTransform<float>;
+
+}   // namespace vslib
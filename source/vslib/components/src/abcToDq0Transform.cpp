@@ -5,11 +5,11 @@
 
 namespace vslib
 {
-    [[nodiscard]] std::tuple<double, double, double> AbcToDq0Transform::transform(
-        const double f_a, const double f_b, const double f_c, const double wt, const double offset
-    ) noexcept
+    template<fgc4::utils::Floating T>
+    [[nodiscard]] std::tuple<T, T, T>
+    AbcToDq0Transform<T>::transform(const T f_a, const T f_b, const T f_c, const T wt, const T offset) noexcept
     {
-        const double theta = wt + offset;
+        const T theta = wt + offset;
         // this two-step calculation was found to be almost 50% more performant than a direct calculation
         // from abc to dq0, due to fewer lookups to the sine and cosine tables.
 
@@ -21,4 +21,7 @@ namespace vslib
         return {d, q, zero};
     }
 
-}   // namespace vslib
\ No newline at end of file
+    template class AbcToDq0Transform<double>;
+    template class AbcToDq0Transform<float>;
+
+}   // namespace vslib
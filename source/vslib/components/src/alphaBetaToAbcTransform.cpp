@@ -5,16 +5,20 @@
 
 namespace vslib
 {
-    [[nodiscard]] std::tuple<double, double, double>
-    AlphaBetaToAbcTransform::transform(const double f_alpha, const double f_beta, const double f_zero) const noexcept
+    template<fgc4::utils::Floating T>
+    [[nodiscard]] std::tuple<T, T, T>
+    AlphaBetaToAbcTransform<T>::transform(const T f_alpha, const T f_beta, const T f_zero) const noexcept
     {
-        constexpr static double sqrt_3_over_2 = 0.5 * std::numbers::sqrt3;
+        constexpr static T sqrt_3_over_2 = T{0.5} * std::numbers::sqrt3_v<T>;
 
-        const double f_a = f_alpha + f_zero;
-        const double f_b = -0.5 * f_alpha + sqrt_3_over_2 * f_beta + f_zero;
-        const double f_c = -0.5 * f_alpha - sqrt_3_over_2 * f_beta + f_zero;
+        const T f_a = f_alpha + f_zero;
+        const T f_b = -T{0.5} * f_alpha + sqrt_3_over_2 * f_beta + f_zero;
+        const T f_c = -T{0.5} * f_alpha - sqrt_3_over_2 * f_beta + f_zero;
 
         return {f_a, f_b, f_c};
     }
 
-}   // namespace vslib
\ No newline at end of file
+    template class AlphaBetaToAbcTransform<double>;
+    template class AlphaBetaToAbcTransform<float>;
+
+}   // namespace vslib
@@ -5,11 +5,11 @@
 
 namespace vslib
 {
-    [[nodiscard]] std::tuple<double, double, double> Dq0ToAbcTransform::transform(
-        const double d, const double q, const double zero, const double wt, const double offset
-    ) noexcept
+    template<fgc4::utils::Floating T>
+    [[nodiscard]] std::tuple<T, T, T>
+    Dq0ToAbcTransform<T>::transform(const T d, const T q, const T zero, const T wt, const T offset) noexcept
     {
-        const double theta = wt + offset;
+        const T theta = wt + offset;
 
         constexpr bool a_axis_alignment
             = false;   //! alignment between A-axis and d-axis, false: A axis is 90 degrees behind
@@ -19,4 +19,7 @@ namespace vslib
         return {a, b, c};
     }
 
-}   // namespace vslib
\ No newline at end of file
+    template class Dq0ToAbcTransform<double>;
+    template class Dq0ToAbcTransform<float>;
+
+}   // namespace vslib
@@ -5,17 +5,20 @@
 namespace vslib
 {
 
-    [[nodiscard]] std::tuple<double, double, double> Dq0ToAlphaBetaTransform::transform(
-        const double d, const double q, const double zero, const double theta, const bool a_alignment
+    template<fgc4::utils::Floating T>
+    [[nodiscard]] std::tuple<T, T, T> Dq0ToAlphaBetaTransform<T>::transform(
+        const T d, const T q, const T zero, const T theta, const bool a_alignment
     ) noexcept
     {
-        const double sin_theta = m_sin(theta);
-        const double cos_theta = m_cos(theta);
+        const auto [sin_theta, cos_theta] = m_sin_cos(theta);
 
-        const double alpha = a_alignment ? d * cos_theta - q * sin_theta : d * sin_theta + q * cos_theta;
-        const double beta  = a_alignment ? d * sin_theta + q * cos_theta : -d * cos_theta + q * sin_theta;
+        const T alpha = a_alignment ? d * cos_theta - q * sin_theta : d * sin_theta + q * cos_theta;
+        const T beta  = a_alignment ? d * sin_theta + q * cos_theta : -d * cos_theta + q * sin_theta;
 
         return {alpha, beta, zero};
     }
 
-}   // namespace vslib
\ No newline at end of file
+    template class Dq0ToAlphaBetaTransform<double>;
+    template class Dq0ToAlphaBetaTransform<float>;
+
+}   // namespace vslib
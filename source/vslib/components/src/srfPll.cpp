@@ -2,38 +2,46 @@
 
 namespace vslib
 {
-    [[nodiscard]] std::tuple<double, double, double>
-    SRFPLL::synchroniseWithDQ(const double f_a, const double f_b, const double f_c) noexcept
+    template<fgc4::utils::Floating T>
+    [[nodiscard]] std::tuple<T, T, T> SRFPLL<T>::synchroniseWithDQ(const T f_a, const T f_b, const T f_c) noexcept
     {
-        const auto [d, q, zero] = abc_2_dq0.transform(f_a, f_b, f_c, m_wt);
+        const auto wt           = m_phase.toRadians<T>();
+        const auto [d, q, zero] = abc_2_dq0.transform(f_a, f_b, f_c, wt);
 
         // for consistency with Matlab, forward-Euler method is used instead of trapezoid
-        // integration
-        const auto wt = m_wt;
-        // reference of the PI controller is always zero
-        m_wt          += pi.control(0.0, -q) * pi.T + m_f_rated_2pi;
-        // to avoid precision loss, the wt is limited to 0-2pi range
-        m_wt          = fmod(m_wt, std::numbers::pi_v<double> * 2.0);
+        // integration, reference of the PI controller is always zero
+        // the accumulator wraps around at 2pi on its own, so the angle never loses precision
+        const auto& [f_rated_2pi, offset] = m_derived.value();
+        m_phase.advance(pi.control(0.0, -q) * pi.T + f_rated_2pi);
 
-        return {wt + m_angle_offset, d, q};
+        return {wt + offset, d, q};
     }
 
-    [[nodiscard]] double SRFPLL::synchronise(const double f_a, const double f_b, const double f_c) noexcept
+    template<fgc4::utils::Floating T>
+    [[nodiscard]] T SRFPLL<T>::synchronise(const T f_a, const T f_b, const T f_c) noexcept
     {
         const auto [wt, d, q] = synchroniseWithDQ(f_a, f_b, f_c);
         return wt;
     }
 
-    void SRFPLL::reset() noexcept
+    template<fgc4::utils::Floating T>
+    void SRFPLL<T>::reset() noexcept
     {
-        m_wt = 0;
+        m_phase.reset();
         pi.reset();
     }
 
-    std::optional<fgc4::utils::Warning> SRFPLL::verifyParameters()
+    template<fgc4::utils::Floating T>
+    std::optional<fgc4::utils::Warning> SRFPLL<T>::verifyParameters()
     {
-        m_f_rated_2pi  = {2.0 * std::numbers::pi * f_rated.toValidate() * pi.T};
-        m_angle_offset = angle_offset.toValidate();
+        // the control period is taken from the bank being loaded as well
+        m_derived.set(
+            {static_cast<T>(2.0 * std::numbers::pi * f_rated.toValidate() * pi.T.toValidate()),
+             static_cast<T>(angle_offset.toValidate())}
+        );
         return {};
     }
-}   // namespace vslib
\ No newline at end of file
+
+    template class SRFPLL<double>;
+    template class SRFPLL<float>;
+}   // namespace vslib
@@ -41,11 +41,7 @@ TEST_F(AbcToDq0TransformTest, Construction)
         serialized["components"].dump(),
         "[{\"name\":\"abc_to_alphabeta\",\"type\":\"AbcToAlphaBetaTransform\",\"parameters\":[],\"components\":[]},{"
         "\"name\":\"alphabeta_to_dq0\",\"type\":\"AlphaBetaToDq0Transform\",\"parameters\":[],\"components\":[{"
-        "\"name\":"
-        "\"sin\",\"type\":\"SinLookupTable\",\"parameters\":[],\"components\":[{\"name\":\"data\",\"type\":"
-        "\"LookupTable\",\"parameters\":[],\"components\":[]}]},{\"name\":\"cos\",\"type\":\"CosLookupTable\","
-        "\"parameters\":[],\"components\":[{\"name\":\"data\",\"type\":\"LookupTable\",\"parameters\":[],"
-        "\"components\":[]}]}]}]"
+        "\"name\":\"sin_cos\",\"type\":\"SinCosLookupTable\",\"parameters\":[],\"components\":[]}]}]"
     );
     EXPECT_EQ(serialized["parameters"].size(), 0);
 }
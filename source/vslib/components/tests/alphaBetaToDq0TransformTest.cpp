@@ -36,13 +36,10 @@ TEST_F(AlphaBetaToDq0TransformTest, Construction)
     auto serialized = transform.serialize();
     EXPECT_EQ(serialized["name"], name);
     EXPECT_EQ(serialized["type"], "AlphaBetaToDq0Transform");
-    EXPECT_EQ(serialized["components"].size(), 2);
+    EXPECT_EQ(serialized["components"].size(), 1);
     EXPECT_EQ(
         serialized["components"].dump(),
-        "[{\"name\":\"sin\",\"type\":\"SinLookupTable\",\"parameters\":[],\"components\":[{\"name\":\"data\",\"type\":"
-        "\"LookupTable\",\"parameters\":[],\"components\":[]}]},{\"name\":\"cos\",\"type\":\"CosLookupTable\","
-        "\"parameters\":[],\"components\":[{\"name\":\"data\",\"type\":\"LookupTable\",\"parameters\":[],"
-        "\"components\":[]}]}]"
+        "[{\"name\":\"sin_cos\",\"type\":\"SinCosLookupTable\",\"parameters\":[],\"components\":[]}]"
     );
     EXPECT_EQ(serialized["parameters"].size(), 0);
 }
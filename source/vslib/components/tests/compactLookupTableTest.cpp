@@ -0,0 +1,160 @@
+//! @file
+//! @brief File with unit tests of CompactLookupTable component.
+//! @author Dominik Arominski
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <numbers>
+#include <vector>
+
+#include "compactLookupTable.hpp"
+#include "mockRoot.hpp"
+
+using namespace vslib;
+
+class CompactLookupTableTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+    }
+};
+
+//! Tests default construction of CompactLookupTable component
+TEST_F(CompactLookupTableTest, CompactLookupTableDefault)
+{
+    MockRoot                               root;
+    std::string                            name = "table";
+    std::vector<std::pair<double, double>> values{{0, 0}, {1, 1}, {2, 2}, {3, 3}};
+    CompactLookupTable<double>             table(name, root, std::move(values));
+    EXPECT_EQ(table.getName(), name);
+    EXPECT_EQ(table.size(), 4);
+
+    auto serialized = table.serialize();
+    EXPECT_EQ(serialized["name"], name);
+    EXPECT_EQ(serialized["type"], "CompactLookupTable");
+    EXPECT_EQ(serialized["components"], nlohmann::json::array());
+    EXPECT_EQ(serialized["parameters"].size(), 0);
+}
+
+//! Tests that the slopes of all sections are precomputed on construction
+TEST_F(CompactLookupTableTest, CompactLookupTableSlopes)
+{
+    MockRoot                               root;
+    std::vector<std::pair<double, double>> values{{0.0, 1.0}, {0.5, 2.0}, {2.5, 1.0}};
+    CompactLookupTable<double>             table("table", root, std::move(values));
+    ASSERT_EQ(table.getSlopes().size(), 2);
+    EXPECT_DOUBLE_EQ(table.getSlopes()[0], 2.0);
+    EXPECT_DOUBLE_EQ(table.getSlopes()[1], -0.5);
+
+    // equally-binned tables store slopes per bin
+    std::vector<std::pair<double, double>> binned_values{{0.0, 1.0}, {0.5, 2.0}, {1.0, 1.0}};
+    CompactLookupTable<double>             binned_table("binned_table", root, std::move(binned_values), true);
+    EXPECT_DOUBLE_EQ(binned_table.getSlopes()[0], 1.0);
+    EXPECT_DOUBLE_EQ(binned_table.getSlopes()[1], -1.0);
+}
+
+//! Tests CompactLookupTable component with a meaningful table and interpolating with the input being somewhere
+//! between the data points, in both directions
+TEST_F(CompactLookupTableTest, CompactLookupTableInterpolateBetweenPoints)
+{
+    MockRoot                               root;
+    std::string                            name = "table";
+    std::vector<std::pair<double, double>> values{{-3.0, 3.3}, {-2.0, 2.3}, {-1.0, 1.3}, {0.0, 0.3}, {4.0, -0.3}};
+    CompactLookupTable<double>             table(name, root, std::move(values));
+
+    EXPECT_NEAR(table.interpolate(-2.5), 0.5 * (3.3 + 2.3), 1e-15);
+    EXPECT_NEAR(table.interpolate(-1.5), 0.5 * (2.3 + 1.3), 1e-15);
+    EXPECT_NEAR(table.interpolate(2.0), 0.5 * (0.3 - 0.3), 1e-15);
+
+    // and check that nothing goes wrong if we do the same in reverse order:
+    EXPECT_NEAR(table.interpolate(2.0), 0.5 * (0.3 - 0.3), 1e-15);
+    EXPECT_NEAR(table.interpolate(-1.5), 0.5 * (2.3 + 1.3), 1e-15);
+    EXPECT_NEAR(table.interpolate(-2.5), 0.5 * (3.3 + 2.3), 1e-15);
+}
+
+//! Tests equally-binned CompactLookupTable component hitting the data points and interpolating between them
+TEST_F(CompactLookupTableTest, CompactLookupTableConstantBinning)
+{
+    MockRoot                               root;
+    std::string                            name = "table";
+    std::vector<std::pair<double, double>> values{{0.0, 3.3}, {0.25, 2.3}, {0.5, 1.3}, {0.75, 0.3}, {1.0, -0.3}};
+    CompactLookupTable<double>             table(name, root, std::move(values), true);
+
+    EXPECT_NEAR(table.interpolate(0.25), 2.3, 1e-15);
+    EXPECT_NEAR(table.interpolate(0.5), 1.3, 1e-15);
+    EXPECT_NEAR(table.interpolate(0.125), 0.5 * (3.3 + 2.3), 1e-15);
+    EXPECT_NEAR(table.interpolate(0.875), 0.5 * (0.3 - 0.3), 1e-15);
+    EXPECT_NEAR(table.interpolate(0.375), 0.5 * (2.3 + 1.3), 1e-15);
+}
+
+//! Tests CompactLookupTable provides the expected saturation behaviour when the input is outside the data limits
+TEST_F(CompactLookupTableTest, CompactLookupTableInterpolateOutsideLimits)
+{
+    MockRoot                               root;
+    std::vector<std::pair<double, double>> values{{-3, 3}, {-2, 2}, {-1, 1}, {0, 0}};
+    CompactLookupTable<double>             table("table", root, std::move(values));
+
+    EXPECT_EQ(table.interpolate(-4), 3);
+    EXPECT_EQ(table.interpolate(-100), 3);
+    EXPECT_EQ(table.interpolate(0), 0);
+    EXPECT_EQ(table.interpolate(100), 0);
+}
+
+//! Tests CompactLookupTable provides the expected output regardless whether the switch for random access is true
+TEST_F(CompactLookupTableTest, CompactLookupTableRandomAccessConsistency)
+{
+    MockRoot                               root;
+    std::vector<std::pair<double, double>> values{{-3, 3}, {-2, 2.5}, {-1, 1}, {0, 0.5}, {0.5, 0}};
+    CompactLookupTable<double>             table("table", root, std::move(values));
+
+    for (const double input : {-3.5, -1.5, 0.25, -2.0, -2.75, 0.0, -0.5, -1.0})
+    {
+        EXPECT_EQ(table.interpolate(input), table.interpolate(input, true));
+    }
+}
+
+//! Tests that the reset of CompactLookupTable does not change the interpolated values
+TEST_F(CompactLookupTableTest, CompactLookupTableReset)
+{
+    MockRoot                               root;
+    std::vector<std::pair<double, double>> values{{-3, 3.3}, {-2, 2.2}, {-1, 1.1}, {0, 0}};
+    CompactLookupTable<double>             table("table", root, std::move(values));
+
+    const double before_reset = table.interpolate(-0.5);
+    table.reset();
+    EXPECT_EQ(table.interpolate(-0.5), before_reset);
+}
+
+//! Tests CompactLookupTable interpolating a sine tabulated with non-uniform binning, for monotonic and random access
+TEST_F(CompactLookupTableTest, CompactLookupTableSineAccuracy)
+{
+    constexpr size_t                       number_points = 1000;
+    std::vector<std::pair<double, double>> values(number_points);
+    for (size_t index = 0; index < number_points; index++)
+    {
+        // bins are denser around the zero-crossings
+        const double uniform = 2.0 * std::numbers::pi * index / (number_points - 1);
+        const double x       = uniform - 0.5 * std::sin(uniform);
+        values[index]        = {x, std::sin(x)};
+    }
+    MockRoot                   root;
+    CompactLookupTable<double> table("table", root, std::move(values));
+
+    // the interpolation error of the sine is bounded by the squared bin size over 8, which is about 5e-6
+    constexpr size_t number_inputs = 10'000;
+    for (size_t index = 0; index < number_inputs; index++)
+    {
+        const double input = 2.0 * std::numbers::pi * index / number_inputs;
+        EXPECT_NEAR(table.interpolate(input), std::sin(input), 1e-5);
+    }
+    for (size_t index = 0; index < number_inputs; index++)
+    {
+        const double input = 2.0 * std::numbers::pi * ((index * 7919) % number_inputs) / number_inputs;
+        EXPECT_NEAR(table.interpolate(input, true), std::sin(input), 1e-5);
+    }
+}
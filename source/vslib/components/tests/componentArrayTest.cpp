@@ -3,6 +3,7 @@
 //! @author Dominik Arominski
 
 #include <gtest/gtest.h>
+#include <vector>
 
 #include "component.hpp"
 #include "componentArray.hpp"
@@ -32,6 +33,26 @@ class Derived : public Component
     }
 };
 
+//! Component recording its setting and the order of destruction of all its instances
+class Recorder : public Component
+{
+  public:
+    Recorder(std::string_view name, Component& parent, const int initial_setting)
+        : Component("Recorder", name, parent),
+          setting(initial_setting)
+    {
+    }
+
+    ~Recorder() override
+    {
+        destroyed.push_back(std::string(getName()));
+    }
+
+    int setting;
+
+    inline static std::vector<std::string> destroyed{};
+};
+
 //! Checks that a basic component array holding simple derived component class can be created and is correctly
 //! serialized
 TEST_F(ComponentArrayTest, BasicArray)
@@ -106,3 +127,57 @@ TEST_F(ComponentArrayTest, HierarchicalArrayTest)
     EXPECT_EQ(serialized_component["components"][0]["components"][0]["parameters"], nlohmann::json::array());
     EXPECT_EQ(serialized_component["components"][0]["components"][0]["components"].size(), 0);
 }
+
+//! Checks that the held Components are stored contiguously and constructed with the forwarded settings
+TEST_F(ComponentArrayTest, ContiguousStorage)
+{
+    MockRoot                    root;
+    ComponentArray<Recorder, 3> component("array", root, 7);
+
+    EXPECT_EQ(component.size(), 3);
+    EXPECT_EQ(component.data(), &component[0]);
+    EXPECT_EQ(&component[1], &component[0] + 1);
+    EXPECT_EQ(&component[2], &component[0] + 2);
+    EXPECT_EQ(component.end() - component.begin(), 3);
+    for (const auto& element : component)
+    {
+        EXPECT_EQ(element.setting, 7);
+    }
+
+    // children are registered in order, with their in-place addresses
+    const auto& children = component.getChildren();
+    ASSERT_EQ(children.size(), 3);
+    EXPECT_EQ(&children[1].get(), &component[1]);
+}
+
+//! Checks that forEach visits all held Components in order and allows to modify them
+TEST_F(ComponentArrayTest, ForEach)
+{
+    MockRoot                    root;
+    ComponentArray<Recorder, 4> component("array", root, 0);
+
+    int counter = 0;
+    component.forEach(
+        [&counter](Recorder& element)
+        {
+            element.setting = counter++;
+        }
+    );
+    EXPECT_EQ(counter, 4);
+    EXPECT_EQ(component[0].setting, 0);
+    EXPECT_EQ(component[3].setting, 3);
+
+    component[2].setting = 10;
+    EXPECT_EQ(component[2].setting, 10);
+}
+
+//! Checks that the held Components are destroyed in the reverse order of their construction
+TEST_F(ComponentArrayTest, DestructionOrder)
+{
+    Recorder::destroyed.clear();
+    {
+        MockRoot                    root;
+        ComponentArray<Recorder, 3> component("array", root, 0);
+    }
+    EXPECT_EQ(Recorder::destroyed, (std::vector<std::string>{"array[2]", "array[1]", "array[0]"}));
+}
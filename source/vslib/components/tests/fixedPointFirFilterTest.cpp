@@ -0,0 +1,127 @@
+//! @file
+//! @brief File with unit tests of FixedPointFIRFilter class.
+//! @author Dominik Arominski
+
+#include <filesystem>
+#include <gtest/gtest.h>
+
+#include "csv.hpp"
+#include "firFilter.hpp"
+#include "fixedPointFirFilter.hpp"
+#include "mockRoot.hpp"
+#include "staticJson.hpp"
+
+using namespace vslib;
+using namespace csv;
+
+class FixedPointFIRFilterTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+        ParameterRegistry& parameter_registry = ParameterRegistry::instance();
+        parameter_registry.clearRegistry();
+    }
+
+    template<typename FilterType, size_t N>
+    std::optional<fgc4::utils::Warning> setValues(FilterType& filter, const std::array<double, N>& parameter_values)
+    {
+        StaticJson values = parameter_values;
+        filter.coefficients.setJsonValue(values);
+        auto maybe_warning = filter.verifyParameters();
+        filter.flipBufferState();
+        filter.coefficients.syncWriteBuffer();
+        return maybe_warning;
+    }
+};
+
+//! Checks that a FixedPointFIRFilter object can be constructed
+TEST_F(FixedPointFIRFilterTest, FilterDefaultConstruction)
+{
+    MockRoot               root;
+    FixedPointFIRFilter<2> filter("filter", root);
+    EXPECT_EQ(filter.getName(), "filter");
+    EXPECT_EQ(filter.getAccumulatorHeadroom(), 0);
+    EXPECT_EQ(filter.getOutputHeadroom(), 0);
+}
+
+//! Checks that a FixedPointFIRFilter object filters raw integer codes as expected
+TEST_F(FixedPointFIRFilterTest, FilterRawValues)
+{
+    MockRoot               root;
+    FixedPointFIRFilter<1> filter("filter", root);
+    std::array<double, 2>  coefficient_array{0.25, 0.75};
+    ASSERT_FALSE(setValues(filter, coefficient_array).has_value());
+    EXPECT_EQ(filter.getAccumulatorHeadroom(), 2);
+    EXPECT_EQ(filter.getOutputHeadroom(), 0);
+
+    using DataType = FixedPointFIRFilter<1>::DataType;
+    EXPECT_EQ(filter.filter(DataType::fromRaw(1000)).value(), 250);
+    EXPECT_EQ(filter.filter(DataType::fromRaw(1000)).value(), 1000);
+    EXPECT_EQ(filter.filter(DataType::fromRaw(-2)).value(), 750);   // 749.5 is rounded half up
+}
+
+//! Checks that the output saturates at the limits of the data type instead of wrapping around
+TEST_F(FixedPointFIRFilterTest, FilterSaturates)
+{
+    MockRoot               root;
+    FixedPointFIRFilter<1> filter("filter", root);
+    std::array<double, 2>  coefficient_array{1.0, 1.0};
+    ASSERT_FALSE(setValues(filter, coefficient_array).has_value());
+    EXPECT_EQ(filter.getAccumulatorHeadroom(), 1);
+    EXPECT_EQ(filter.getOutputHeadroom(), -1);
+
+    using DataType            = FixedPointFIRFilter<1>::DataType;
+    constexpr int32_t maximum = std::numeric_limits<int32_t>::max();
+    constexpr int32_t minimum = std::numeric_limits<int32_t>::min();
+    std::ignore               = filter.filter(DataType::fromRaw(maximum));
+    EXPECT_EQ(filter.filter(DataType::fromRaw(maximum)).value(), maximum);
+    std::ignore = filter.filter(DataType::fromRaw(minimum));
+    EXPECT_EQ(filter.filter(DataType::fromRaw(minimum)).value(), minimum);
+}
+
+//! Checks that coefficients which cannot be represented in the Q-format of the filter are rejected
+TEST_F(FixedPointFIRFilterTest, FilterUnrepresentableCoefficient)
+{
+    MockRoot               root;
+    FixedPointFIRFilter<2> filter("filter", root);
+    std::array<double, 3>  coefficient_array{0.5, 2.5, 0.5};   // Q1.30 ranges from -2 to 2
+    const auto             maybe_warning = setValues(filter, coefficient_array);
+    ASSERT_TRUE(maybe_warning.has_value());
+    EXPECT_EQ(
+        maybe_warning.value().warning_str,
+        "filter: coefficient 1 (2.5) cannot be represented with 30 fractional bits.\n"
+    );
+}
+
+//! Checks that a FixedPointFIRFilter object follows the floating-point FIRFilter on the GPS power converter
+//! B measurement
+TEST_F(FixedPointFIRFilterTest, FilterThirdOrderBMeas)
+{
+    MockRoot                                  root;
+    constexpr int                             filter_order  = 3;
+    constexpr int                             filter_length = filter_order + 1;
+    FIRFilter<filter_order>                   reference_filter("reference", root);
+    FixedPointFIRFilter<filter_order, 30, 16> filter("filter", root);
+    std::array<double, filter_length>         coefficient_array{0.01674, 0.48326, 0.48326, 0.01674};
+    setValues(reference_filter, coefficient_array);
+    ASSERT_FALSE(setValues(filter, coefficient_array).has_value());
+
+    std::filesystem::path inputs_path
+        = "components/inputs/RPACZ.197.YGPS.RDS.3000.B_MEAS_2020-10-08_14-06-11_shortened.csv";
+
+    CSVFormat format;
+    format.header_row(-1);   // Disables header handling
+    CSVReader inputs_file(inputs_path.c_str(), format);
+
+    using DataType = FixedPointFIRFilter<filter_order, 30, 16>::DataType;
+    for (auto& line : inputs_file)
+    {
+        const auto input_value = line[0].get<double>();
+        EXPECT_NEAR(filter.filter(DataType(input_value)).toDouble(), reference_filter.filter(input_value), 1e-4);
+    }
+}
@@ -0,0 +1,126 @@
+//! @file
+//! @brief File with unit tests of FixedPointIIRFilter class.
+//! @author Dominik Arominski
+
+#include <filesystem>
+#include <gtest/gtest.h>
+
+#include "csv.hpp"
+#include "fixedPointIirFilter.hpp"
+#include "iirFilter.hpp"
+#include "mockRoot.hpp"
+#include "staticJson.hpp"
+
+using namespace vslib;
+using namespace csv;
+
+class FixedPointIIRFilterTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+        ParameterRegistry& parameter_registry = ParameterRegistry::instance();
+        parameter_registry.clearRegistry();
+    }
+
+    //! Helper method to set both numerator and denominator values
+    template<typename FilterType, size_t N>
+    std::optional<fgc4::utils::Warning> setValues(
+        FilterType& filter, const std::array<double, N>& numerator_values,
+        const std::array<double, N>& denominator_values
+    )
+    {
+        StaticJson numerator   = numerator_values;
+        StaticJson denominator = denominator_values;
+        filter.numerator.setJsonValue(numerator);
+        filter.denominator.setJsonValue(denominator);
+        auto maybe_warning = filter.verifyParameters();
+        filter.flipBufferState();
+        filter.numerator.syncWriteBuffer();
+        filter.denominator.syncWriteBuffer();
+        return maybe_warning;
+    }
+};
+
+//! Checks that a FixedPointIIRFilter object can be constructed
+TEST_F(FixedPointIIRFilterTest, FilterDefaultConstruction)
+{
+    MockRoot               root;
+    FixedPointIIRFilter<2> filter("filter", root);
+    EXPECT_EQ(filter.getName(), "filter");
+    EXPECT_EQ(filter.getAccumulatorHeadroom(), 0);
+    EXPECT_EQ(filter.getOutputHeadroom(), 0);
+}
+
+//! Checks that a first-order FixedPointIIRFilter object filters raw integer codes as expected
+TEST_F(FixedPointIIRFilterTest, FirstOrderFilterRawValues)
+{
+    MockRoot               root;
+    FixedPointIIRFilter<1> filter("filter", root);
+    ASSERT_FALSE(setValues(filter, std::array<double, 2>{0.5, 0.0}, std::array<double, 2>{1.0, -0.5}).has_value());
+    EXPECT_EQ(filter.getOutputHeadroom(), 0);
+
+    using DataType = FixedPointIIRFilter<1>::DataType;
+    EXPECT_EQ(filter.filter(DataType::fromRaw(1024)).value(), 512);
+    EXPECT_EQ(filter.filter(DataType::fromRaw(1024)).value(), 768);
+    EXPECT_EQ(filter.filter(DataType::fromRaw(1024)).value(), 896);
+    EXPECT_EQ(filter.filter(DataType::fromRaw(0)).value(), 448);
+}
+
+//! Checks that the gain of a resonant filter is reflected in the output headroom
+TEST_F(FixedPointIIRFilterTest, ResonantFilterOutputHeadroom)
+{
+    MockRoot               root;
+    FixedPointIIRFilter<2> filter("filter", root);
+    ASSERT_FALSE(
+        setValues(filter, std::array<double, 3>{1.0, 0.0, 0.0}, std::array<double, 3>{1.0, 0.0, 0.9}).has_value()
+    );
+    // the sum of absolute values of the impulse response is 1 / (1 - 0.9) = 10, so 4 bits are missing
+    EXPECT_EQ(filter.getOutputHeadroom(), -4);
+}
+
+//! Checks that coefficients which cannot be represented in the Q-format of the filter are rejected
+TEST_F(FixedPointIIRFilterTest, FilterUnrepresentableCoefficient)
+{
+    MockRoot               root;
+    FixedPointIIRFilter<1> filter("filter", root);
+    // Q3.28 ranges from -8 to 8
+    const auto maybe_warning = setValues(filter, std::array<double, 2>{0.5, 0.5}, std::array<double, 2>{1.0, 10.0});
+    ASSERT_TRUE(maybe_warning.has_value());
+    EXPECT_EQ(
+        maybe_warning.value().warning_str,
+        "filter: coefficients at index 1 cannot be represented with 28 fractional bits.\n"
+    );
+}
+
+//! Checks that a FixedPointIIRFilter object follows the floating-point second-order Butterworth IIRFilter on the
+//! POPS B measurement
+TEST_F(FixedPointIIRFilterTest, FilterButterSecondOrderBMeas)
+{
+    MockRoot                                  root;
+    constexpr int                             filter_order  = 2;
+    constexpr int                             filter_length = filter_order + 1;
+    IIRFilter<filter_order>                   reference_filter("reference", root);
+    FixedPointIIRFilter<filter_order, 28, 16> filter("filter", root);
+    std::array<double, filter_length>         numerator_values{2.0657e-1, 4.1314e-1, 2.0657e-1};
+    std::array<double, filter_length>         denominator_values{1.0, -3.6953e-1, 1.9582e-1};
+    setValues(reference_filter, numerator_values, denominator_values);
+    ASSERT_FALSE(setValues(filter, numerator_values, denominator_values).has_value());
+
+    std::filesystem::path inputs_path = "components/inputs/RPOPB.245.BR23.RMPS_B_MEAS_2023-11-17_09-32_inputs.csv";
+
+    CSVFormat format;
+    format.header_row(-1);   // Disables header handling
+    CSVReader inputs_file(inputs_path.c_str(), format);
+
+    using DataType = FixedPointIIRFilter<filter_order, 28, 16>::DataType;
+    for (auto& line : inputs_file)
+    {
+        const auto input_value = line[0].get<double>();
+        EXPECT_NEAR(filter.filter(DataType(input_value)).toDouble(), reference_filter.filter(input_value), 1e-3);
+    }
+}
@@ -0,0 +1,116 @@
+//! @file
+//! @brief File with unit tests of the fixed-point RST controller.
+//! @author Dominik Arominski
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <numbers>
+
+#include "fixedPointRstController.hpp"
+#include "rstController.hpp"
+
+using namespace vslib;
+
+class FixedPointRSTControllerTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+    }
+};
+
+//! Checks that a FixedPointRSTController object can be constructed and is initialized as expected
+TEST_F(FixedPointRSTControllerTest, RSTControllerDefaultConstruction)
+{
+    constexpr size_t controller_length = 3;
+
+    FixedPointRSTController<controller_length> rst("rst");
+
+    EXPECT_FALSE(rst.isReady());
+    EXPECT_EQ(rst.getAccumulatorHeadroom(), 0);
+    for (size_t index = 0; index < controller_length; index++)
+    {
+        EXPECT_EQ(rst.getActuations()[index], 0);
+        EXPECT_EQ(rst.getReferences()[index], 0);
+        EXPECT_EQ(rst.getMeasurements()[index], 0);
+    }
+}
+
+//! Checks that polynomials with zero first element or with coefficients not fitting the Q-format are rejected
+TEST_F(FixedPointRSTControllerTest, RSTControllerSetPolynomialsWarnings)
+{
+    constexpr size_t controller_length = 3;
+
+    FixedPointRSTController<controller_length> rst("rst");
+
+    const auto zero_s0 = rst.setPolynomials({0.1, 0.2, 0.3}, {0.0, 0.6, 0.7}, {0.15, 0.25, 0.35});
+    ASSERT_TRUE(zero_s0.has_value());
+    EXPECT_EQ(zero_s0.value().warning_str, "rst: first element of s or t coefficients is zero.\n");
+
+    // Q7.24 ranges from -128 to 128, while r[2] / s[0] = 300
+    const auto out_of_range = rst.setPolynomials({0.1, 0.2, 3.0}, {0.01, 0.0, 0.0}, {0.15, 0.25, 0.35});
+    ASSERT_TRUE(out_of_range.has_value());
+    EXPECT_EQ(
+        out_of_range.value().warning_str,
+        "rst: normalised coefficients at index 2 cannot be represented with 24 fractional bits.\n"
+    );
+}
+
+//! Checks that the fixed-point actuations follow the floating-point RSTController over a sinusoidal reference
+TEST_F(FixedPointRSTControllerTest, RSTControllerCalculateMultipleActuations)
+{
+    constexpr size_t controller_length = 3;
+
+    std::array<double, controller_length> r_value = {0.1, 0.2, 0.3};
+    std::array<double, controller_length> s_value = {0.5, -0.25, 0.05};
+    std::array<double, controller_length> t_value = {0.15, 0.25, 0.35};
+
+    RSTController<controller_length> reference_rst("reference_rst");
+    reference_rst.setR(r_value);
+    reference_rst.setS(s_value);
+    reference_rst.setT(t_value);
+
+    FixedPointRSTController<controller_length, 24, 16> rst("rst");
+    ASSERT_FALSE(rst.setPolynomials(r_value, s_value, t_value).has_value());
+    EXPECT_GE(rst.getAccumulatorHeadroom(), 0);
+
+    using DataType = FixedPointRSTController<controller_length, 24, 16>::DataType;
+    for (int index = 0; index < 1000; index++)
+    {
+        const double phase       = 2.0 * std::numbers::pi * index / 50.0;
+        const double reference   = 100.0 * std::sin(phase);
+        const double measurement = 80.0 * std::sin(phase - 0.3);
+
+        const double expected_actuation = reference_rst.control(reference, measurement);
+        EXPECT_NEAR(rst.control(DataType(reference), DataType(measurement)).toDouble(), expected_actuation, 1e-3);
+    }
+}
+
+//! Checks that the reference is back-calculated from the clamped actuation
+TEST_F(FixedPointRSTControllerTest, RSTControllerReCalculateReference)
+{
+    constexpr size_t controller_length = 3;
+
+    FixedPointRSTController<controller_length, 24, 16> rst("rst");
+
+    std::array<double, controller_length> r_value = {0.1, 0.2, 0.3};
+    std::array<double, controller_length> s_value = {0.5, 0.6, 0.7};
+    std::array<double, controller_length> t_value = {0.15, 0.25, 0.35};
+    ASSERT_FALSE(rst.setPolynomials(r_value, s_value, t_value).has_value());
+
+    using DataType                   = FixedPointRSTController<controller_length, 24, 16>::DataType;
+    double const set_point_value     = 3.14159;
+    double const measurement_value   = 1.111;
+    const double actuation           = rst.control(DataType(set_point_value), DataType(measurement_value)).toDouble();
+    double const limited_actuation   = actuation - 2.0;   // simulates clamping of possible actuations
+    double const corrected_reference = set_point_value + (limited_actuation - actuation) * s_value[0] / t_value[0];
+    rst.updateReference(DataType(limited_actuation));
+
+    EXPECT_NEAR(DataType::fromRaw(rst.getActuations()[0]).toDouble(), limited_actuation, 1e-4);
+    EXPECT_NEAR(DataType::fromRaw(rst.getMeasurements()[0]).toDouble(), measurement_value, 1e-4);
+    EXPECT_NEAR(DataType::fromRaw(rst.getReferences()[0]).toDouble(), corrected_reference, 1e-4);
+}
@@ -0,0 +1,303 @@
+//! @file
+//! @brief File quantifying the accuracy loss of single-precision instantiations of DSP Components against their
+//! double-precision counterparts, on the same input vectors as used by the unit tests of each Component.
+//! @author Dominik Arominski
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <numbers>
+#include <string>
+
+#include "abcToDq0Transform.hpp"
+#include "csv.hpp"
+#include "firFilter.hpp"
+#include "iirFilter.hpp"
+#include "mockRoot.hpp"
+#include "srfPll.hpp"
+#include "staticJson.hpp"
+
+using namespace vslib;
+using namespace csv;
+
+//! Helper accumulating the discrepancy between a double-precision reference and its single-precision counterpart.
+struct PrecisionReport
+{
+    std::string name;   //!< Name of the compared signal
+
+    double max_absolute_error{0.0};   //!< Largest absolute difference observed
+    double max_magnitude{0.0};        //!< Largest magnitude of the double-precision reference
+    size_t number_samples{0};         //!< Number of compared samples
+
+    //! Adds a new pair of samples to the report.
+    //!
+    //! @param reference Double-precision result
+    //! @param value Single-precision result
+    void add(const double reference, const double value)
+    {
+        max_absolute_error = std::max(max_absolute_error, std::abs(reference - value));
+        max_magnitude      = std::max(max_magnitude, std::abs(reference));
+        number_samples++;
+    }
+
+    //! Returns the largest absolute error normalised to the peak of the reference signal.
+    //!
+    //! @return Error relative to the full-scale of the reference signal
+    [[nodiscard]] double relativeError() const
+    {
+        return (max_magnitude > 0.0) ? max_absolute_error / max_magnitude : max_absolute_error;
+    }
+
+    //! Prints the summary of the report, to keep track of the accuracy loss in the test logs.
+    void print() const
+    {
+        fmt::print(
+            "[ float vs double ] {}: {} samples, max absolute error: {:.3e}, relative to full scale: {:.3e}\n", name,
+            number_samples, max_absolute_error, relativeError()
+        );
+    }
+};
+
+class FloatPrecisionTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+        ParameterRegistry& parameter_registry = ParameterRegistry::instance();
+        parameter_registry.clearRegistry();
+    }
+
+    template<typename ComponentType, typename ParameterType, typename ValueType>
+    void setParameter(ComponentType& component, ParameterType& parameter, const ValueType& value)
+    {
+        StaticJson json_value = value;
+        parameter.setJsonValue(json_value);
+        component.verifyParameters();
+        component.flipBufferState();
+        parameter.syncWriteBuffer();
+    }
+
+    template<typename SRFPLLType>
+    void setPllParameters(SRFPLLType& pll, const double p, const double i, const double T)
+    {
+        pll.pi.kp.setJsonValue(p);
+        pll.pi.ki.setJsonValue(i);
+        pll.pi.kd.setJsonValue(0.0);
+        pll.pi.kff.setJsonValue(0.0);
+        pll.pi.b.setJsonValue(1.0);
+        pll.pi.c.setJsonValue(1.0);
+        pll.pi.N.setJsonValue(1.0);
+        pll.pi.T.setJsonValue(T);
+        pll.pi.f0.setJsonValue(1e-9);
+        pll.pi.actuation_limits.min.setJsonValue(-1e9);
+        pll.pi.actuation_limits.max.setJsonValue(1e9);
+        StaticJson act_dead_zone = std::array<double, 2>{0.0, 0.0};
+        pll.pi.actuation_limits.dead_zone.setJsonValue(act_dead_zone);
+
+        pll.pi.actuation_limits.verifyParameters();
+        pll.pi.actuation_limits.flipBufferState();
+        pll.pi.actuation_limits.synchroniseParameterBuffers();
+
+        pll.pi.verifyParameters();
+        pll.pi.flipBufferState();
+        pll.pi.synchroniseParameterBuffers();
+
+        pll.angle_offset.setJsonValue(0.0);
+        pll.f_rated.setJsonValue(50.0);
+
+        pll.verifyParameters();
+        pll.flipBufferState();
+        pll.synchroniseParameterBuffers();
+    }
+};
+
+//! Compares single and double precision third-order FIR filter on the GPS power converter B measurement
+TEST_F(FloatPrecisionTest, FIRFilterThirdOrderBMeas)
+{
+    MockRoot                          root;
+    constexpr int                     filter_order  = 3;
+    constexpr int                     filter_length = filter_order + 1;
+    FIRFilter<filter_order, double>   filter_double("filter_double", root);
+    FIRFilter<filter_order, float>    filter_float("filter_float", root);
+    std::array<double, filter_length> coefficient_array{0.01674, 0.48326, 0.48326, 0.01674};
+    setParameter(filter_double, filter_double.coefficients, coefficient_array);
+    setParameter(filter_float, filter_float.coefficients, coefficient_array);
+
+    std::filesystem::path inputs_path
+        = "components/inputs/RPACZ.197.YGPS.RDS.3000.B_MEAS_2020-10-08_14-06-11_shortened.csv";
+
+    CSVFormat format;
+    format.header_row(-1);   // Disables header handling
+    CSVReader inputs_file(inputs_path.c_str(), format);
+
+    PrecisionReport report{"FIRFilter<3>"};
+    for (auto& line : inputs_file)
+    {
+        const auto input_value = line[0].get<double>();
+        report.add(filter_double.filter(input_value), filter_float.filter(static_cast<float>(input_value)));
+    }
+    report.print();
+
+    ASSERT_GT(report.number_samples, 0);
+    EXPECT_LT(report.relativeError(), 1e-6);
+}
+
+//! Compares single and double precision 81st-order FIR filter on the GPS power converter B measurement, where
+//! the long accumulation chain is the worst case for the single-precision rounding
+TEST_F(FloatPrecisionTest, FIRFilterHighOrderBMeas)
+{
+    MockRoot                          root;
+    constexpr int                     filter_order  = 80;
+    constexpr int                     filter_length = filter_order + 1;
+    FIRFilter<filter_order, double>   filter_double("filter_double", root);
+    FIRFilter<filter_order, float>    filter_float("filter_float", root);
+    std::array<double, filter_length> coefficient_array{};
+    std::fill(coefficient_array.begin(), coefficient_array.end(), 1.0 / filter_length);   // moving average
+    setParameter(filter_double, filter_double.coefficients, coefficient_array);
+    setParameter(filter_float, filter_float.coefficients, coefficient_array);
+
+    std::filesystem::path inputs_path
+        = "components/inputs/RPACZ.197.YGPS.RDS.3000.B_MEAS_2020-10-08_14-06-11_shortened.csv";
+
+    CSVFormat format;
+    format.header_row(-1);   // Disables header handling
+    CSVReader inputs_file(inputs_path.c_str(), format);
+
+    PrecisionReport report{"FIRFilter<80>"};
+    for (auto& line : inputs_file)
+    {
+        const auto input_value = line[0].get<double>();
+        report.add(filter_double.filter(input_value), filter_float.filter(static_cast<float>(input_value)));
+    }
+    report.print();
+
+    ASSERT_GT(report.number_samples, 0);
+    EXPECT_LT(report.relativeError(), 1e-5);
+}
+
+//! Compares single and double precision second-order Butterworth IIR filter on the POPS B measurement
+TEST_F(FloatPrecisionTest, IIRFilterButterSecondOrderBMeas)
+{
+    MockRoot                          root;
+    constexpr int                     filter_order  = 2;
+    constexpr int                     filter_length = filter_order + 1;
+    IIRFilter<filter_order, double>   filter_double("filter_double", root);
+    IIRFilter<filter_order, float>    filter_float("filter_float", root);
+    std::array<double, filter_length> numerator_values{2.0657e-1, 4.1314e-1, 2.0657e-1};
+    std::array<double, filter_length> denominator_values{1.0, -3.6953e-1, 1.9582e-1};
+    setParameter(filter_double, filter_double.numerator, numerator_values);
+    setParameter(filter_double, filter_double.denominator, denominator_values);
+    setParameter(filter_float, filter_float.numerator, numerator_values);
+    setParameter(filter_float, filter_float.denominator, denominator_values);
+
+    std::filesystem::path inputs_path = "components/inputs/RPOPB.245.BR23.RMPS_B_MEAS_2023-11-17_09-32_inputs.csv";
+
+    CSVFormat format;
+    format.header_row(-1);   // Disables header handling
+    CSVReader inputs_file(inputs_path.c_str(), format);
+
+    PrecisionReport report{"IIRFilter<2>"};
+    for (auto& line : inputs_file)
+    {
+        const auto input_value = line[0].get<double>();
+        report.add(filter_double.filter(input_value), filter_float.filter(static_cast<float>(input_value)));
+    }
+    report.print();
+
+    ASSERT_GT(report.number_samples, 0);
+    EXPECT_LT(report.relativeError(), 1e-5);
+}
+
+//! Compares single and double precision abc to dq0 transform on the Simulink input vectors
+TEST_F(FloatPrecisionTest, AbcToDq0Transform)
+{
+    MockRoot                  root;
+    AbcToDq0Transform<double> park_double("park_double", root, 10'000);
+    AbcToDq0Transform<float>  park_float("park_float", root, 10'000);
+
+    std::filesystem::path abc_path   = "components/inputs/park_abc_sin_120degrees.csv";
+    std::filesystem::path theta_path = "components/inputs/park_theta_0_20.csv";
+
+    CSVReader abc_file(abc_path.c_str());
+    CSVReader theta_file(theta_path.c_str());
+
+    auto abc_line   = abc_file.begin();
+    auto theta_line = theta_file.begin();
+
+    PrecisionReport report_d{"AbcToDq0Transform d"};
+    PrecisionReport report_q{"AbcToDq0Transform q"};
+    PrecisionReport report_zero{"AbcToDq0Transform zero"};
+    while (abc_line != abc_file.end() && theta_line != theta_file.end())
+    {
+        const auto a     = (*abc_line)[1].get<double>();
+        const auto b     = (*abc_line)[2].get<double>();
+        const auto c     = (*abc_line)[3].get<double>();
+        const auto theta = (*theta_line)[1].get<double>();
+
+        const auto [d, q, zero] = park_double.transform(a, b, c, theta);
+        const auto [d_float, q_float, zero_float] = park_float.transform(
+            static_cast<float>(a), static_cast<float>(b), static_cast<float>(c), static_cast<float>(theta)
+        );
+
+        report_d.add(d, d_float);
+        report_q.add(q, q_float);
+        report_zero.add(zero, zero_float);
+
+        ++abc_line;
+        ++theta_line;
+    }
+    report_d.print();
+    report_q.print();
+    report_zero.print();
+
+    ASSERT_GT(report_d.number_samples, 0);
+    EXPECT_LT(report_d.max_absolute_error, 1e-5);
+    EXPECT_LT(report_q.max_absolute_error, 1e-5);
+    EXPECT_LT(report_zero.max_absolute_error, 1e-6);
+}
+
+//! Compares single and double precision SRF PLL over a long simulation, which includes introduced glitches
+TEST_F(FloatPrecisionTest, SRFPLLSimulinkInputs)
+{
+    MockRoot       root;
+    SRFPLL<double> pll_double("pll_double", root);
+    SRFPLL<float>  pll_float("pll_float", root);
+    setPllParameters(pll_double, 50.0, 200.0, 1.0e-4);
+    setPllParameters(pll_float, 50.0, 200.0, 1.0e-4);
+
+    std::filesystem::path abc_path = "components/inputs/abc_pll.csv";
+
+    CSVFormat format;
+    format.header_row(-1);   // Disables header handling
+    CSVReader abc_file(abc_path.c_str(), format);
+
+    PrecisionReport report_wt{"SRFPLL wt"};
+    PrecisionReport report_q{"SRFPLL q"};
+    for (auto& line : abc_file)
+    {
+        const auto a = line[0].get<double>();
+        const auto b = line[1].get<double>();
+        const auto c = line[2].get<double>();
+
+        const auto [wt, d, q] = pll_double.synchroniseWithDQ(a, b, c);
+        const auto [wt_float, d_float, q_float]
+            = pll_float.synchroniseWithDQ(static_cast<float>(a), static_cast<float>(b), static_cast<float>(c));
+
+        // the angle wraps around at 2 pi, a wrap happening one step apart in both precisions is not an error
+        const double wt_error = std::remainder(wt - static_cast<double>(wt_float), 2.0 * std::numbers::pi);
+        report_wt.add(wt, wt - wt_error);
+        report_q.add(q, q_float);
+    }
+    report_wt.print();
+    report_q.print();
+
+    ASSERT_GT(report_wt.number_samples, 0);
+    EXPECT_LT(report_wt.max_absolute_error, 1e-3);
+    EXPECT_LT(report_q.max_absolute_error, 1e-3);
+}
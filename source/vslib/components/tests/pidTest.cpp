@@ -27,7 +27,7 @@ class PIDTest : public ::testing::Test
     }
 
     void set_pid_parameters(
-        PID& pidRst, double p, double i, double d, double ff, double b, double c, double N = 1, double T = 1,
+        PID<>& pidRst, double p, double i, double d, double ff, double b, double c, double N = 1, double T = 1,
         double f0 = 1, double act_min = 0, double act_max = 1e9
     )
     {
@@ -0,0 +1,221 @@
+//! @file
+//! @brief File with unit tests of the SignalFlowGraph class.
+//! @author Dominik Arominski
+
+#include <gtest/gtest.h>
+#include <numbers>
+#include <vector>
+
+#include "abcToDq0Transform.hpp"
+#include "boxFilter.hpp"
+#include "mockRoot.hpp"
+#include "signalFlowGraph.hpp"
+
+using namespace vslib;
+
+class SignalFlowGraphTest : public ::testing::Test
+{
+  protected:
+    void TearDown() override
+    {
+        ParameterRegistry::instance().clearRegistry();
+    }
+};
+
+namespace
+{
+    //! Block multiplying its input by a gain and recording the order of execution
+    struct Gain
+    {
+        double            gain;
+        int               label;
+        std::vector<int>* order;
+
+        double apply(const double input)
+        {
+            order->push_back(label);
+            return gain * input;
+        }
+    };
+
+    constexpr auto apply_gain = [](Gain& block, const double input)
+    {
+        return block.apply(input);
+    };
+
+    constexpr auto add = [](Gain& block, const double first, const double second)
+    {
+        return block.apply(first + second);
+    };
+}
+
+//! Checks that blocks are executed after the blocks producing their inputs, whatever the order of addition
+TEST_F(SignalFlowGraphTest, TopologicalOrder)
+{
+    std::vector<int> order;
+    Gain             first{2.0, 1, &order};
+    Gain             second{3.0, 2, &order};
+    Gain             third{1.0, 3, &order};
+
+    SignalFlowGraph<4, 8> graph;
+    const auto            input        = graph.createSignal<double>();
+    const auto            intermediate = graph.createSignal<double>();
+    const auto            scaled       = graph.createSignal<double>();
+    const auto            output       = graph.createSignal<double>();
+
+    // added in the reverse order of the data flow
+    const auto third_id  = graph.addBlock<add>(third, std::tuple{intermediate, scaled}, std::tuple{output});
+    const auto second_id = graph.addBlock<apply_gain>(second, std::tuple{intermediate}, std::tuple{scaled});
+    const auto first_id  = graph.addBlock<apply_gain>(first, std::tuple{input}, std::tuple{intermediate});
+    EXPECT_FALSE(graph.isBuilt());
+    ASSERT_FALSE(graph.build().has_value());
+    EXPECT_TRUE(graph.isBuilt());
+    EXPECT_EQ(graph.position(first_id), 0);
+    EXPECT_EQ(graph.position(second_id), 1);
+    EXPECT_EQ(graph.position(third_id), 2);
+
+    graph.write(input, 1.5);
+    graph.execute();
+    EXPECT_EQ(order, (std::vector<int>{1, 2, 3}));
+    EXPECT_DOUBLE_EQ(graph.read(intermediate), 3.0);
+    EXPECT_DOUBLE_EQ(graph.read(scaled), 9.0);
+    EXPECT_DOUBLE_EQ(graph.read(output), 12.0);
+}
+
+//! Checks that a signal written by two blocks and a loop of blocks are reported
+TEST_F(SignalFlowGraphTest, InvalidGraphs)
+{
+    std::vector<int> order;
+    Gain             first{1.0, 1, &order};
+    Gain             second{1.0, 2, &order};
+
+    SignalFlowGraph<2, 4> two_producers;
+    const auto            input  = two_producers.createSignal<double>();
+    const auto            output = two_producers.createSignal<double>();
+    two_producers.addBlock<apply_gain>(first, std::tuple{input}, std::tuple{output});
+    two_producers.addBlock<apply_gain>(second, std::tuple{input}, std::tuple{output});
+    const auto producers_warning = two_producers.build();
+    ASSERT_TRUE(producers_warning.has_value());
+    EXPECT_EQ(producers_warning.value().warning_str, "Signal 1 is written by blocks 0 and 1.\n");
+    EXPECT_FALSE(two_producers.isBuilt());
+
+    SignalFlowGraph<2, 4> loop;
+    const auto            forward  = loop.createSignal<double>();
+    const auto            backward = loop.createSignal<double>();
+    loop.addBlock<apply_gain>(first, std::tuple{backward}, std::tuple{forward});
+    loop.addBlock<apply_gain>(second, std::tuple{forward}, std::tuple{backward});
+    const auto loop_warning = loop.build();
+    ASSERT_TRUE(loop_warning.has_value());
+    EXPECT_EQ(loop_warning.value().warning_str, "2 blocks of the signal-flow graph form a loop.\n");
+
+    // nothing is executed without a schedule
+    loop.execute();
+    EXPECT_TRUE(order.empty());
+}
+
+//! Checks that adding more signals or blocks than the capacity of the graph throws
+TEST_F(SignalFlowGraphTest, Capacity)
+{
+    std::vector<int> order;
+    Gain             block{1.0, 1, &order};
+
+    SignalFlowGraph<1, 2> graph;
+    const auto            input  = graph.createSignal<double>();
+    const auto            output = graph.createSignal<double>();
+    EXPECT_THROW(std::ignore = graph.createSignal<double>(), std::length_error);
+    graph.addBlock<apply_gain>(block, std::tuple{input}, std::tuple{output});
+    EXPECT_THROW(graph.addBlock<apply_gain>(block, std::tuple{input}, std::tuple{output}), std::length_error);
+    EXPECT_EQ(graph.numberSignals(), 2);
+    EXPECT_EQ(graph.numberBlocks(), 1);
+}
+
+//! Checks that Components with several outputs and Components called without virtual dispatch give the same results
+//! as calling them directly
+TEST_F(SignalFlowGraphTest, Components)
+{
+    MockRoot              root;
+    AbcToDq0Transform<>   transform("transform", root);
+    AbcToDq0Transform<>   reference_transform("reference_transform", root);
+    BoxFilter<2>          filter("filter", root);
+    BoxFilter<2>          reference_filter("reference_filter", root);
+    SignalFlowGraph<2, 8> graph;
+
+    const auto f_a        = graph.createSignal<double>();
+    const auto f_b        = graph.createSignal<double>();
+    const auto f_c        = graph.createSignal<double>();
+    const auto wt         = graph.createSignal<double>();
+    const auto d          = graph.createSignal<double>();
+    const auto q          = graph.createSignal<double>();
+    const auto zero       = graph.createSignal<float>();
+    const auto d_filtered = graph.createSignal<double>();
+
+    graph.addBlock<[](BoxFilter<2>& block, const double input)
+                   {
+                       // qualified call, so that the virtual filter is called directly
+                       return block.BoxFilter<2>::filter(input);
+                   }>(filter, std::tuple{d}, std::tuple{d_filtered});
+    graph.addBlock<[](AbcToDq0Transform<>& block, const double a, const double b, const double c, const double angle)
+                   {
+                       return block.transform(a, b, c, angle);
+                   }>(transform, std::tuple{f_a, f_b, f_c, wt}, std::tuple{d, q, zero});
+    ASSERT_FALSE(graph.build().has_value());
+
+    for (size_t step = 0; step < 10; step++)
+    {
+        const double angle = 0.1 * step;
+        const double a     = std::sin(angle);
+        const double b     = std::sin(angle - 2.0 * std::numbers::pi / 3.0);
+        const double c     = std::sin(angle + 2.0 * std::numbers::pi / 3.0) + 0.01 * step;
+        graph.write(f_a, a);
+        graph.write(f_b, b);
+        graph.write(f_c, c);
+        graph.write(wt, angle);
+        graph.execute();
+
+        const auto [expected_d, expected_q, expected_zero] = reference_transform.transform(a, b, c, angle);
+        EXPECT_EQ(graph.read(d), expected_d);
+        EXPECT_EQ(graph.read(q), expected_q);
+        EXPECT_EQ(graph.read(zero), static_cast<float>(expected_zero));
+        EXPECT_EQ(graph.read(d_filtered), reference_filter.filter(expected_d));
+    }
+}
+
+//! Checks that the execution time of each block is measured with the provided counter
+TEST_F(SignalFlowGraphTest, BlockTiming)
+{
+    std::vector<int> order;
+    Gain             first{1.0, 1, &order};
+    Gain             second{1.0, 2, &order};
+
+    SignalFlowGraph<2, 3> graph;
+    const auto            input        = graph.createSignal<double>();
+    const auto            intermediate = graph.createSignal<double>();
+    const auto            output       = graph.createSignal<double>();
+    const auto second_id = graph.addBlock<apply_gain>(second, std::tuple{intermediate}, std::tuple{output});
+    const auto first_id  = graph.addBlock<apply_gain>(first, std::tuple{input}, std::tuple{intermediate});
+    ASSERT_FALSE(graph.build().has_value());
+
+    // the counter advances by 10 ticks during the first block and by 20 ticks during the second one
+    uint64_t ticks = 0;
+    graph.execute(
+        [&ticks, &order]
+        {
+            ticks += 10 * order.size();
+            return ticks;
+        }
+    );
+    EXPECT_EQ(graph.timing(first_id).last, 10);
+    EXPECT_EQ(graph.timing(second_id).last, 20);
+    EXPECT_EQ(graph.timing(second_id).worst, 20);
+
+    order.clear();
+    ticks = 0;
+    graph.execute(
+        [&ticks]
+        {
+            return ticks++;
+        }
+    );
+    EXPECT_EQ(graph.timing(first_id).last, 1);
+    EXPECT_EQ(graph.timing(first_id).worst, 10);
+}
@@ -0,0 +1,103 @@
+//! @file
+//! @brief File with unit tests of SinCosLookupTable component.
+//! @author Dominik Arominski
+
+#include <cmath>
+#include <gtest/gtest.h>
+
+#include "mockRoot.hpp"
+#include "sinCosLookupTable.hpp"
+
+using namespace vslib;
+
+class SinCosLookupTableTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+    }
+};
+
+//! Tests default construction of SinCosLookupTable component
+TEST_F(SinCosLookupTableTest, SinCosLookupTable)
+{
+    MockRoot          root;
+    std::string       name = "table";
+    SinCosLookupTable table(name, root, 2);
+    EXPECT_EQ(table.getName(), name);
+
+    auto serialized = table.serialize();
+    EXPECT_EQ(serialized["name"], name);
+    EXPECT_EQ(serialized["type"], "SinCosLookupTable");
+    EXPECT_EQ(serialized["components"].size(), 0);
+    EXPECT_EQ(serialized["parameters"].size(), 0);
+}
+
+//! Tests SinCosLookupTable component interpolating a couple of points
+TEST_F(SinCosLookupTableTest, SinCosLookupTableInterpolation)
+{
+    MockRoot          root;
+    std::string       name = "table";
+    SinCosLookupTable table(name, root, 10000);
+
+    for (const double x : {0.0, M_PI / 2.0, M_PI, 4.0 / 3.0 * M_PI, 2.0 * M_PI - 0.01})
+    {
+        const auto [sin_x, cos_x] = table.interpolate(x);
+        EXPECT_NEAR(sin_x, sin(x), 1e-6);
+        EXPECT_NEAR(cos_x, cos(x), 1e-6);
+    }
+}
+
+//! Tests SinCosLookupTable component interpolating a couple of points that fall out of 0 - 2pi range
+TEST_F(SinCosLookupTableTest, SinCosLookupTableInterpolationOutOfBounds)
+{
+    MockRoot          root;
+    std::string       name = "table";
+    SinCosLookupTable table(name, root, 10000);
+
+    for (const double x : {-M_PI, -M_PI / 2.0, -4.0 / 3.0 * M_PI, -2.0 * M_PI + 1e-2, 2.0 * M_PI, 5.5 * M_PI,
+                           15.3 * M_PI / 2.0, 7.939 * M_PI, 123 * 2.0 * M_PI})
+    {
+        const auto [sin_x, cos_x] = table(x);
+        EXPECT_NEAR(sin_x, sin(x), 1e-6);
+        EXPECT_NEAR(cos_x, cos(x), 1e-6);
+    }
+}
+
+//! Tests SinCosLookupTable component interpolating a long array of points, within the interpolation error bound of
+//! the squared section width over 8
+TEST_F(SinCosLookupTableTest, SinCosLookupTableLongInterpolation)
+{
+    MockRoot                  root;
+    SinCosLookupTable<double> table("table", root, 1000);
+
+    const double error_bound   = std::pow(2.0 * M_PI / 1000, 2) / 8.0;
+    const size_t number_points = 10000;
+    for (size_t index = 0; index < number_points; index++)
+    {
+        const double x            = 2.0 * M_PI * index / number_points;
+        const auto [sin_x, cos_x] = table(x);
+        ASSERT_NEAR(sin_x, sin(x), error_bound);
+        ASSERT_NEAR(cos_x, cos(x), error_bound);
+    }
+}
+
+//! Tests single-precision SinCosLookupTable against the standard library
+TEST_F(SinCosLookupTableTest, SinCosLookupTableFloat)
+{
+    MockRoot                 root;
+    SinCosLookupTable<float> table("table", root, 10000);
+
+    const size_t number_points = 1000;
+    for (size_t index = 0; index < number_points; index++)
+    {
+        const float x             = static_cast<float>(2.0 * M_PI * index / number_points);
+        const auto [sin_x, cos_x] = table(x);
+        EXPECT_NEAR(sin_x, std::sin(x), 1e-5);
+        EXPECT_NEAR(cos_x, std::cos(x), 1e-5);
+    }
+}
@@ -27,7 +27,7 @@ class SRFPLLTest : public ::testing::Test
     }
 
     void set_parameters(
-        SRFPLL& pll, const double p, const double i, const double d, const double ff, const double b, const double c,
+        SRFPLL<>& pll, const double p, const double i, const double d, const double ff, const double b, const double c,
         const double N = 1, const double T = 1, const double f0 = 1, const double act_min = -1e9,
         const double act_max = 1e9, const double f_rated = 50, const double angle_offset = 0.0
     )
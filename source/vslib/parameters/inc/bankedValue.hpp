@@ -0,0 +1,61 @@
+//! @file
+//! @brief File defining a value derived from Parameters, held once for each bank of Parameter values.
+//! @author Dominik Arominski
+
+#pragma once
+
+#include <array>
+
+#include "parameterBank.hpp"
+
+namespace vslib
+{
+    //! Value derived from Parameters by a Component in verifyParameters, e.g. filter coefficients in the filter's
+    //! scalar type, held once for each bank of Parameter values. The value is set for the bank being loaded in the
+    //! background and read from the active bank, so that loading a bank that is not active leaves the running
+    //! Component untouched until the bank is selected.
+    //!
+    //! @tparam T Type of the derived value
+    template<typename T>
+    class BankedValue
+    {
+      public:
+        //! Default constructor, value-initializing the value of all banks.
+        BankedValue() = default;
+
+        //! Constructor setting the provided value to all banks, until it is derived from the Parameters.
+        //!
+        //! @param value Initial value of all banks
+        explicit BankedValue(const T& value) noexcept
+        {
+            m_values.fill(value);
+        }
+
+        //! Provides the value derived for the active bank.
+        //!
+        //! @return Value of the active bank
+        [[nodiscard]] const T& value() const noexcept
+        {
+            return m_values[ParameterBank::active()];
+        }
+
+        //! Sets the value derived for the bank being loaded. The first value is set to all banks, as are the first
+        //! validated values of Parameters, so that every bank holds a valid value.
+        //!
+        //! @param value Value derived from the Parameters of the bank being loaded
+        void set(const T& value) noexcept
+        {
+            if (!m_derived)
+            {
+                m_values.fill(value);
+                m_derived = true;
+                return;
+            }
+            m_values[ParameterBank::loading()] = value;
+        }
+
+      private:
+        std::array<T, number_banks> m_values{};          //!< Value derived for each bank
+        bool                        m_derived{false};   //!< Whether a value has been derived from the Parameters
+    };
+}   // namespace vslib
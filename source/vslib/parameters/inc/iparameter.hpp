@@ -4,7 +4,10 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <optional>
+#include <span>
 
 #include "nonCopyableNonMovable.hpp"
 #include "staticJson.hpp"
@@ -17,16 +20,27 @@ namespace vslib
     class IParameter : public NonCopyableNonMovable
     {
       public:
+        using SnapshotValue = std::span<const std::byte>;   //!< Raw bytes of a Parameter value
+
         virtual ~IParameter() = default;
 
-        [[nodiscard]] virtual std::string_view        getName() const noexcept                             = 0;
-        [[nodiscard]] virtual bool                    isInitialized() const noexcept                       = 0;
-        [[nodiscard]] virtual bool                    isValidated() const noexcept                         = 0;
-        virtual void                                  setValidated(const bool) noexcept                    = 0;
-        virtual void                                  setInitialized(const bool) noexcept                  = 0;
-        virtual std::optional<fgc4::utils::Warning>   setJsonValue(const fgc4::utils::StaticJson&)         = 0;
-        [[nodiscard]] virtual fgc4::utils::StaticJson serialize(const ParameterSerializer&) const noexcept = 0;
-        virtual void                                  syncWriteBuffer()                                    = 0;
-        virtual void                                  swapBuffers()                                        = 0;
+        [[nodiscard]] virtual std::string_view        getName() const noexcept                                  = 0;
+        [[nodiscard]] virtual std::string_view        getFullName() const noexcept                              = 0;
+        [[nodiscard]] virtual bool                    isInitialized() const noexcept                            = 0;
+        [[nodiscard]] virtual bool                    isValidated() const noexcept                              = 0;
+        [[nodiscard]] virtual size_t                  getLength() const noexcept                                = 0;
+        virtual void                                  setValidated(const bool) noexcept                         = 0;
+        virtual void                                  setInitialized(const bool) noexcept                       = 0;
+        virtual std::optional<fgc4::utils::Warning>   setJsonValue(const fgc4::utils::StaticJson&)              = 0;
+        virtual std::optional<fgc4::utils::Warning>   setJsonSlice(const fgc4::utils::StaticJson&, size_t)      = 0;
+        [[nodiscard]] virtual fgc4::utils::StaticJson serialize(const ParameterSerializer&) const noexcept      = 0;
+        [[nodiscard]] virtual fgc4::utils::StaticJson serializeValue(const ParameterSerializer&) const noexcept = 0;
+        virtual void                                  syncWriteBuffer(const uint16_t bank)                      = 0;
+        virtual void                                  swapBuffers(const uint16_t bank)                          = 0;
+
+        // Binary access to the value, used to persist validated values across reboots
+        [[nodiscard]] virtual uint32_t                     getSnapshotTypeId() const noexcept  = 0;
+        [[nodiscard]] virtual std::optional<SnapshotValue> getSnapshotValue() const noexcept   = 0;
+        virtual std::optional<fgc4::utils::Warning>        restoreSnapshotValue(SnapshotValue) = 0;
     };
 }   // namespace vslib
@@ -5,21 +5,30 @@
 
 #pragma once
 
+#include <atomic>
 #include <compare>
 #include <concepts>
+#include <cstring>
 #include <limits>
+#include <memory>
 #include <optional>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
+#include <utility>
 
 #include "component.hpp"
 #include "constants.hpp"
+#include "enumLookup.hpp"
 #include "errorCodes.hpp"
 #include "errorMessage.hpp"
+#include "fnvHash.hpp"
 #include "iparameter.hpp"
 #include "magic_enum.hpp"
+#include "parameterBank.hpp"
 #include "parameterRegistry.hpp"
+#include "parameterStorage.hpp"
 #include "staticJson.hpp"
 #include "typeLabel.hpp"
 #include "typeVerification.hpp"
@@ -27,10 +36,6 @@
 
 namespace vslib
 {
-    // ************************************************************
-    // Convenience constants for parameter class
-    constexpr uint16_t number_buffers = 2;   // number of buffers for settable parameters
-
     // ************************************************************
     // Helper definitions to define the type for min/max limits for parameters
 
@@ -63,10 +68,10 @@ namespace vslib
         //! @param name Name of the Parameter
         Parameter(Component& parent, std::string_view name) noexcept
             requires fgc4::utils::NonNumeric<T>
-            : m_name{name},
-              m_parent{parent}
+            : m_values{ParameterStorage::values().create<Values>()},
+              m_metadata{ParameterStorage::metadata().create<Metadata>(parent, name)}
         {
-            m_parent.registerParameter(*this);
+            parent.registerParameter(*this);
         }
 
         //! Constructor for parameters with optional numeric-type limits.
@@ -81,16 +86,22 @@ namespace vslib
             LimitType<T> limit_max = std::numeric_limits<LimitType<T>>::max()
         )
             requires fgc4::utils::Numeric<T>
-            : m_name{name},
-              m_parent{parent},
-              m_limit_min{limit_min},
-              m_limit_max{limit_max},
-              m_limit_min_defined{limit_min != std::numeric_limits<LimitType<T>>::lowest()},
-              m_limit_max_defined(limit_max != std::numeric_limits<LimitType<T>>::max())
-        {
-            m_parent.registerParameter(*this);
+            : m_values{ParameterStorage::values().create<Values>()},
+              m_metadata{ParameterStorage::metadata().create<Metadata>(parent, name, limit_min, limit_max)}
+        {
+            parent.registerParameter(*this);
         };
 
+        //! Destroys the state of this Parameter, leaving its storage to the next Parameter of the same type.
+        ~Parameter() override
+        {
+            ParameterStorage::values().destroy(m_values);
+            ParameterStorage::metadata().destroy(m_metadata);
+        }
+
+        Parameter(const Parameter&)            = delete;
+        Parameter& operator=(const Parameter&) = delete;
+
         // ************************************************************
         // Operator overloads to seamless interactions with held values
 
@@ -99,7 +110,7 @@ namespace vslib
         //! @return Read-buffer value.
         operator T() const
         {
-            return *m_read_buffer;
+            return *readBuffer();
         }
 
         //! Provides element-access to the values stored in the value, provided the type stored is a std::array.
@@ -118,7 +129,7 @@ namespace vslib
                 );
                 throw std::out_of_range(fmt::format("{}", message));
             }
-            return (*m_read_buffer)[index];
+            return (*readBuffer())[index];
         }
 
         //! Provides ordering for the Parameters, allowing to compare them to allow interactions as if they were of the
@@ -130,8 +141,8 @@ namespace vslib
         {
             // parameters are compared based on the values stored
             // in the currently active buffer
-            auto const& lhs = *(this->m_read_buffer);
-            auto const& rhs = *(other.m_read_buffer);
+            auto const& lhs = *(this->readBuffer());
+            auto const& rhs = *(other.readBuffer());
             if (lhs == rhs)
             {
                 return std::partial_ordering::equivalent;
@@ -157,7 +168,7 @@ namespace vslib
         //! @return Value held in the read buffer cast explictly to the Parameter type
         [[nodiscard]] const T& value() const noexcept
         {
-            return *m_read_buffer;
+            return *readBuffer();
         }
 
         //! Returns the write buffer value to be validated.
@@ -165,7 +176,7 @@ namespace vslib
         //! @return Write buffer value with explict cast to the underlying type
         [[nodiscard]] const T& toValidate() const noexcept
         {
-            return *m_write_buffer;
+            return *writeBuffer();
         }
 
         //! Getter for the initialization flag of the Parameter.
@@ -173,7 +184,7 @@ namespace vslib
         //! @return True if the Parameter has been initialized, false otherwise
         [[nodiscard]] bool isInitialized() const noexcept override
         {
-            return m_initialized;
+            return m_metadata.initialized;
         }
 
         //! Getter for the validate flag of the Parameter.
@@ -181,7 +192,7 @@ namespace vslib
         //! @return True if the Parameter has been validated, false otherwise
         [[nodiscard]] bool isValidated() const noexcept override
         {
-            return m_validated;
+            return m_metadata.validated;
         }
 
         //! Getter for the Parameter name.
@@ -189,7 +200,15 @@ namespace vslib
         //! @return Parameter name
         [[nodiscard]] std::string_view getName() const noexcept override
         {
-            return m_name;
+            return m_metadata.name;
+        }
+
+        //! Getter for the Parameter full name, including the hierarchy of its Component.
+        //!
+        //! @return Parameter full name
+        [[nodiscard]] std::string_view getFullName() const noexcept override
+        {
+            return m_metadata.full_name;
         }
 
         //! Getter for whether the lower numerical limit is defined.
@@ -197,7 +216,7 @@ namespace vslib
         //! @return True if the lower limit is defined, false otherwise
         [[nodiscard]] bool isLimitMinDefined() const noexcept
         {
-            return m_limit_min_defined;
+            return m_metadata.limit_min_defined;
         }
 
         //! Getter for whether the upper numerical limit is defined.
@@ -205,7 +224,7 @@ namespace vslib
         //! @return True if the upper limit is defined, false otherwise
         [[nodiscard]] bool isLimitMaxDefined() const noexcept
         {
-            return m_limit_max_defined;
+            return m_metadata.limit_max_defined;
         }
 
         //! Getter for the lower limit of the held value.
@@ -214,7 +233,7 @@ namespace vslib
         [[nodiscard]] const LimitType<T>& getLimitMin() const noexcept
             requires fgc4::utils::Numeric<T>
         {
-            return m_limit_min;
+            return m_metadata.limit_min;
         }
 
         //! Getter for the upper limit of the held value.
@@ -223,7 +242,7 @@ namespace vslib
         [[nodiscard]] const LimitType<T>& getLimitMax() const noexcept
             requires fgc4::utils::Numeric<T>
         {
-            return m_limit_max;
+            return m_metadata.limit_max;
         }
 
         // ************************************************************
@@ -235,7 +254,7 @@ namespace vslib
         auto begin()
             requires fgc4::utils::StdArray<T>
         {
-            return m_read_buffer->begin();
+            return readBuffer()->begin();
         }
 
         //! Provides connection to cbegin() method of underlying container, if the Parameter type is an array.
@@ -244,7 +263,7 @@ namespace vslib
         auto const cbegin() const
             requires fgc4::utils::StdArray<T>
         {
-            return m_read_buffer->cbegin();
+            return readBuffer()->cbegin();
         }
 
         //! Provides connection to end() method of underlying container, if the Parameter type is an array.
@@ -253,7 +272,7 @@ namespace vslib
         auto end()
             requires fgc4::utils::StdArray<T>
         {
-            return m_read_buffer->end();
+            return readBuffer()->end();
         }
 
         //! Provides connection to cend() method of underlying container, if the Parameter type is an array.
@@ -262,7 +281,7 @@ namespace vslib
         auto const cend() const
             requires fgc4::utils::StdArray<T>
         {
-            return m_read_buffer->cend();
+            return readBuffer()->cend();
         }
 
         // ************************************************************
@@ -276,6 +295,15 @@ namespace vslib
             return serializer.serialize(*this);
         }
 
+        //! Serializes the value of this Parameter only, using JSON serialization class.
+        //!
+        //! @param serializer Reference to ParameterSerializer visitor
+        //! @return JSON-serialized value
+        [[nodiscard]] StaticJson serializeValue(const ParameterSerializer& serializer) const noexcept override
+        {
+            return serializer.serializeValue(*this);
+        }
+
         // ************************************************************
 
         //! Sets the provided JSON-serialized value to the parameter-held value.
@@ -288,17 +316,54 @@ namespace vslib
             if (!maybe_warning.has_value())
             {
                 // set the initialized flag
-                m_initialized = true;
+                m_metadata.initialized = true;
             }
             return maybe_warning;
         }
 
+        //! Provides the number of elements of an array Parameter.
+        //!
+        //! @return Number of elements if the Parameter is an array, zero otherwise
+        [[nodiscard]] size_t getLength() const noexcept override
+        {
+            if constexpr (fgc4::utils::StdArray<T>)
+            {
+                return std::tuple_size_v<T>;
+            }
+            else
+            {
+                return 0;
+            }
+        }
+
+        //! Sets the provided JSON-serialized values to a range of elements of the array Parameter, starting at the
+        //! offset. Only the provided elements are checked and written, the other elements keep their current value, so
+        //! the Parameter needs to be set as a whole first.
+        //!
+        //! @param json_value JSON-serialized array of values to be set
+        //! @param offset Index of the first element to be set
+        //! @return Returns a Warning with relevant information if setting not successful, nothing otherwise
+        std::optional<fgc4::utils::Warning> setJsonSlice(const StaticJson& json_value, const size_t offset) override
+        {
+            if constexpr (fgc4::utils::StdArray<T>)
+            {
+                return setJsonSliceImpl(json_value, offset);
+            }
+            else
+            {
+                fgc4::utils::Warning message(
+                    fmt::format("Parameter {} is not an array, slice not set.\n", m_metadata.name)
+                );
+                return message;
+            }
+        }
+
         //! Sets the initialization flag to the chosen value.
         //!
         //! @param initialized New value of the initialized flag of this Parameter.
         void setInitialized(const bool initialized) noexcept override
         {
-            m_initialized = initialized;
+            m_metadata.initialized = initialized;
         }
 
         //! Sets the validation flag to the provided value by the owning Component.
@@ -306,44 +371,248 @@ namespace vslib
         //! @param value New value for the validated flag.
         void setValidated(const bool value) noexcept override
         {
-            m_validated = value;
+            m_metadata.validated = value;
         }
 
         // ************************************************************
         // Method for synchronizing buffers
 
-        //! Copies contents of the write buffer to the read buffer to synchronise them.
-        void syncWriteBuffer() override
+        //! Copies contents of the provided bank to the write buffer to synchronise them.
+        //!
+        //! @param bank Index of the bank to be copied
+        void syncWriteBuffer(const uint16_t bank) override
         {
-            *m_write_buffer = *m_read_buffer;
+            *writeBuffer() = *bankBuffer(bank);
         }
 
-        //! Swaps the buffer pointers.
-        void swapBuffers() override
+        //! Copies contents of the active bank to the write buffer to synchronise them.
+        void syncWriteBuffer()
         {
-            T* tmp         = m_write_buffer;
-            m_write_buffer = m_read_buffer;
-            m_read_buffer  = tmp;
+            syncWriteBuffer(ParameterBank::active());
+        }
+
+        //! Swaps the buffers of the write buffer and the provided bank, so that the bank holds the new value. Until
+        //! the Parameter is validated for the first time, the new value is copied to all other banks as well, so that
+        //! every bank holds a valid value.
+        //!
+        //! @param bank Index of the bank receiving the write-buffer value
+        void swapBuffers(const uint16_t bank) override
+        {
+            if (!m_metadata.validated)
+            {
+                for (uint16_t other_bank = 0; other_bank < number_banks; other_bank++)
+                {
+                    *bankBuffer(other_bank) = *writeBuffer();
+                }
+            }
+            std::swap(m_values.bank_buffers[bank], m_values.write_buffer);
+            // published after the swap, so that a reader observing the new generation also observes the new value
+            m_values.generation.fetch_add(1, std::memory_order_release);
+        }
+
+        //! Swaps the buffers of the write buffer and the active bank.
+        void swapBuffers()
+        {
+            swapBuffers(ParameterBank::active());
+        }
+
+        //! Provides the generation of the values of this Parameter, incremented each time a new value is swapped
+        //! into one of its banks. Together with ParameterBank::switches, it tells whether the read-buffer value may
+        //! have changed since it has last been read, so that values derived from it can be cached.
+        //!
+        //! @return Number of times new values have been swapped into the banks
+        [[nodiscard]] uint32_t generation() const noexcept
+        {
+            return m_values.generation.load(std::memory_order_acquire);
+        }
+
+        // ************************************************************
+        // Methods for persisting the value in a binary snapshot
+
+        //! Provides the identifier of the stored type, to reject snapshot values stored for a different type.
+        //!
+        //! @return Hash of the type label of this Parameter
+        [[nodiscard]] uint32_t getSnapshotTypeId() const noexcept override
+        {
+            return static_cast<uint32_t>(utils::fnv1aHash(std::string_view(fgc4::utils::getTypeLabel<T>())));
+        }
+
+        //! Provides the raw bytes of the value held in the read buffer, to be stored in a snapshot.
+        //!
+        //! @return Bytes of the read-buffer value, or nothing if the type cannot be stored as raw bytes
+        [[nodiscard]] std::optional<SnapshotValue> getSnapshotValue() const noexcept override
+        {
+            if constexpr (fgc4::utils::String<T>)
+            {
+                return std::as_bytes(std::span(readBuffer()->data(), readBuffer()->size()));
+            }
+            else if constexpr (std::is_trivially_copyable_v<T>)
+            {
+                return std::as_bytes(std::span<const T, 1>(readBuffer(), 1));
+            }
+            else
+            {
+                return {};
+            }
+        }
+
+        //! Sets the value stored in a snapshot to the write buffer. The value is checked against the limits, as
+        //! is a value set from a JSON command, and the Parameter still needs to be validated by its Component.
+        //!
+        //! @param data Raw bytes of the value, as provided by getSnapshotValue
+        //! @return Returns a Warning with relevant information if restoring not successful, nothing otherwise
+        std::optional<fgc4::utils::Warning> restoreSnapshotValue(const SnapshotValue data) override
+        {
+            T value{};
+            if constexpr (fgc4::utils::String<T>)
+            {
+                value.assign(reinterpret_cast<const char*>(data.data()), data.size());
+            }
+            else if constexpr (std::is_trivially_copyable_v<T>)
+            {
+                if (data.size() != sizeof(T))
+                {
+                    fgc4::utils::Warning message(fmt::format(
+                        "Snapshot value of {} has {} bytes, expected: {}.\n", m_metadata.name, data.size(), sizeof(T)
+                    ));
+                    return message;
+                }
+                std::memcpy(&value, data.data(), sizeof(T));
+            }
+            else
+            {
+                fgc4::utils::Warning message(
+                    fmt::format("Type of {} cannot be restored from a snapshot.\n", m_metadata.name)
+                );
+                return message;
+            }
+
+            if constexpr (fgc4::utils::Enumeration<T>)
+            {
+                if (!magic_enum::enum_contains(value))
+                {
+                    fgc4::utils::Warning message(
+                        fmt::format("Snapshot value of {} is not an enum value.\n", m_metadata.name)
+                    );
+                    return message;
+                }
+            }
+            else if constexpr (fgc4::utils::StdArray<T>)
+            {
+                if constexpr (fgc4::utils::Enumeration<typename T::value_type>)
+                {
+                    for (const auto& element : value)
+                    {
+                        if (!magic_enum::enum_contains(element))
+                        {
+                            fgc4::utils::Warning message(
+                                fmt::format("Snapshot value of {} is not an array of enum values.\n", m_metadata.name)
+                            );
+                            return message;
+                        }
+                    }
+                }
+            }
+
+            auto const check_status = checkLimits(value);
+            if (check_status.has_value())
+            {
+                return check_status.value();
+            }
+            *writeBuffer() = value;
+            m_metadata.initialized  = true;
+            return {};
         }
 
         // ************************************************************
 
       private:
-        std::string m_name;     //!< Name of this Parameter
-        Component&  m_parent;   //!< Component owning this Parameter
+        //! State read by the real-time task, placed in the value arena next to the values of the other Parameters
+        struct Values
+        {
+            std::atomic<uint32_t>              generation{0};                 //!< Number of swaps of new values
+            std::array<uint16_t, number_banks> bank_buffers{bankBuffers()};   //!< Buffer held by each bank
+            uint16_t                           write_buffer{number_banks};    //!< Buffer used as the write buffer
+            std::array<T, number_buffers>      buffers{};                     //!< Validated values and write buffer
+        };
 
-        std::array<T, number_buffers> m_value{T{}, T{}};   //!< Double-buffered value stored by this Parameter
+        //! State used by the background task only, placed in the metadata arena
+        struct Metadata
+        {
+            // names are interned in the NameArena, the name is the last part of the full name
+            std::string_view full_name;   //!< Full name of this Parameter, including hierarchy
+            std::string_view name;        //!< Name of this Parameter
+            Component&       parent;      //!< Component owning this Parameter
+
+            LimitType<T> limit_min{};   //!< Minimum numerical value that can be stored
+            LimitType<T> limit_max{};   //!< Maximal numerical value that can be stored
+            bool limit_min_defined{false};   //!< Flag whether the minimum limit has been set, used in serialization
+            bool limit_max_defined{false};   //!< Flag whether the maximum limit has been set, used in serialization
+
+            bool initialized{false};   //!< Flag defining whether the Parameter has been initialized
+            bool validated{false};     //!< Flag defining whether the Parameter has been initialized and validated
+
+            Metadata(Component& owner, std::string_view leaf_name) noexcept
+                : full_name{utils::NameArena::instance().intern(owner.getFullName(), ".", leaf_name)},
+                  name{full_name.substr(full_name.size() - leaf_name.size())},
+                  parent{owner}
+            {
+            }
 
-        T* m_read_buffer{&m_value[0]};    //!< Pointer to the read buffer
-        T* m_write_buffer{&m_value[1]};   //!< Pointer to the write buffer
+            Metadata(Component& owner, std::string_view leaf_name, LimitType<T> min, LimitType<T> max) noexcept
+                : Metadata(owner, leaf_name)
+            {
+                limit_min         = min;
+                limit_max         = max;
+                limit_min_defined = min != std::numeric_limits<LimitType<T>>::lowest();
+                limit_max_defined = max != std::numeric_limits<LimitType<T>>::max();
+            }
+        };
 
-        LimitType<T> m_limit_min;          //!< Minimum numerical value that can be stored
-        LimitType<T> m_limit_max;          //!< Maximal numerical value that can be stored
-        bool m_limit_min_defined{false};   //!< Flag whether the minimum limit has been set, used in serialization
-        bool m_limit_max_defined{false};   //!< Flag whether the maximum limit has been set, used in serialization
+        Values&   m_values;     //!< Values of this Parameter, in the value arena
+        Metadata& m_metadata;   //!< Names, limits and flags of this Parameter, in the metadata arena
 
-        bool m_initialized{false};   //!< Flag defining whether the Parameter has been initialized
-        bool m_validated{false};     //!< Flag defining whether the Parameter has been initialized and validated
+        // ************************************************************
+        // Methods related to accessing the banks of values
+
+        //! Provides the initial indices of the buffers held by the banks of validated values, all buffers but the last
+        //! one.
+        //!
+        //! @return Index of the buffer of each bank
+        constexpr static std::array<uint16_t, number_banks> bankBuffers() noexcept
+        {
+            std::array<uint16_t, number_banks> banks{};
+            for (uint16_t index = 0; index < number_banks; index++)
+            {
+                banks[index] = index;
+            }
+            return banks;
+        }
+
+        //! Provides the buffer of the provided bank.
+        //!
+        //! @param bank Index of the bank
+        //! @return Pointer to the buffer of the bank
+        [[nodiscard]] T* bankBuffer(const uint16_t bank) const noexcept
+        {
+            return &m_values.buffers[m_values.bank_buffers[bank]];
+        }
+
+        //! Provides the buffer of the active bank.
+        //!
+        //! @return Pointer to the read buffer
+        [[nodiscard]] T* readBuffer() const noexcept
+        {
+            return bankBuffer(ParameterBank::active());
+        }
+
+        //! Provides the write buffer.
+        //!
+        //! @return Pointer to the write buffer
+        [[nodiscard]] T* writeBuffer() const noexcept
+        {
+            return &m_values.buffers[m_values.write_buffer];
+        }
 
         // ************************************************************
         // Methods related to checking the numerical limits of the parameter during parameter setting
@@ -359,18 +628,33 @@ namespace vslib
             // check if all of the provided values fit in the limits
             for (auto const& element : value)
             {
-                if (m_limit_min > element || element > m_limit_max)
+                auto const check_status = checkElementLimits(element);
+                if (check_status.has_value())
                 {
-                    fgc4::utils::Warning message(fmt::format(
-                        "Value in the provided array: {} is outside the limits: {}, {}.\n", element, m_limit_min,
-                        m_limit_max
-                    ));
-                    return message;
+                    return check_status;
                 }
             }
             return {};
         }
 
+        //! Checks whether the provided array element falls within the numerical limits specified for this Parameter.
+        //!
+        //! @param element New element value to be checked
+        //! @return Warning with relevant information if check not successful, nothing otherwise
+        std::optional<fgc4::utils::Warning> checkElementLimits(const LimitType<T> element) const noexcept
+            requires fgc4::utils::NumericArray<T>
+        {
+            if (m_metadata.limit_min > element || element > m_metadata.limit_max)
+            {
+                fgc4::utils::Warning message(fmt::format(
+                    "Value in the provided array: {} is outside the limits: {}, {}.\n", element, m_metadata.limit_min,
+                    m_metadata.limit_max
+                ));
+                return message;
+            }
+            return {};
+        }
+
         //! Checks limits of all arithmetic types, if they are defined.
         //!
         //! @param value New parameter value to be checked
@@ -378,10 +662,13 @@ namespace vslib
         std::optional<fgc4::utils::Warning> checkLimits(T value) const noexcept
             requires fgc4::utils::NumericScalar<T>
         {
-            if (value < m_limit_min || value > m_limit_max)
+            if (value < m_metadata.limit_min || value > m_metadata.limit_max)
             {
                 fgc4::utils::Warning message(
-                    fmt::format("Provided value: {} is outside the limits: {}, {}.\n", value, m_limit_min, m_limit_max)
+                    fmt::format(
+                        "Provided value: {} is outside the limits: {}, {}.\n", value, m_metadata.limit_min,
+                        m_metadata.limit_max
+                    )
                 );
                 return message;
             }
@@ -464,7 +751,7 @@ namespace vslib
             }
             else   // no issues, value can be safely set
             {
-                *m_write_buffer = command_value;
+                *writeBuffer() = command_value;
                 return {};
             }
         }
@@ -476,17 +763,17 @@ namespace vslib
         std::optional<fgc4::utils::Warning> setJsonValueImpl(const StaticJson& json_value)
             requires fgc4::utils::Enumeration<T>
         {
-            // json_value is then a string, try to cast to that:
-            auto const enum_element = magic_enum::enum_cast<T>(std::string(json_value));
+            // json_value is either the name or the dense index of the enumeration element:
+            auto const enum_element = enumFromJson<T>(json_value);
             if (enum_element.has_value())
             {
-                *m_write_buffer = enum_element.value();
+                *writeBuffer() = enum_element.value();
             }
             else
             {
-                fgc4::utils::Warning message(
-                    fmt::format("The provided value: {} is not one of the allowed enum values.\n", json_value)
-                );
+                fgc4::utils::Warning message(fmt::format(
+                    "The provided value: {} is not one of the allowed enum values.\n", enumValueLabel(json_value)
+                ));
                 return message;
             }
             return {};
@@ -499,25 +786,173 @@ namespace vslib
         std::optional<fgc4::utils::Warning> setJsonValueImpl(const StaticJson& json_value)
             requires fgc4::utils::StdArray<T> && fgc4::utils::Enumeration<typename T::value_type>
         {
-            // json_value is an array of strings, try to cast every element to the enum type:
-            int counter = 0;
+            if (!json_value.is_array())
+            {
+                fgc4::utils::Warning message(
+                    fmt::format("The provided value: {} is not an array.\n", json_value.dump())
+                );
+                return message;
+            }
+            // a shorter array would leave the last elements of the previous value, a longer one overrun the buffer
+            if (json_value.size() != std::tuple_size_v<T>)
+            {
+                fgc4::utils::Warning message(fmt::format(
+                    "The provided array of {} elements does not match the length: {} of {}.\n", json_value.size(),
+                    std::tuple_size_v<T>, m_metadata.name
+                ));
+                return message;
+            }
+            // json_value is an array of names or dense indices, all of them are checked before any is written:
             for (const auto& value : json_value)
             {
-                auto const enum_element = magic_enum::enum_cast<typename T::value_type>(std::string(value));
-                if (enum_element.has_value())
+                if (!enumFromJson<typename T::value_type>(value).has_value())
+                {
+                    fgc4::utils::Warning message(fmt::format(
+                        "The provided value: {} is not one of the allowed enum values.\n", enumValueLabel(value)
+                    ));
+                    return message;
+                }
+            }
+            size_t counter = 0;
+            for (const auto& value : json_value)
+            {
+                (*writeBuffer())[counter++] = enumFromJson<typename T::value_type>(value).value();
+            }
+            return {};
+        }
+
+        //! Sets the provided JSON array to a range of elements of the write buffer. All elements are checked before
+        //! any of them is written, so that a rejected slice leaves the write buffer unchanged.
+        //!
+        //! @param json_value JSON array containing new element values to be set
+        //! @param offset Index of the first element to be set
+        //! @return If not successful returns Warning with relevant information, nothing otherwise
+        std::optional<fgc4::utils::Warning> setJsonSliceImpl(const StaticJson& json_value, const size_t offset)
+            requires fgc4::utils::StdArray<T>
+        {
+            if (!m_metadata.initialized)
+            {
+                fgc4::utils::Warning message(
+                    fmt::format("Parameter {} needs to be set as a whole before a slice can be set.\n", m_metadata.name)
+                );
+                return message;
+            }
+            if (!json_value.is_array())
+            {
+                fgc4::utils::Warning message(
+                    fmt::format("The provided slice: {} is not an array.\n", json_value.dump())
+                );
+                return message;
+            }
+            if (offset > std::tuple_size_v<T> || json_value.size() > std::tuple_size_v<T> - offset)
+            {
+                fgc4::utils::Warning message(fmt::format(
+                    "The provided slice of {} elements at offset {} exceeds the length: {} of {}.\n", json_value.size(),
+                    offset, std::tuple_size_v<T>, m_metadata.name
+                ));
+                return message;
+            }
+
+            if constexpr (fgc4::utils::NumericArray<T>)
+            {
+                auto const warning = verifyTypeAgrees(json_value);
+                if (warning.has_value())
                 {
-                    (*m_write_buffer)[counter] = enum_element.value();
-                    counter++;
+                    return warning.value();
                 }
-                else
+            }
+
+            // elements are converted twice, once to be checked and once to be written
+            for (const auto& json_element : json_value)
+            {
+                auto const element = convertElement(json_element);
+                if (!element.has_value())
                 {
                     fgc4::utils::Warning message(
-                        fmt::format("The provided value: {} is not one of the allowed enum values.\n", value)
+                        fmt::format(
+                            "The provided element: {} cannot be set to {}.\n", json_element.dump(), m_metadata.name
+                        )
                     );
                     return message;
                 }
+                if constexpr (fgc4::utils::NumericArray<T>)
+                {
+                    auto const check_status = checkElementLimits(element.value());
+                    if (check_status.has_value())
+                    {
+                        return check_status.value();
+                    }
+                }
+            }
+
+            size_t index = offset;
+            for (const auto& json_element : json_value)
+            {
+                (*writeBuffer())[index++] = convertElement(json_element).value();
+            }
+            return {};
+        }
+
+        //! Converts the provided JSON value to an array element of this Parameter.
+        //!
+        //! @param json_element JSON object containing the element value
+        //! @return Converted element value, nothing if the JSON value cannot be converted
+        static std::optional<LimitType<T>> convertElement(const StaticJson& json_element)
+            requires fgc4::utils::StdArray<T>
+        {
+            using ElementType = typename T::value_type;
+
+            if constexpr (fgc4::utils::Enumeration<ElementType>)
+            {
+                return enumFromJson<ElementType>(json_element);
+            }
+            else
+            {
+                try
+                {
+                    return json_element.get<ElementType>();
+                }
+                catch (nlohmann::json::exception&)
+                {
+                    return {};
+                }
+            }
+        }
+
+        //! Converts the provided JSON value to an enumeration element, without allocating. The element is either
+        //! provided by its name, or by its dense index, i.e. its position in the enumeration.
+        //!
+        //! @param json_value JSON object containing the name or the dense index of the element
+        //! @return Enumeration element, nothing if the JSON value is neither a name nor an index of the enumeration
+        template<typename Enum>
+        static std::optional<Enum> enumFromJson(const StaticJson& json_value) noexcept
+        {
+            if (json_value.is_string())
+            {
+                return utils::EnumLookup<Enum>::fromName(json_value.template get_ref<const StaticJson::string_t&>());
+            }
+            if (json_value.is_number_unsigned())
+            {
+                return utils::EnumLookup<Enum>::fromIndex(json_value.template get<uint64_t>());
+            }
+            if (json_value.is_number_integer() && json_value.template get<int64_t>() >= 0)
+            {
+                return utils::EnumLookup<Enum>::fromIndex(static_cast<uint64_t>(json_value.template get<int64_t>()));
             }
             return {};
         }
+
+        //! Provides the label of the provided JSON value of an enumeration element, to be used in warnings.
+        //!
+        //! @param json_value JSON object containing the name or the dense index of the element
+        //! @return Name without quotes if the value is a string, JSON serialization of the value otherwise
+        static std::string enumValueLabel(const StaticJson& json_value)
+        {
+            if (json_value.is_string())
+            {
+                return json_value.template get<std::string>();
+            }
+            return json_value.dump();
+        }
     };
 }   // namespace vslib
@@ -0,0 +1,219 @@
+//! @file
+//! @brief File defining the global selector of the active bank of Parameter values.
+//! @author Dominik Arominski
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <optional>
+
+// Number of banks of validated values held by each settable Parameter, set by the build system
+#ifndef VSLIB_PARAMETER_BANKS
+#define VSLIB_PARAMETER_BANKS 1
+#endif
+
+namespace vslib
+{
+    //! Number of banks of validated values held by each settable Parameter
+    constexpr uint16_t number_banks = VSLIB_PARAMETER_BANKS;
+    //! Number of buffers of each settable Parameter: all banks and the staging buffer for new values
+    constexpr uint16_t number_buffers = number_banks + 1;
+
+    static_assert(number_banks > 0, "At least one bank of Parameter values is required.");
+
+    //! Global selector of the bank of values read by all Parameters. Each bank holds a complete set of pre-validated
+    //! Parameter values, e.g. tuning for different users of a super-cycle, and switching between them is a single
+    //! index update, to be done by the real-time task at a cycle boundary. Banks are loaded in the background with
+    //! commands, while another bank is active.
+    //!
+    //! A switch can also be scheduled for an activation tick, in any monotonic time base shared by the real-time task
+    //! and the sender of the commands, e.g. a SyncTime timestamp. The real-time task calls update at the top of its
+    //! handler, which costs a single comparison when nothing is scheduled, and commits the switch at the first call
+    //! whose tick has reached the activation tick, i.e. at the first cycle boundary at or after it. The switch is
+    //! claimed atomically, so it is either committed by the real-time task or cancelled in the background, never
+    //! both, and it is never committed with the tick of a switch it has replaced.
+    class ParameterBank
+    {
+      public:
+        //! Activation tick of a switch that is not scheduled
+        constexpr static uint64_t no_activation = std::numeric_limits<uint64_t>::max();
+
+        //! Provides the index of the bank currently read by all Parameters.
+        //!
+        //! @return Index of the active bank
+        [[nodiscard]] static uint16_t active() noexcept
+        {
+            if constexpr (number_banks == 1)
+            {
+                return 0;
+            }
+            else
+            {
+                return m_active_bank.load(std::memory_order_relaxed);
+            }
+        }
+
+        //! Selects the bank read by all Parameters from now on.
+        //!
+        //! @param bank Index of the bank to be selected
+        //! @return True if the bank has been selected, false if the index is out of range
+        static bool select(const uint16_t bank) noexcept
+        {
+            if (bank >= number_banks)
+            {
+                return false;
+            }
+            m_active_bank.store(bank, std::memory_order_relaxed);
+            m_switches.fetch_add(1, std::memory_order_release);
+            return true;
+        }
+
+        //! Provides the number of times the active bank has been selected, so that values cached from Parameters can
+        //! be refreshed after a switch, together with the generations of the Parameters.
+        //!
+        //! @return Number of bank switches
+        [[nodiscard]] static uint32_t switches() noexcept
+        {
+            if constexpr (number_banks == 1)
+            {
+                return 0;
+            }
+            else
+            {
+                return m_switches.load(std::memory_order_acquire);
+            }
+        }
+
+        //! Provides the index of the bank receiving the values validated in the background. Components derive the
+        //! values they keep from their Parameters for this bank, see BankedValue.
+        //!
+        //! @return Index of the bank being loaded
+        [[nodiscard]] static uint16_t loading() noexcept
+        {
+            if constexpr (number_banks == 1)
+            {
+                return 0;
+            }
+            else
+            {
+                return m_loading_bank;
+            }
+        }
+
+        //! Selects the bank receiving the values validated in the background from now on. To be called by the
+        //! background task only.
+        //!
+        //! @param bank Index of the bank to be loaded
+        //! @return True if the bank has been selected, false if the index is out of range
+        static bool load(const uint16_t bank) noexcept
+        {
+            if (bank >= number_banks)
+            {
+                return false;
+            }
+            m_loading_bank = bank;
+            return true;
+        }
+
+        //! Schedules a switch to the provided bank at the activation tick, replacing any switch already scheduled. To
+        //! be called by the background task only.
+        //!
+        //! @param bank Index of the bank to be selected
+        //! @param activation_tick Tick at which the bank is selected by update
+        //! @return True if the switch has been scheduled, false if the index is out of range
+        static bool schedule(const uint16_t bank, const uint64_t activation_tick) noexcept
+        {
+            if (bank >= number_banks)
+            {
+                return false;
+            }
+            // the switch is disarmed while its tick is replaced, so that the real-time task never commits half of it
+            m_schedule.store(nextSchedule(no_bank), std::memory_order_relaxed);
+            m_activation_tick.store(activation_tick, std::memory_order_release);
+            m_schedule.store(nextSchedule(bank), std::memory_order_release);
+            return true;
+        }
+
+        //! Cancels the scheduled switch, if any. To be called by the background task only.
+        //!
+        //! @return Index of the bank of the cancelled switch, or nothing if no switch was pending, including when the
+        //! real-time task has just committed it
+        static std::optional<uint16_t> cancel() noexcept
+        {
+            const uint16_t bank = bankOf(m_schedule.exchange(nextSchedule(no_bank), std::memory_order_acq_rel));
+            if (bank == no_bank)
+            {
+                return {};
+            }
+            return bank;
+        }
+
+        //! Provides the bank of the scheduled switch.
+        //!
+        //! @return Index of the bank to be selected, or nothing if no switch is scheduled
+        [[nodiscard]] static std::optional<uint16_t> scheduled() noexcept
+        {
+            const uint16_t bank = bankOf(m_schedule.load(std::memory_order_acquire));
+            if (bank == no_bank)
+            {
+                return {};
+            }
+            return bank;
+        }
+
+        //! Commits the scheduled switch when its activation tick has been reached. To be called by the real-time task
+        //! at the top of its handler.
+        //!
+        //! @param tick Current tick, in the time base of the scheduled activation
+        static void update(const uint64_t tick) noexcept
+        {
+            uint64_t schedule = m_schedule.load(std::memory_order_acquire);
+            if (bankOf(schedule) != no_bank
+                && tick >= m_activation_tick.load(std::memory_order_acquire)) [[unlikely]]
+            {
+                // the switch is claimed only if it has been neither cancelled nor replaced since it has been read, as
+                // the tick read above belongs to it then
+                const uint64_t claimed = (schedule & ~bank_mask) | no_bank;
+                if (m_schedule.compare_exchange_strong(schedule, claimed, std::memory_order_acq_rel, std::memory_order_relaxed))
+                {
+                    m_active_bank.store(bankOf(schedule), std::memory_order_relaxed);
+                    m_switches.fetch_add(1, std::memory_order_release);
+                }
+            }
+        }
+
+      private:
+        //! Bank of the schedule when no switch is pending
+        constexpr static uint16_t no_bank = std::numeric_limits<uint16_t>::max();
+        //! Bits of the schedule holding the bank, the others hold the sequence number of the schedule
+        constexpr static uint64_t bank_mask = std::numeric_limits<uint16_t>::max();
+
+        //! Provides the bank of the schedule.
+        //!
+        //! @param schedule Bank and sequence number of a schedule
+        //! @return Index of the bank to be selected, or no_bank if no switch is pending
+        [[nodiscard]] static uint16_t bankOf(const uint64_t schedule) noexcept
+        {
+            return static_cast<uint16_t>(schedule & bank_mask);
+        }
+
+        //! Provides a new schedule for the bank. Each schedule set in the background has a sequence number of its own,
+        //! so that the real-time task never claims a switch that has been replaced in the meantime by an equal one.
+        //!
+        //! @param bank Index of the bank to be selected, or no_bank
+        //! @return Bank and sequence number of the new schedule
+        [[nodiscard]] static uint64_t nextSchedule(const uint16_t bank) noexcept
+        {
+            return (++m_sequence << 16U) | bank;
+        }
+
+        inline static std::atomic<uint16_t> m_active_bank{0};                   //!< Index of the active bank
+        inline static std::atomic<uint64_t> m_schedule{no_bank};                //!< Bank and sequence of the switch
+        inline static std::atomic<uint64_t> m_activation_tick{no_activation};   //!< Tick of the scheduled switch
+        inline static std::atomic<uint32_t> m_switches{0};                      //!< Number of bank switches
+        inline static uint16_t              m_loading_bank{0};                  //!< Bank loaded in the background
+        inline static uint64_t              m_sequence{0};                      //!< Last schedule sequence number
+    };
+}   // namespace vslib
@@ -0,0 +1,89 @@
+//! @file
+//! @brief File defining the cache of plain values derived from Parameters, refreshed only when the Parameters change.
+//! @author Dominik Arominski
+
+#pragma once
+
+#include <cstdint>
+#include <tuple>
+
+#include "parameter.hpp"
+#include "parameterBank.hpp"
+
+namespace vslib
+{
+    //! Plain-value copy of values derived from a set of Parameters, to be read by the real-time task instead of the
+    //! Parameters themselves. The values are derived again only when a new value has been swapped into one of the
+    //! Parameters or the active bank has been switched, otherwise reading them costs a comparison of generations.
+    //!
+    //! @tparam Cached Type of the cached values, e.g. a structure of thresholds
+    //! @tparam Types Types of the Parameters the cached values are derived from
+    template<typename Cached, typename... Types>
+    class ParameterCache
+    {
+      public:
+        //! Function deriving the cached values from the read-buffer values of the Parameters
+        using Derive = Cached (*)(const Types&...) noexcept;
+
+        //! Constructor of the cache, deriving the values from the current values of the Parameters.
+        //!
+        //! @param derive Function deriving the cached values from the values of the Parameters, in order
+        //! @param parameters Parameters the cached values are derived from, expected to outlive the cache
+        ParameterCache(const Derive derive, const Parameter<Types>&... parameters) noexcept
+            : m_derive{derive},
+              m_parameters{parameters...}
+        {
+            refresh(generation());
+        }
+
+        //! Provides the cached values, derived again first if any of the Parameters may have changed.
+        //!
+        //! @return Values derived from the read-buffer values of the Parameters
+        [[nodiscard]] const Cached& get() noexcept
+        {
+            const uint32_t current = generation();
+            if (current != m_generation) [[unlikely]]
+            {
+                refresh(current);
+            }
+            return m_cached;
+        }
+
+      private:
+        Derive                                 m_derive;          //!< Function deriving the cached values
+        std::tuple<const Parameter<Types>&...> m_parameters;      //!< Parameters the values are derived from
+        uint32_t                               m_generation{0};   //!< Generation the cached values are derived at
+        Cached                                 m_cached{};        //!< Cached values
+
+        //! Provides the combined generation of the Parameters. Each generation only grows, so their sum changes
+        //! whenever any of them does.
+        //!
+        //! @return Sum of the generations of the Parameters and of the number of bank switches
+        [[nodiscard]] uint32_t generation() const noexcept
+        {
+            return std::apply(
+                [](const auto&... parameter) noexcept
+                {
+                    return ParameterBank::switches() + (parameter.generation() + ... + uint32_t{0});
+                },
+                m_parameters
+            );
+        }
+
+        //! Derives the cached values from the Parameters. The generation is read before the values, so that a value
+        //! swapped in between is derived again on the next access.
+        //!
+        //! @param current Generation read before the values
+        void refresh(const uint32_t current) noexcept
+        {
+            m_generation = current;
+            m_cached     = std::apply(
+                [this](const auto&... parameter) noexcept
+                {
+                    return m_derive(parameter.value()...);
+                },
+                m_parameters
+            );
+        }
+    };
+}   // namespace vslib
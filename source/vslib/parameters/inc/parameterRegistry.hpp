@@ -8,6 +8,7 @@
 #include <functional>
 #include <map>
 #include <string>
+#include <string_view>
 
 #include "iparameter.hpp"
 #include "json/json.hpp"
@@ -38,7 +39,7 @@ namespace vslib
             return m_parameters;
         }
 
-        //! Adds a new entry to the Parameter registry.
+        //! Adds a new entry to the Parameter registry. The name is interned in the NameArena, unless it already is.
         //!
         //! @param parameter_name Name of the parameter to be added to the parameter registry
         //! @param parameter_reference Reference to the parameter being added to the parameter registry
@@ -62,7 +63,8 @@ namespace vslib
 
       private:
         ParameterRegistry() = default;                              //!< Default constructor
-        std::map<std::string, ParameterReference> m_parameters{};   //!< Map holding references to all Parameters
+        //! Map holding references to all Parameters, keyed by their full names interned in the NameArena
+        std::map<std::string_view, ParameterReference, std::less<>> m_parameters{};
 
         //! Checks the name formatting of the provided full parameter name and throws an exception if the name
         //! is not-conforming.
@@ -48,19 +48,10 @@ namespace vslib
         [[nodiscard]] StaticJson serialize(const Parameter<T>& parameter) const noexcept
             requires fgc4::utils::Enumeration<T>
         {
-            StaticJson serialized_parameter
-                = {{"type", fgc4::utils::getTypeLabel<T>()},
-                   {"length", magic_enum::enum_count<T>()},
-                   {"fields", magic_enum::enum_names<T>()}};
-            if (parameter.isInitialized())
-            {
-                serialized_parameter["value"] = magic_enum::enum_name(parameter.value());
-            }
-            else
-            {
-                serialized_parameter["value"] = nlohmann::json::object();
-            }
-            return serialized_parameter;
+            return {{"type", fgc4::utils::getTypeLabel<T>()},
+                    {"length", magic_enum::enum_count<T>()},
+                    {"fields", magic_enum::enum_names<T>()},
+                    {"value", serializeValue(parameter)}};
         }
 
         //! Serializes std::array type by exposing the length of the array, individual limits in case of a numeric
@@ -88,32 +79,7 @@ namespace vslib
             {
                 serialized_parameter["fields"] = magic_enum::enum_names<typename T::value_type>();
             }
-
-            if (parameter.isInitialized())
-            {
-                if constexpr (fgc4::utils::Enumeration<typename T::value_type>)
-                {
-                    // special case for the enumerations, otherwise the array would be serialized as array of integers
-                    // with index of the selected enumeration field rather than the name
-                    serialized_parameter["value"] = nlohmann::json::array();
-                    std::transform(
-                        parameter.value().cbegin(), parameter.value().cend(),
-                        std::back_inserter(serialized_parameter["value"]),
-                        [](const auto& value)
-                        {
-                            return magic_enum::enum_name(value);
-                        }
-                    );
-                }
-                else
-                {
-                    serialized_parameter["value"] = parameter.value();
-                }
-            }
-            else
-            {
-                serialized_parameter["value"] = nlohmann::json::array();
-            }
+            serialized_parameter["value"] = serializeValue(parameter);
             return serialized_parameter;
         }
 
@@ -124,17 +90,9 @@ namespace vslib
         [[nodiscard]] StaticJson serialize(const Parameter<T>& parameter) const noexcept
             requires fgc4::utils::String<T>
         {
-            StaticJson serialized_parameter
-                = {{"type", fgc4::utils::getTypeLabel<T>()}, {"length", parameter.value().size()}};
-            if (parameter.isInitialized())
-            {
-                serialized_parameter["value"] = parameter.value();
-            }
-            else
-            {
-                serialized_parameter["value"] = nlohmann::json::object();
-            }
-            return serialized_parameter;
+            return {{"type", fgc4::utils::getTypeLabel<T>()},
+                    {"length", parameter.value().size()},
+                    {"value", serializeValue(parameter)}};
         }
 
         //! Serializes numeric types: integers and floating point numbers.
@@ -153,14 +111,7 @@ namespace vslib
             {
                 serialized_parameter["limit_max"] = parameter.getLimitMax();
             }
-            if (parameter.isInitialized())
-            {
-                serialized_parameter["value"] = parameter.value();
-            }
-            else
-            {
-                serialized_parameter["value"] = nlohmann::json::object();
-            }
+            serialized_parameter["value"] = serializeValue(parameter);
             return serialized_parameter;
         }
 
@@ -173,5 +124,67 @@ namespace vslib
             static_assert(fgc4::utils::always_false<T>, "Type currently not serializable.");
             return {};
         }
+
+        // ************************************************************
+        // Methods related to serialization of the values only, without the metadata
+
+        //! Serializes the current value of the provided Parameter, without its type, limits or fields.
+        //!
+        //! @param parameter Parameter to be serialized
+        //! @return JSON with serialized value, an empty object or array if the Parameter is not initialized
+        [[nodiscard]] StaticJson serializeValue(const IParameter& parameter) const noexcept
+        {
+            return parameter.serializeValue(*this);
+        }
+
+        //! Serializes the read-buffer value of a Parameter. Enumerations are serialized with the names of their
+        //! fields, not their indices.
+        //!
+        //! @return JSON with serialized value, an empty object or array if the Parameter is not initialized
+        template<typename T>
+        [[nodiscard]] StaticJson serializeValue(const Parameter<T>& parameter) const noexcept
+        {
+            if (!parameter.isInitialized())
+            {
+                if constexpr (fgc4::utils::StdArray<T>)
+                {
+                    return nlohmann::json::array();
+                }
+                else
+                {
+                    return nlohmann::json::object();
+                }
+            }
+
+            if constexpr (fgc4::utils::Enumeration<T>)
+            {
+                return magic_enum::enum_name(parameter.value());
+            }
+            else if constexpr (fgc4::utils::StdArray<T>)
+            {
+                if constexpr (fgc4::utils::Enumeration<typename T::value_type>)
+                {
+                    // special case for the enumerations, otherwise the array would be serialized as array of integers
+                    // with index of the selected enumeration field rather than the name
+                    StaticJson serialized_value = nlohmann::json::array();
+                    std::transform(
+                        parameter.value().cbegin(), parameter.value().cend(), std::back_inserter(serialized_value),
+                        [](const auto& value)
+                        {
+                            return magic_enum::enum_name(value);
+                        }
+                    );
+                    return serialized_value;
+                }
+                else
+                {
+                    return parameter.value();
+                }
+            }
+            else
+            {
+                return parameter.value();
+            }
+        }
     };
 }   // namespace vslib
\ No newline at end of file
@@ -0,0 +1,44 @@
+//! @file
+//! @brief File defining the storage shared by all Parameters, separating their values from their metadata.
+//! @author Dominik Arominski
+
+#pragma once
+
+#include "bumpArena.hpp"
+
+namespace vslib
+{
+    //! Storage of the state of all Parameters, split in two arenas. The values of the Parameters, the indices of their
+    //! banks and their generations, read by the real-time task, are placed densely one after the other in the value
+    //! arena, so that the Parameters of a Component share cache lines. The names, limits and flags, only used by the
+    //! background task, are kept apart in the metadata arena.
+    //!
+    //! Parameters need to be created and destroyed before the real-time task starts or after it stops, as the arenas
+    //! are not thread safe and the real-time task reads the values in place. They are expected to be created once at
+    //! startup and to live until the end of the program. The storage is never released before then: a Parameter
+    //! destroyed earlier, e.g. in unit tests, leaves its storage to the next Parameter of the same type, which is then
+    //! no longer adjacent to the other Parameters of its Component.
+    class ParameterStorage
+    {
+      public:
+        //! Provides the arena holding the values of all Parameters, read by the real-time task.
+        //!
+        //! @return Arena of the values
+        static utils::BumpArena& values()
+        {
+            // Arena is constructed on first access
+            static utils::BumpArena m_values;
+            return m_values;
+        }
+
+        //! Provides the arena holding the metadata of all Parameters, used by the background task only.
+        //!
+        //! @return Arena of the metadata
+        static utils::BumpArena& metadata()
+        {
+            // Arena is constructed on first access
+            static utils::BumpArena m_metadata;
+            return m_metadata;
+        }
+    };
+}   // namespace vslib
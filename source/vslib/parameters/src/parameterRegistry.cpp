@@ -7,6 +7,7 @@
 #include "errorCodes.hpp"
 #include "errorMessage.hpp"
 #include "fmt/format.h"
+#include "nameArena.hpp"
 #include "parameterRegistry.hpp"
 
 using namespace nlohmann;
@@ -62,7 +63,7 @@ namespace vslib
 
     void ParameterRegistry::addToRegistry(std::string_view parameter_name, IParameter& parameter_reference)
     {
-        if (m_parameters.find(std::string(parameter_name)) != m_parameters.end())
+        if (m_parameters.find(parameter_name) != m_parameters.end())
         {
             Error error_message(
                 std::string("Parameter name: ") + std::string(parameter_name)
@@ -72,6 +73,10 @@ namespace vslib
             throw std::runtime_error("Parameter name already exists!");
         }
         checkNameFormatting(parameter_name);
-        m_parameters.emplace(parameter_name, parameter_reference);
+        // names of Parameters are already interned, other names need to be copied to outlive the caller
+        auto& arena = utils::NameArena::instance();
+        m_parameters.emplace(
+            arena.holds(parameter_name) ? parameter_name : arena.intern(parameter_name), parameter_reference
+        );
     }
 }   // namespace vslib
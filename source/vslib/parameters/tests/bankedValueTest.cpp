@@ -0,0 +1,70 @@
+//! @file
+//! @brief File with unit tests of the values derived from Parameters for each bank.
+//! @author Dominik Arominski
+
+#include <gtest/gtest.h>
+
+#include "bankedValue.hpp"
+#include "parameterBank.hpp"
+
+using namespace vslib;
+
+class BankedValueTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        ParameterBank::select(0);
+        ParameterBank::load(0);
+    }
+
+    void TearDown() override
+    {
+        ParameterBank::select(0);
+        ParameterBank::load(0);
+    }
+};
+
+//! Checks that the initial value and the first derived value are set to all banks
+TEST_F(BankedValueTest, FirstValueSetToAllBanks)
+{
+    BankedValue<double> value(1.0);
+    for (uint16_t bank = 0; bank < number_banks; bank++)
+    {
+        ASSERT_TRUE(ParameterBank::select(bank));
+        EXPECT_EQ(value.value(), 1.0);
+    }
+
+    ASSERT_TRUE(ParameterBank::load(number_banks - 1));
+    value.set(2.0);
+    for (uint16_t bank = 0; bank < number_banks; bank++)
+    {
+        ASSERT_TRUE(ParameterBank::select(bank));
+        EXPECT_EQ(value.value(), 2.0);
+    }
+}
+
+//! Checks that values derived after the first one are set to the bank being loaded only
+TEST_F(BankedValueTest, ValueSetToLoadingBank)
+{
+    if constexpr (number_banks < 2)
+    {
+        GTEST_SKIP() << "Several banks of Parameter values are required.";
+    }
+
+    BankedValue<int> value;
+    value.set(1);
+
+    ASSERT_TRUE(ParameterBank::load(1));
+    EXPECT_EQ(ParameterBank::loading(), 1);
+    value.set(2);
+    EXPECT_EQ(value.value(), 1);   // bank 0 still active
+
+    ASSERT_TRUE(ParameterBank::select(1));
+    EXPECT_EQ(value.value(), 2);
+    ASSERT_TRUE(ParameterBank::select(0));
+    EXPECT_EQ(value.value(), 1);
+
+    EXPECT_FALSE(ParameterBank::load(number_banks));
+    EXPECT_EQ(ParameterBank::loading(), 1);
+}
@@ -0,0 +1,153 @@
+//! @file
+//! @brief File with unit tests of the generations of Parameters and of the cache of values derived from them.
+//! @author Dominik Arominski
+
+#include <gtest/gtest.h>
+
+#include "component.hpp"
+#include "mockRoot.hpp"
+#include "parameter.hpp"
+#include "parameterCache.hpp"
+#include "parameterRegistry.hpp"
+
+using namespace vslib;
+
+class ParameterCacheTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        ParameterRegistry::instance().clearRegistry();
+        ParameterBank::select(0);
+        ParameterBank::cancel();
+        derivations = 0;
+    }
+
+    void TearDown() override
+    {
+        ParameterRegistry::instance().clearRegistry();
+    }
+
+    //! Sets and validates a new value of the provided Parameter.
+    template<typename T>
+    static void setValue(Component& component, Parameter<T>& parameter, const T value)
+    {
+        ASSERT_FALSE(parameter.setJsonValue(value).has_value());
+        component.flipBufferState();
+        component.synchroniseParameterBuffers();
+        component.setParametersValidated();
+    }
+
+    //! Derives the sum of the values, counting the derivations.
+    static double deriveSum(const double& first, const int& second) noexcept
+    {
+        derivations++;
+        return first + second;
+    }
+
+    inline static size_t derivations{0};   //!< Number of calls to deriveSum
+};
+
+namespace
+{
+    class MockComponent : public Component
+    {
+      public:
+        MockComponent(MockRoot& parent)
+            : Component("mockType", "mock_name", parent)
+        {
+        }
+    };
+}
+
+//! Checks that the generation of a Parameter grows with each swap of new values only
+TEST_F(ParameterCacheTest, Generation)
+{
+    MockRoot          root;
+    MockComponent     component(root);
+    Parameter<double> parameter(component, "parameter");
+    EXPECT_EQ(parameter.generation(), 0);
+
+    ASSERT_FALSE(parameter.setJsonValue(1.0).has_value());
+    component.synchroniseParameterBuffers();
+    EXPECT_EQ(parameter.generation(), 0);
+
+    component.flipBufferState();
+    EXPECT_EQ(parameter.generation(), 1);
+    component.synchroniseParameterBuffers();
+    EXPECT_EQ(parameter.generation(), 1);
+}
+
+//! Checks that the cached values are derived at construction and again only after a Parameter has changed
+TEST_F(ParameterCacheTest, RefreshOnChange)
+{
+    MockRoot          root;
+    MockComponent     component(root);
+    Parameter<double> first(component, "first");
+    Parameter<int>    second(component, "second");
+
+    ParameterCache<double, double, int> cache(&deriveSum, first, second);
+    EXPECT_EQ(derivations, 1);
+    EXPECT_EQ(cache.get(), 0.0);
+
+    setValue(component, first, 1.5);
+    setValue(component, second, 2);
+    EXPECT_EQ(cache.get(), 3.5);
+    EXPECT_EQ(derivations, 2);
+
+    for (int read = 0; read < 10; read++)
+    {
+        EXPECT_EQ(cache.get(), 3.5);
+    }
+    EXPECT_EQ(derivations, 2);
+
+    // a value staged in the write buffer is not visible until it is swapped in
+    ASSERT_FALSE(second.setJsonValue(4).has_value());
+    EXPECT_EQ(cache.get(), 3.5);
+    EXPECT_EQ(derivations, 2);
+
+    component.flipBufferState();
+    EXPECT_EQ(cache.get(), 5.5);
+    EXPECT_EQ(derivations, 3);
+}
+
+//! Checks that the cached values are derived again after the active bank has been switched
+TEST_F(ParameterCacheTest, RefreshOnBankSwitch)
+{
+    if constexpr (number_banks < 2)
+    {
+        GTEST_SKIP() << "Several banks of Parameter values are required.";
+    }
+
+    MockRoot          root;
+    MockComponent     component(root);
+    Parameter<double> first(component, "first");
+    Parameter<int>    second(component, "second");
+    // the first valid values are set to all banks
+    ASSERT_FALSE(first.setJsonValue(1.0).has_value());
+    ASSERT_FALSE(second.setJsonValue(1).has_value());
+    component.flipBufferState();
+    component.synchroniseParameterBuffers();
+    component.setParametersValidated();
+
+    // the second bank is loaded while the first one is active
+    component.synchroniseParameterBuffers(1);
+    ASSERT_FALSE(first.setJsonValue(10.0).has_value());
+    component.flipBufferState(1);
+    component.synchroniseParameterBuffers(1);
+
+    ParameterCache<double, double, int> cache(&deriveSum, first, second);
+    EXPECT_EQ(cache.get(), 2.0);
+    const size_t derived = derivations;
+
+    ASSERT_TRUE(ParameterBank::select(1));
+    EXPECT_EQ(cache.get(), 11.0);
+    EXPECT_EQ(derivations, derived + 1);
+
+    ParameterBank::schedule(0, 5);
+    ParameterBank::update(4);
+    EXPECT_EQ(cache.get(), 11.0);
+    ParameterBank::update(5);
+    EXPECT_EQ(cache.get(), 2.0);
+    EXPECT_EQ(derivations, derived + 2);
+}
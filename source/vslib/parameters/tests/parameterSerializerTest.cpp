@@ -334,3 +334,43 @@ TEST_F(ParameterTest, EnumArrayParameterSerializationWithValue)
     nlohmann::json fields = {"field1", "field2", "field3"};
     EXPECT_EQ(serialized_parameter["fields"], fields);
 }
+
+// ************************************************************
+// Tests of serialization of the values only
+
+//! Tests serialization of the values of Parameters without their metadata
+TEST_F(ParameterTest, ParameterValueSerialization)
+{
+    MockRoot      root;
+    MockComponent component(root);   // component to attach parameters to
+    enum class TestEnum
+    {
+        field1,
+        field2
+    };
+    Parameter<double>                  scalar(component, "double", -10.0, 10.0);
+    Parameter<TestEnum>                enumeration(component, "enum");
+    Parameter<std::array<TestEnum, 2>> enum_array(component, "enum_array");
+    Parameter<std::array<int32_t, 3>>  int_array(component, "int_array");
+    ParameterSerializer                serializer;
+
+    // values of Parameters that have not been initialized are empty
+    EXPECT_EQ(serializer.serializeValue(scalar), nlohmann::json::object());
+    EXPECT_EQ(serializer.serializeValue(int_array), nlohmann::json::array());
+
+    ASSERT_FALSE(scalar.setJsonValue(2.5).has_value());
+    ASSERT_FALSE(enumeration.setJsonValue("field2").has_value());
+    ASSERT_FALSE(enum_array.setJsonValue(std::array<std::string, 2>{"field2", "field1"}).has_value());
+    ASSERT_FALSE(int_array.setJsonValue(std::array<int32_t, 3>{1, 2, 3}).has_value());
+    component.flipBufferState();
+
+    EXPECT_EQ(serializer.serializeValue(static_cast<const IParameter&>(scalar)), 2.5);
+    EXPECT_EQ(serializer.serializeValue(static_cast<const IParameter&>(enumeration)), "field2");
+    EXPECT_EQ(serializer.serializeValue(static_cast<const IParameter&>(enum_array)).dump(), "[\"field2\",\"field1\"]");
+    EXPECT_EQ(serializer.serializeValue(static_cast<const IParameter&>(int_array)).dump(), "[1,2,3]");
+
+    // the value is the same as in the full serialization
+    EXPECT_EQ(
+        serializer.serialize(static_cast<const IParameter&>(int_array))["value"], serializer.serializeValue(int_array)
+    );
+}
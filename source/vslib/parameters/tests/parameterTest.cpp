@@ -2,7 +2,9 @@
 //! @brief File with unit tests of Parameter class.
 //! @author Dominik Arominski
 
+#include <atomic>
 #include <gtest/gtest.h>
+#include <thread>
 
 #include "component.hpp"
 #include "json/json.hpp"
@@ -21,6 +23,8 @@ class ParameterTest : public ::testing::Test
         // the registry would persist between tests
         ParameterRegistry& registry = ParameterRegistry::instance();
         registry.clearRegistry();
+        ParameterBank::select(0);
+        ParameterBank::cancel();
     }
 
     void TearDown() override
@@ -359,6 +363,41 @@ TEST_F(ParameterTest, EnumArrayParameterSetValue)
     EXPECT_TRUE(component.parametersInitialized());
 }
 
+//! Tests setting value to enum Parameters from the dense indices of their elements
+TEST_F(ParameterTest, EnumParameterSetIndex)
+{
+    MockRoot      root;
+    MockComponent component(root);   // component to attach parameters to
+    enum class TestEnum
+    {
+        field1 = 2,
+        field2 = 5,
+        field3 = 9
+    };
+    Parameter<TestEnum>                enumeration(component, "enum");
+    Parameter<std::array<TestEnum, 3>> enum_array(component, "enum_array");
+
+    nlohmann::json command = nlohmann::json::parse(R"({"value": 1, "array": [2, 0, 1]})");
+    EXPECT_FALSE(enumeration.setJsonValue(command["value"]).has_value());
+    EXPECT_FALSE(enum_array.setJsonValue(command["array"]).has_value());
+    component.flipBufferState();
+
+    EXPECT_EQ(enumeration.value(), TestEnum::field2);   // index, not the underlying value
+    EXPECT_EQ(enum_array.value(), (std::array<TestEnum, 3>{TestEnum::field3, TestEnum::field1, TestEnum::field2}));
+
+    // names and indices can be mixed, but an index out of range rejects the whole array
+    EXPECT_TRUE(enumeration.setJsonValue(3).has_value());
+    EXPECT_TRUE(enumeration.setJsonValue(-1).has_value());
+    EXPECT_TRUE(enumeration.setJsonValue(1.0).has_value());
+    auto const output = enum_array.setJsonValue(nlohmann::json::parse(R"(["field3", 1, 5])"));
+    ASSERT_TRUE(output.has_value());
+    EXPECT_EQ(
+        fmt::format("{}", output.value()), "Warning: The provided value: 5 is not one of the allowed enum values.\n"
+    );
+    component.flipBufferState();
+    EXPECT_EQ(enum_array.value(), (std::array<TestEnum, 3>{TestEnum::field3, TestEnum::field1, TestEnum::field2}));
+}
+
 //! Tests setting value to array of double Parameter from a JSON command
 TEST_F(ParameterTest, DoubleArrayParameterSetValue)
 {
@@ -387,6 +426,89 @@ TEST_F(ParameterTest, DoubleArrayParameterSetValue)
     EXPECT_TRUE(component.parametersInitialized());
 }
 
+//! Tests setting a slice of an array of double Parameter from a JSON command
+TEST_F(ParameterTest, DoubleArrayParameterSetSlice)
+{
+    MockRoot                         root;
+    MockComponent                    component(root);   // component to attach parameters to
+    Parameter<std::array<double, 5>> parameter(component, "double_array", -5, 5);
+
+    ASSERT_FALSE(parameter.setJsonValue(std::array<double, 5>{0.1, 1.2, 2.3, 3.4, 4.5}).has_value());
+    component.flipBufferState();
+    parameter.syncWriteBuffer();
+
+    nlohmann::json command = {{"value", std::array<double, 2>{-1.0, -2.0}}};
+    auto           output  = parameter.setJsonSlice(command["value"], 3);
+    EXPECT_FALSE(output.has_value());
+    component.flipBufferState();
+    EXPECT_EQ(parameter.value(), (std::array<double, 5>{0.1, 1.2, 2.3, -1.0, -2.0}));
+
+    // a slice reaching the last element is accepted, even when it is a single element
+    parameter.syncWriteBuffer();
+    EXPECT_FALSE(parameter.setJsonSlice(nlohmann::json::array({4.0}), 4).has_value());
+    component.flipBufferState();
+    EXPECT_EQ(parameter[4], 4.0);
+}
+
+//! Tests setting a slice of an array of enum Parameter from a JSON command
+TEST_F(ParameterTest, EnumArrayParameterSetSlice)
+{
+    MockRoot      root;
+    MockComponent component(root);   // component to attach parameters to
+    enum class TestEnum
+    {
+        field1,
+        field2,
+        field3
+    };
+    Parameter<std::array<TestEnum, 3>> parameter(component, "enum_array");
+
+    ASSERT_FALSE(parameter.setJsonValue(std::array<std::string, 3>{"field1", "field1", "field1"}).has_value());
+    auto output = parameter.setJsonSlice(std::array<std::string, 2>{"field3", "field2"}, 1);
+    EXPECT_FALSE(output.has_value());
+    component.flipBufferState();
+    EXPECT_EQ(parameter.value(), (std::array<TestEnum, 3>{TestEnum::field1, TestEnum::field3, TestEnum::field2}));
+}
+
+//! Tests that invalid slices are rejected without modifying any element of the Parameter
+TEST_F(ParameterTest, ArrayParameterSetInvalidSlice)
+{
+    MockRoot                      root;
+    MockComponent                 component(root);   // component to attach parameters to
+    Parameter<std::array<int, 4>> parameter(component, "int_array", -5, 5);
+    Parameter<int>                scalar(component, "int");
+
+    auto output = parameter.setJsonSlice(std::array<int, 1>{1}, 0);
+    ASSERT_TRUE(output.has_value());
+    EXPECT_EQ(
+        std::string(output.value().warning_str.data()),
+        "Parameter int_array needs to be set as a whole before a slice can be set.\n"
+    );
+
+    ASSERT_FALSE(parameter.setJsonValue(std::array<int, 4>{1, 2, 3, 4}).has_value());
+
+    output = parameter.setJsonSlice(std::array<int, 2>{1, 2}, 3);
+    ASSERT_TRUE(output.has_value());
+    EXPECT_EQ(
+        std::string(output.value().warning_str.data()),
+        "The provided slice of 2 elements at offset 3 exceeds the length: 4 of int_array.\n"
+    );
+
+    // the first element is valid, but none is written because the second one is outside the limits
+    output = parameter.setJsonSlice(std::array<int, 2>{0, 10}, 0);
+    ASSERT_TRUE(output.has_value());
+    output = parameter.setJsonSlice(std::array<double, 2>{0.5, 1.0}, 0);
+    ASSERT_TRUE(output.has_value());
+    output = parameter.setJsonSlice(1, 0);
+    ASSERT_TRUE(output.has_value());
+    component.flipBufferState();
+    EXPECT_EQ(parameter.value(), (std::array<int, 4>{1, 2, 3, 4}));
+
+    output = scalar.setJsonSlice(std::array<int, 1>{1}, 0);
+    ASSERT_TRUE(output.has_value());
+    EXPECT_EQ(std::string(output.value().warning_str.data()), "Parameter int is not an array, slice not set.\n");
+}
+
 // ************************************************************
 // Tests of attempting to set an invalid value via JSON
 
@@ -497,6 +619,42 @@ TEST_F(ParameterTest, EnumArrayParameterSetInvalidValue)
     EXPECT_FALSE(component.parametersInitialized());
 }
 
+//! Tests that an array of enum Parameter rejects JSON arrays not matching its length, and values that are not arrays
+TEST_F(ParameterTest, EnumArrayParameterSetInvalidLength)
+{
+    MockRoot      root;
+    MockComponent component(root);
+    enum class TestEnum
+    {
+        field1,
+        field2
+    };
+    Parameter<std::array<TestEnum, 3>> parameter(component, "enum_array");
+
+    auto output = parameter.setJsonValue(nlohmann::json::parse(R"(["field2", "field1"])"));
+    ASSERT_TRUE(output.has_value());
+    EXPECT_EQ(
+        fmt::format("{}", output.value()),
+        "Warning: The provided array of 2 elements does not match the length: 3 of enum_array.\n"
+    );
+
+    output = parameter.setJsonValue(nlohmann::json::parse(R"(["field2", "field1", "field2", "field1"])"));
+    ASSERT_TRUE(output.has_value());
+    EXPECT_EQ(
+        fmt::format("{}", output.value()),
+        "Warning: The provided array of 4 elements does not match the length: 3 of enum_array.\n"
+    );
+
+    output = parameter.setJsonValue(nlohmann::json::parse(R"("field2")"));
+    ASSERT_TRUE(output.has_value());
+    EXPECT_EQ(fmt::format("{}", output.value()), "Warning: The provided value: \"field2\" is not an array.\n");
+    EXPECT_FALSE(parameter.isInitialized());
+
+    // a value of the right length is still accepted
+    EXPECT_FALSE(parameter.setJsonValue(nlohmann::json::parse(R"(["field2", "field1", "field2"])")).has_value());
+    EXPECT_EQ(parameter.toValidate(), (std::array<TestEnum, 3>{TestEnum::field2, TestEnum::field1, TestEnum::field2}));
+}
+
 //! Tests setting value to array of enum Parameter from a JSON command
 TEST_F(ParameterTest, EnumBitMaskArrayParameterSetInvalidValue)
 {
@@ -790,3 +948,121 @@ TEST_F(ParameterTest, DoubleParameterValueOperations)
     EXPECT_EQ(lhs < (rhs * 2), true);
     EXPECT_EQ((lhs - 1) < rhs, true);
 }
+
+// ************************************************************
+// Tests of banks of Parameter values
+
+//! Checks that the first value flipped into a bank is set to all banks, and later values to the chosen bank only
+TEST_F(ParameterTest, ParameterBanks)
+{
+    if constexpr (number_banks < 2)
+    {
+        GTEST_SKIP() << "Several banks of Parameter values are required.";
+    }
+
+    MockRoot          root;
+    MockComponent     component(root);
+    Parameter<double> parameter(component, "parameter");
+
+    ASSERT_FALSE(parameter.setJsonValue(1.0).has_value());
+    component.flipBufferState(0);
+    component.synchroniseParameterBuffers(0);
+    component.setParametersValidated();
+    for (uint16_t bank = 0; bank < number_banks; bank++)
+    {
+        ASSERT_TRUE(ParameterBank::select(bank));
+        EXPECT_EQ(parameter.value(), 1.0);
+    }
+
+    ASSERT_TRUE(ParameterBank::select(0));
+    component.synchroniseParameterBuffers(1);
+    ASSERT_FALSE(parameter.setJsonValue(2.0).has_value());
+    component.flipBufferState(1);
+    component.synchroniseParameterBuffers(1);
+    EXPECT_EQ(parameter.value(), 1.0);
+    EXPECT_EQ(parameter.toValidate(), 2.0);
+
+    ASSERT_TRUE(ParameterBank::select(1));
+    EXPECT_EQ(ParameterBank::active(), 1);
+    EXPECT_EQ(parameter.value(), 2.0);
+
+    EXPECT_FALSE(ParameterBank::select(number_banks));
+    EXPECT_EQ(ParameterBank::active(), 1);
+}
+
+//! Checks that a scheduled switch of the bank is committed at the first update reaching its activation tick
+TEST_F(ParameterTest, ParameterBankScheduledSwitch)
+{
+    if constexpr (number_banks < 2)
+    {
+        GTEST_SKIP() << "Several banks of Parameter values are required.";
+    }
+
+    EXPECT_FALSE(ParameterBank::scheduled().has_value());
+    EXPECT_FALSE(ParameterBank::schedule(number_banks, 100));
+
+    ASSERT_TRUE(ParameterBank::schedule(1, 100));
+    ASSERT_TRUE(ParameterBank::scheduled().has_value());
+    EXPECT_EQ(ParameterBank::scheduled().value(), 1);
+
+    ParameterBank::update(99);
+    EXPECT_EQ(ParameterBank::active(), 0);
+    ParameterBank::update(100);
+    EXPECT_EQ(ParameterBank::active(), 1);
+    EXPECT_FALSE(ParameterBank::scheduled().has_value());
+
+    // a switch is committed once only
+    ASSERT_TRUE(ParameterBank::select(0));
+    ParameterBank::update(101);
+    EXPECT_EQ(ParameterBank::active(), 0);
+
+    ASSERT_TRUE(ParameterBank::schedule(1, 200));
+    EXPECT_EQ(ParameterBank::cancel(), std::optional<uint16_t>(1));
+    ParameterBank::update(200);
+    EXPECT_EQ(ParameterBank::active(), 0);
+
+    // a switch committed by the real-time task can no longer be cancelled
+    ASSERT_TRUE(ParameterBank::schedule(1, 300));
+    ParameterBank::update(301);
+    EXPECT_EQ(ParameterBank::active(), 1);
+    EXPECT_FALSE(ParameterBank::cancel().has_value());
+}
+
+//! Checks that a scheduled switch is either committed by the real-time task or cancelled in the background, never
+//! both nor neither, while both run concurrently
+TEST_F(ParameterTest, ParameterBankConcurrentSwitch)
+{
+    if constexpr (number_banks < 2)
+    {
+        GTEST_SKIP() << "Several banks of Parameter values are required.";
+    }
+
+    constexpr uint32_t    number_schedules = 10'000;
+    std::atomic<bool>     done{false};
+    std::atomic<uint64_t> tick{0};
+    const uint32_t        switches_before = ParameterBank::switches();
+
+    std::thread real_time(
+        [&]()
+        {
+            while (!done.load())
+            {
+                ParameterBank::update(tick.fetch_add(1));
+            }
+        }
+    );
+
+    uint32_t cancelled = 0;
+    for (uint32_t index = 0; index < number_schedules; index++)
+    {
+        ParameterBank::schedule(index % number_banks, tick.load() + index % 3);
+        if (ParameterBank::cancel().has_value())
+        {
+            cancelled++;
+        }
+    }
+    done.store(true);
+    real_time.join();
+
+    EXPECT_EQ(ParameterBank::switches() - switches_before + cancelled, number_schedules);
+}
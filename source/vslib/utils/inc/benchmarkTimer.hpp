@@ -0,0 +1,48 @@
+//! @file
+//! @brief Helpers measuring execution time of short functions, used by the benchmarks.
+//! @author Dominik Arominski
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <fmt/format.h>
+#include <string_view>
+
+namespace vslib::utils
+{
+    //! Measures the average duration of a single call to the provided function. The function is called once before
+    //! the measurement starts, so that caches and branch predictors are warmed up.
+    //!
+    //! @param function Function to be benchmarked, taking the index of the repetition as the only argument
+    //! @param repetitions Number of measured calls
+    //! @return Average duration of one call, in nanoseconds
+    template<typename Function>
+    [[nodiscard]] double averageCallDuration(Function&& function, const size_t repetitions)
+    {
+        function(size_t{0});
+
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t index = 0; index < repetitions; index++)
+        {
+            function(index);
+        }
+        const auto stop = std::chrono::steady_clock::now();
+
+        return std::chrono::duration<double, std::nano>(stop - start).count() / static_cast<double>(repetitions);
+    }
+
+    //! Prints the result of a benchmark together with its relation to a baseline, to keep track of the performance
+    //! in the test logs.
+    //!
+    //! @param name Name of the benchmarked case
+    //! @param duration Average duration of one call, in nanoseconds
+    //! @param baseline_duration Average duration of one call of the reference implementation, in nanoseconds
+    inline void printBenchmark(const std::string_view name, const double duration, const double baseline_duration)
+    {
+        fmt::print(
+            "[ benchmark ] {}: {:.2f} ns per call, baseline: {:.2f} ns per call, speed-up: {:.2f}\n", name, duration,
+            baseline_duration, baseline_duration / duration
+        );
+    }
+}   // namespace vslib::utils
@@ -0,0 +1,150 @@
+//! @file
+//! @brief File containing the append-only arena placing objects densely in cache-aligned blocks.
+//! @author Dominik Arominski
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include "nonCopyableNonMovable.hpp"
+
+namespace vslib::utils
+{
+    //! Arena constructing objects one after the other in large blocks aligned to cache lines. Objects created one
+    //! after the other are therefore adjacent in memory. The storage is never moved. Objects destroyed with destroy
+    //! leave their storage to the next object created with the same size and alignment, which is then no longer
+    //! adjacent to the objects created before it. The blocks are released with the arena. The arena is not thread
+    //! safe.
+    class BumpArena : public NonCopyableNonMovable
+    {
+      public:
+        //! Size of a cache line, the alignment of the blocks
+        constexpr static size_t cache_line_size = 64;
+
+        //! Constructor of the arena.
+        //!
+        //! @param block_size Size of each block of the arena, larger objects are stored in a dedicated block
+        explicit BumpArena(const size_t block_size = 16384) noexcept
+            : m_block_size(block_size)
+        {
+        }
+
+        //! Constructs an object in the arena.
+        //!
+        //! @param arguments Arguments forwarded to the constructor of the object
+        //! @return Reference to the constructed object
+        template<typename T, typename... Arguments>
+        [[nodiscard]] T& create(Arguments&&... arguments)
+        {
+            static_assert(alignof(T) <= cache_line_size, "The blocks of the arena are aligned to a cache line.");
+
+            void* storage = nullptr;
+            // the storage of a destroyed object of the same size and alignment is reused first
+            const auto free_slot = std::find_if(
+                m_free_slots.begin(), m_free_slots.end(),
+                [](const FreeSlot& slot)
+                {
+                    return slot.size == sizeof(T) && slot.alignment == alignof(T);
+                }
+            );
+            if (free_slot != m_free_slots.end())
+            {
+                storage = free_slot->storage;
+                m_free_slots.erase(free_slot);
+                m_used_bytes += sizeof(T);
+            }
+            else
+            {
+                storage = allocate(sizeof(T), alignof(T));
+            }
+            return *std::construct_at(static_cast<T*>(storage), std::forward<Arguments>(arguments)...);
+        }
+
+        //! Destroys an object created in the arena, keeping its storage for the next object of the same size and
+        //! alignment.
+        //!
+        //! @param object Object to be destroyed, created with create
+        template<typename T>
+        void destroy(T& object)
+        {
+            std::destroy_at(&object);
+            m_free_slots.push_back({&object, sizeof(T), alignof(T)});
+            m_used_bytes -= sizeof(T);
+        }
+
+        //! Provides storage of the provided size and alignment, directly following the previous allocation when it
+        //! fits in the current block.
+        //!
+        //! @param size Number of bytes to be allocated
+        //! @param alignment Alignment of the storage, a power of two up to the size of a cache line
+        //! @return Pointer to the storage
+        [[nodiscard]] void* allocate(const size_t size, const size_t alignment)
+        {
+            // a stricter alignment than the one of the blocks cannot be guaranteed
+            assert(std::has_single_bit(alignment) && alignment <= cache_line_size);
+
+            const size_t aligned = (m_position + alignment - 1) & ~(alignment - 1);
+            if (m_blocks.empty() || aligned + size > m_current_size)
+            {
+                m_current_size = std::max(size, m_block_size);
+                m_blocks.emplace_back(
+                    static_cast<std::byte*>(::operator new[](m_current_size, std::align_val_t{cache_line_size}))
+                );
+                m_position = 0;
+                return allocate(size, alignment);
+            }
+            m_position    = aligned + size;
+            m_used_bytes += size;
+            return m_blocks.back().get() + aligned;
+        }
+
+        //! Provides the number of bytes taken by all live objects, excluding the padding between them.
+        //!
+        //! @return Number of used bytes
+        [[nodiscard]] size_t usedBytes() const noexcept
+        {
+            return m_used_bytes;
+        }
+
+        //! Provides the number of heap allocations made by the arena, i.e. the number of its blocks.
+        //!
+        //! @return Number of allocated blocks
+        [[nodiscard]] size_t blockCount() const noexcept
+        {
+            return m_blocks.size();
+        }
+
+      private:
+        //! Storage left by a destroyed object
+        struct FreeSlot
+        {
+            void*  storage;     //!< Address of the storage
+            size_t size;        //!< Size of the destroyed object
+            size_t alignment;   //!< Alignment of the destroyed object
+        };
+
+        //! Releases the blocks with the alignment they have been allocated with
+        struct AlignedDelete
+        {
+            void operator()(std::byte* block) const noexcept
+            {
+                ::operator delete[](block, std::align_val_t{cache_line_size});
+            }
+        };
+
+        size_t m_block_size;        //!< Size of the blocks
+        size_t m_current_size{0};   //!< Size of the last block
+        size_t m_position{0};       //!< Offset of the first free byte of the last block
+        size_t m_used_bytes{0};     //!< Number of bytes taken by all objects
+
+        std::vector<std::unique_ptr<std::byte[], AlignedDelete>> m_blocks{};       //!< Blocks holding the objects
+        std::vector<FreeSlot>                                    m_free_slots{};   //!< Storage of destroyed objects
+    };
+}   // namespace vslib::utils
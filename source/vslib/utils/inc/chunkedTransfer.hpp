@@ -0,0 +1,135 @@
+//! @file
+//! @brief File containing helpers for the chunked transfer of array Parameters larger than a single queue message.
+//! @author Dominik Arominski
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "fnvHash.hpp"
+
+namespace vslib::utils
+{
+    //! Stages of a chunked transfer, set as the "transfer" field of the commands
+    namespace transfer_stage
+    {
+        constexpr std::string_view begin = "begin";   //!< Announces the number of elements, value: element count
+        constexpr std::string_view chunk = "chunk";   //!< Sets a slice of elements, value: array of elements
+        constexpr std::string_view end   = "end";     //!< Completes the transfer, value: checksum of all chunks
+    }
+
+    static_assert(std::endian::native == std::endian::little, "Chunk checksums hash little-endian element values.");
+
+    //! Computes the FNV-1a hash of the binary value of a chunk element, chained with the provided hash. Integers are
+    //! hashed as 8-byte two's complement, floating-point numbers as 8-byte IEEE 754 doubles, booleans as a single
+    //! byte and strings as their bytes followed by a null byte, all little-endian. The elements of nested arrays are
+    //! hashed in order, other values are not hashed.
+    //!
+    //! @param element JSON value of the element
+    //! @param hash Hash of the previous elements
+    //! @return Hash of all elements up to and including this one
+    template<typename Json>
+    [[nodiscard]] uint64_t elementChecksum(const Json& element, const uint64_t hash)
+    {
+        const auto hash_bytes = [hash](const auto binary)
+        {
+            return fnv1aHash(std::as_bytes(std::span(&binary, 1)), hash);
+        };
+        if (element.is_number_unsigned())
+        {
+            return hash_bytes(element.template get<uint64_t>());
+        }
+        if (element.is_number_integer())
+        {
+            return hash_bytes(element.template get<int64_t>());
+        }
+        if (element.is_number_float())
+        {
+            return hash_bytes(element.template get<double>());
+        }
+        if (element.is_boolean())
+        {
+            return hash_bytes(static_cast<uint8_t>(element.template get<bool>()));
+        }
+        if (element.is_string())
+        {
+            const auto& text = element.template get_ref<const typename Json::string_t&>();
+            return fnv1aHash(std::string_view("\0", 1), fnv1aHash(text, hash));
+        }
+        uint64_t result = hash;
+        if (element.is_array())
+        {
+            for (const auto& nested : element)
+            {
+                result = elementChecksum(nested, result);
+            }
+        }
+        return result;
+    }
+
+    //! Computes the checksum of the value of a chunk, chained with the checksum of the previous chunks. The checksum
+    //! is the FNV-1a hash of the binary values of the chunk elements, see elementChecksum, in the order they are sent.
+    //! Unlike a hash of the JSON text, it does not depend on how the sender formats numbers.
+    //!
+    //! @param value JSON array with the elements of the chunk
+    //! @param hash Checksum of the previous chunks
+    //! @return Checksum of all chunks up to and including this one
+    template<typename Json>
+    [[nodiscard]] uint64_t chunkChecksum(const Json& value, const uint64_t hash = fnv_offset_basis)
+    {
+        uint64_t result = hash;
+        for (const auto& element : value)
+        {
+            result = elementChecksum(element, result);
+        }
+        return result;
+    }
+
+    //! Splits a command setting an array Parameter into the commands of a chunked transfer: one command beginning
+    //! the transfer, one command per chunk of at most chunk_length elements, and one command ending it with the
+    //! checksum of all chunks. All other fields of the command are copied to every command of the transfer.
+    //!
+    //! @param command Command with an array value
+    //! @param chunk_length Maximal number of elements of each chunk, needs to be larger than zero
+    //! @return Commands of the chunked transfer, to be sent in order
+    template<typename Json>
+    [[nodiscard]] std::vector<Json> splitIntoChunks(const Json& command, const size_t chunk_length)
+    {
+        const auto& value = command["value"];
+
+        std::vector<Json> commands;
+        commands.reserve((value.size() + chunk_length - 1) / chunk_length + 2);
+
+        Json begin        = command;
+        begin["transfer"] = transfer_stage::begin;
+        begin["value"]    = value.size();
+        commands.push_back(std::move(begin));
+
+        uint64_t checksum = fnv_offset_basis;
+        for (size_t offset = 0; offset < value.size(); offset += chunk_length)
+        {
+            const size_t length = std::min(chunk_length, value.size() - offset);
+            const auto   first  = value.begin() + static_cast<std::ptrdiff_t>(offset);
+            const auto   last   = first + static_cast<std::ptrdiff_t>(length);
+
+            Json chunk        = command;
+            chunk["transfer"] = transfer_stage::chunk;
+            chunk["offset"]   = offset;
+            chunk["value"]    = Json(first, last);
+            checksum          = chunkChecksum(chunk["value"], checksum);
+            commands.push_back(std::move(chunk));
+        }
+
+        Json end        = command;
+        end["transfer"] = transfer_stage::end;
+        end["value"]    = checksum;
+        commands.push_back(std::move(end));
+        return commands;
+    }
+}   // namespace vslib::utils
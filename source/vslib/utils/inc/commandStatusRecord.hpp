@@ -0,0 +1,199 @@
+//! @file
+//! @brief File containing the binary status record sent back for each batch of JSON commands.
+//! @author Dominik Arominski
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "constants.hpp"
+#include "messageQueue.hpp"
+
+namespace vslib::utils
+{
+    //! Result of the execution of a single command
+    enum class CommandResult : uint8_t
+    {
+        success,               //!< Parameter value updated
+        invalid_command,       //!< Command does not follow the command schema
+        version_mismatch,      //!< Inconsistent major version of the communication interface
+        parameter_not_found,   //!< No Parameter with the provided name is registered
+        value_rejected         //!< The Parameter refused the provided value
+    };
+
+    //! Status of a single command of a batch
+    struct CommandStatus
+    {
+        uint16_t      command_id;      //!< Index of the command within its batch
+        CommandResult result;          //!< Result of the command execution
+        uint8_t       message_index;   //!< Index of the message explaining the result, or no_message
+
+        bool operator==(const CommandStatus& other) const = default;
+    };
+
+    //! Contents of a decoded status record
+    struct DecodedCommandStatusRecord
+    {
+        uint32_t                      batch_sequence;   //!< Sequence number of the batch of commands
+        std::vector<CommandStatus>    statuses;         //!< Status of each command of the batch
+        std::vector<std::string_view> messages;         //!< Messages referred to by the statuses
+    };
+
+    //! Compact status of a batch of commands, written to the status queue as a single message. The record starts with
+    //! a header holding the batch sequence number, followed by a fixed-size status of each command, and the
+    //! null-terminated messages referred to by the statuses. Messages are optional: a message is dropped when it does
+    //! not fit in the record, while the result code of the command is always kept.
+    //!
+    //! The record is sized to half of the status queue, so that the records of two consecutive batches can be in the
+    //! queue at the same time. The first byte of a record is never a valid first byte of a text status.
+    class CommandStatusRecord
+    {
+        struct Header
+        {
+            uint8_t  marker;
+            uint8_t  number_messages;
+            uint16_t number_statuses;
+            uint32_t batch_sequence;
+        };
+
+      public:
+        //! First byte of each record, distinguishing it from text statuses
+        constexpr static uint8_t marker = 0xFF;
+        //! Message index of statuses without a message
+        constexpr static uint8_t no_message = 0xFF;
+        //! Maximal size of a serialized record, in bytes
+        constexpr static size_t capacity
+            = (fgc4::utils::constants::string_memory_pool_size - sizeof(fgc4::utils::MessageQueueShmem)) / 2
+              - sizeof(size_t);
+        //! Maximal number of command statuses in a single record
+        constexpr static size_t max_statuses = (capacity - sizeof(Header)) / sizeof(CommandStatus);
+
+        //! Creates an empty status record.
+        //!
+        //! @param batch_sequence Sequence number of the batch of commands
+        explicit CommandStatusRecord(const uint32_t batch_sequence = 0) noexcept
+            : m_batch_sequence{batch_sequence}
+        {
+        }
+
+        //! Adds the status of a command to the record.
+        //!
+        //! @param command_id Index of the command within its batch
+        //! @param result Result of the command execution
+        //! @param message Optional message explaining the result, dropped if it does not fit in the record
+        //! @return True if the status was added, false if the record is full
+        bool add(const uint16_t command_id, const CommandResult result, const std::string_view message = {}) noexcept
+        {
+            if (size() + sizeof(CommandStatus) > capacity)
+            {
+                return false;
+            }
+
+            uint8_t message_index = no_message;
+            if (!message.empty() && m_number_messages < no_message
+                && size() + sizeof(CommandStatus) + message.size() + 1 <= capacity)
+            {
+                std::memcpy(&m_messages[m_messages_size], message.data(), message.size());
+                m_messages_size               += message.size();
+                m_messages[m_messages_size++]  = '\0';
+                message_index                  = m_number_messages++;
+            }
+            m_statuses[m_number_statuses++] = {command_id, result, message_index};
+            return true;
+        }
+
+        //! Returns the size of the serialized record.
+        //!
+        //! @return Size of the record in bytes
+        [[nodiscard]] size_t size() const noexcept
+        {
+            return sizeof(Header) + m_number_statuses * sizeof(CommandStatus) + m_messages_size;
+        }
+
+        //! Checks whether any status has been added to the record.
+        //!
+        //! @return True if the record holds no status, false otherwise
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return m_number_statuses == 0;
+        }
+
+        //! Serializes the record to its binary form.
+        //!
+        //! @return View of the serialized record, valid until the record is modified
+        [[nodiscard]] std::span<const uint8_t> serialize() noexcept
+        {
+            const Header header{marker, m_number_messages, m_number_statuses, m_batch_sequence};
+            const size_t statuses_size = m_number_statuses * sizeof(CommandStatus);
+
+            std::memcpy(m_buffer.data(), &header, sizeof(Header));
+            std::memcpy(m_buffer.data() + sizeof(Header), m_statuses.data(), statuses_size);
+            std::memcpy(m_buffer.data() + sizeof(Header) + statuses_size, m_messages.data(), m_messages_size);
+            return {m_buffer.data(), size()};
+        }
+
+        //! Removes all statuses and messages, keeping the batch sequence number, e.g. to continue a batch with more
+        //! commands than fit in a single record.
+        void clear() noexcept
+        {
+            m_number_statuses = 0;
+            m_number_messages = 0;
+            m_messages_size   = 0;
+        }
+
+        //! Decodes a serialized record.
+        //!
+        //! @param message Message read from the status queue
+        //! @return Decoded record, with messages referring to the provided message, or nothing if the message is not
+        //! a valid record
+        [[nodiscard]] static std::optional<DecodedCommandStatusRecord> decode(const std::span<const uint8_t> message)
+        {
+            if (message.size() < sizeof(Header) || message[0] != marker)
+            {
+                return {};
+            }
+            Header header;
+            std::memcpy(&header, message.data(), sizeof(Header));
+
+            const size_t statuses_size = header.number_statuses * sizeof(CommandStatus);
+            if (message.size() < sizeof(Header) + statuses_size)
+            {
+                return {};
+            }
+
+            DecodedCommandStatusRecord record{header.batch_sequence, {}, {}};
+            record.statuses.resize(header.number_statuses);
+            std::memcpy(record.statuses.data(), message.data() + sizeof(Header), statuses_size);
+
+            const auto* cursor = reinterpret_cast<const char*>(message.data()) + sizeof(Header) + statuses_size;
+            const auto* end    = reinterpret_cast<const char*>(message.data()) + message.size();
+            for (uint8_t index = 0; index < header.number_messages; index++)
+            {
+                const auto* terminator = static_cast<const char*>(std::memchr(cursor, '\0', end - cursor));
+                if (terminator == nullptr)
+                {
+                    return {};
+                }
+                record.messages.emplace_back(cursor, terminator - cursor);
+                cursor = terminator + 1;
+            }
+            return record;
+        }
+
+      private:
+        uint32_t m_batch_sequence;       //!< Sequence number of the batch of commands
+        uint16_t m_number_statuses{0};   //!< Number of statuses added to the record
+        uint8_t  m_number_messages{0};   //!< Number of messages added to the record
+        size_t   m_messages_size{0};     //!< Total size of the null-terminated messages
+
+        std::array<CommandStatus, max_statuses> m_statuses;   //!< Statuses of the commands
+        std::array<char, capacity>              m_messages;   //!< Null-terminated messages
+        std::array<uint8_t, capacity>           m_buffer;     //!< Serialized record
+    };
+}   // namespace vslib::utils
@@ -0,0 +1,156 @@
+//! @file
+//! @brief File containing the compile-time lookup of enumeration fields by their names and dense indices.
+//! @author Dominik Arominski
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string_view>
+
+#include "fnvHash.hpp"
+#include "magic_enum.hpp"
+
+namespace vslib::utils
+{
+    //! Lookup of the fields of an enumeration by their names, using a hash table generated at compile time. Converting
+    //! a name does not allocate and compares it with a single field name in most cases: the seed of the hash is chosen
+    //! so that no two names share a slot whenever possible, which makes the hash perfect.
+    //!
+    //! Fields can also be encoded with their dense index, the position of the field in the enumeration, for
+    //! protocols that avoid strings.
+    //!
+    //! @tparam Enum Enumeration type
+    template<typename Enum>
+    class EnumLookup
+    {
+        constexpr static auto   names  = magic_enum::enum_names<Enum>();
+        constexpr static auto   values = magic_enum::enum_values<Enum>();
+        constexpr static size_t count  = names.size();
+
+        //! Table four times larger than the number of fields, so that a perfect seed is quickly found
+        constexpr static size_t   table_size   = std::bit_ceil(count * 4 + 1);
+        constexpr static uint16_t empty_slot   = std::numeric_limits<uint16_t>::max();
+        constexpr static size_t   max_attempts = 64;   //!< Number of seeds tried to find a perfect hash
+
+        static_assert(count < empty_slot, "Enumeration has too many fields.");
+
+        struct Table
+        {
+            uint64_t                         seed{fnv_offset_basis};   //!< Seed of the hash of the names
+            size_t                           max_probe{0};             //!< Longest displacement from a home slot
+            std::array<uint16_t, table_size> slots{};                  //!< Index of the field held by each slot
+        };
+
+      public:
+        //! Provides the field with the provided name.
+        //!
+        //! @param name Name of the field
+        //! @return Field with the provided name, nothing if there is no such field
+        [[nodiscard]] constexpr static std::optional<Enum> fromName(const std::string_view name) noexcept
+        {
+            const size_t home = fnv1aHash(name, m_table.seed) & (table_size - 1);
+            for (size_t probe = 0; probe <= m_table.max_probe; probe++)
+            {
+                const auto index = m_table.slots[(home + probe) & (table_size - 1)];
+                if (index != empty_slot && names[index] == name)
+                {
+                    return values[index];
+                }
+            }
+            return {};
+        }
+
+        //! Provides the field with the provided dense index.
+        //!
+        //! @param index Position of the field in the enumeration
+        //! @return Field at the provided index, nothing if the index is out of range
+        [[nodiscard]] constexpr static std::optional<Enum> fromIndex(const uint64_t index) noexcept
+        {
+            if (index >= count)
+            {
+                return {};
+            }
+            return values[index];
+        }
+
+        //! Provides the dense index of the provided field.
+        //!
+        //! @param value Field of the enumeration
+        //! @return Position of the field in the enumeration, nothing if the value is not a field
+        [[nodiscard]] constexpr static std::optional<size_t> toIndex(const Enum value) noexcept
+        {
+            for (size_t index = 0; index < count; index++)
+            {
+                if (values[index] == value)
+                {
+                    return index;
+                }
+            }
+            return {};
+        }
+
+        //! Provides the number of fields of the enumeration.
+        //!
+        //! @return Number of fields
+        [[nodiscard]] constexpr static size_t size() noexcept
+        {
+            return count;
+        }
+
+        //! Checks whether the hash of the names is perfect, i.e. each name is found in its home slot.
+        //!
+        //! @return True if each name lookup compares a single name, false otherwise
+        [[nodiscard]] constexpr static bool isPerfect() noexcept
+        {
+            return m_table.max_probe == 0;
+        }
+
+      private:
+        //! Fills the table with linear probing for the provided seed.
+        //!
+        //! @param seed Seed of the hash of the names
+        //! @return Table holding all fields
+        constexpr static Table fillTable(const uint64_t seed) noexcept
+        {
+            Table table{seed, 0, {}};
+            table.slots.fill(empty_slot);
+            for (size_t index = 0; index < count; index++)
+            {
+                const size_t home  = fnv1aHash(names[index], seed) & (table_size - 1);
+                size_t       probe = 0;
+                while (table.slots[(home + probe) & (table_size - 1)] != empty_slot)
+                {
+                    probe++;
+                }
+                table.slots[(home + probe) & (table_size - 1)] = static_cast<uint16_t>(index);
+                table.max_probe                                = std::max(table.max_probe, probe);
+            }
+            return table;
+        }
+
+        //! Searches for the seed with the shortest displacement, stopping at the first perfect one.
+        //!
+        //! @return Table to be used for the lookups
+        constexpr static Table createTable() noexcept
+        {
+            Table best = fillTable(fnv_offset_basis);
+            for (uint64_t attempt = 1; attempt < max_attempts && best.max_probe > 0; attempt++)
+            {
+                const Table table = fillTable(fnv_offset_basis + attempt * fnv_prime);
+                if (table.max_probe < best.max_probe)
+                {
+                    best = table;
+                }
+            }
+            return best;
+        }
+
+        constexpr static Table m_table = createTable();   //!< Hash table generated at compile time
+    };
+}   // namespace vslib::utils
@@ -7,20 +7,233 @@
 #include <cmath>
 #include <compare>
 #include <cstdint>
+#include <limits>
+#include <optional>
+#include <type_traits>
 
 #include "typeTraits.hpp"
 
+namespace vslib
+{
+    //! Rounding applied when fractional bits are dropped, e.g. after a multiplication or a division.
+    enum class RoundingMode
+    {
+        nearest,       //!< Round to the nearest, ties towards positive infinity
+        nearestEven,   //!< Round to the nearest, ties to even (convergent rounding), free of the bias of ties up
+        floor,         //!< Round towards negative infinity, i.e. an arithmetic shift right
+        towardZero,    //!< Round towards zero, as the integer division does
+    };
+}   // namespace vslib
+
+namespace vslib::utils
+{
+    __extension__ typedef __int128 int128_t;   //!< Intermediate type of 64-bit products and quotients
+
+    //! Integer type twice as wide as T, able to hold the product of any two values of T.
+    template<fgc4::utils::Integral T>
+    using WideType = std::conditional_t<(sizeof(T) <= sizeof(int32_t)), int64_t, int128_t>;
+
+    //! Adds two values, saturating at the limits of their type instead of wrapping around.
+    //!
+    //! @param lhs First addend
+    //! @param rhs Second addend
+    //! @return Sum of both addends, clipped to the representable range of T
+    template<fgc4::utils::Integral T>
+    [[nodiscard]] constexpr T saturatingAdd(const T lhs, const T rhs) noexcept
+    {
+        T result;
+        if (__builtin_add_overflow(lhs, rhs, &result))
+        {
+            return (rhs > 0) ? std::numeric_limits<T>::max() : std::numeric_limits<T>::min();
+        }
+        return result;
+    }
+
+    //! Subtracts two values, saturating at the limits of their type instead of wrapping around.
+    //!
+    //! @param lhs Minuend
+    //! @param rhs Subtrahend
+    //! @return Difference of both values, clipped to the representable range of T
+    template<fgc4::utils::Integral T>
+    [[nodiscard]] constexpr T saturatingSubtract(const T lhs, const T rhs) noexcept
+    {
+        T result;
+        if (__builtin_sub_overflow(lhs, rhs, &result))
+        {
+            return (rhs < 0) ? std::numeric_limits<T>::max() : std::numeric_limits<T>::min();
+        }
+        return result;
+    }
+
+    //! Clips a wider intermediate value to the limits of the type T.
+    //!
+    //! @param value Value to be clipped, e.g. a product calculated in WideType<T>
+    //! @return Value saturated to the representable range of T
+    template<fgc4::utils::Integral T, typename W>
+    [[nodiscard]] constexpr T saturate(const W value) noexcept
+    {
+        if (value > static_cast<W>(std::numeric_limits<T>::max()))
+        {
+            return std::numeric_limits<T>::max();
+        }
+        if (value < static_cast<W>(std::numeric_limits<T>::min()))
+        {
+            return std::numeric_limits<T>::min();
+        }
+        return static_cast<T>(value);
+    }
+
+    //! Shifts the value right by the provided number of bits, rounding the dropped bits with the chosen mode.
+    //!
+    //! @param value Value to be shifted
+    //! @param shift Number of bits to shift right, e.g. number of fractional bits to be dropped
+    //! @return Rounded value
+    template<RoundingMode mode, typename W>
+    [[nodiscard]] constexpr W roundingShift(const W value, const int16_t shift) noexcept
+    {
+        if (shift <= 0)
+        {
+            return value;
+        }
+
+        if constexpr (mode == RoundingMode::floor)
+        {
+            return value >> shift;
+        }
+        else if constexpr (mode == RoundingMode::towardZero)
+        {
+            return (value < 0) ? (value + ((W(1) << shift) - 1)) >> shift : value >> shift;
+        }
+        else if constexpr (mode == RoundingMode::nearestEven)
+        {
+            const W half      = W(1) << (shift - 1);
+            const W truncated = value >> shift;
+            const W remainder = value - (truncated << shift);
+            return (remainder > half || (remainder == half && (truncated & 1) != 0)) ? truncated + 1 : truncated;
+        }
+        else
+        {
+            // adding the first dropped bit instead of the half cannot overflow
+            return (value >> shift) + ((value >> (shift - 1)) & 1);
+        }
+    }
+
+    //! Divides two values, rounding the quotient with the chosen mode.
+    //!
+    //! @param dividend Value to be divided
+    //! @param divisor Value to divide by, needs to be different from zero
+    //! @return Rounded quotient
+    template<RoundingMode mode, typename W>
+    [[nodiscard]] constexpr W roundingDivide(const W dividend, const W divisor) noexcept
+    {
+        const W    quotient  = dividend / divisor;
+        const W    remainder = dividend % divisor;
+        const bool negative  = (dividend < 0) != (divisor < 0);
+        if (remainder == 0 || mode == RoundingMode::towardZero)
+        {
+            return quotient;
+        }
+        if constexpr (mode == RoundingMode::floor)
+        {
+            return negative ? quotient - 1 : quotient;
+        }
+        else
+        {
+            // remainder is always smaller than the divisor in magnitude, so doubling it cannot overflow
+            const W twice_remainder = (remainder < 0) ? -2 * remainder : 2 * remainder;
+            const W magnitude       = (divisor < 0) ? -divisor : divisor;
+            const W away_from_zero  = negative ? quotient - 1 : quotient + 1;
+            if (twice_remainder > magnitude)
+            {
+                return away_from_zero;
+            }
+            if (twice_remainder < magnitude)
+            {
+                return quotient;
+            }
+            if constexpr (mode == RoundingMode::nearestEven)
+            {
+                return (quotient & 1) != 0 ? away_from_zero : quotient;
+            }
+            return negative ? quotient : away_from_zero;   // ties towards positive infinity
+        }
+    }
+
+    //! Multiplies two stored fixed-point values and adds the product to the accumulator, saturating instead
+    //! of wrapping around. The product is calculated in the 64-bit accumulator, so the operands need to be at most
+    //! 32-bit wide.
+    //!
+    //! @param accumulator Current value of the accumulator
+    //! @param lhs Multiplicand
+    //! @param rhs Multiplier
+    //! @return Updated accumulator
+    template<fgc4::utils::Integral T>
+    [[nodiscard]] constexpr int64_t multiplyAccumulate(const int64_t accumulator, const T lhs, const T rhs) noexcept
+    {
+        static_assert(sizeof(T) <= sizeof(int32_t), "Operands of the 64-bit accumulator can be at most 32-bit wide.");
+        return saturatingAdd(accumulator, static_cast<int64_t>(lhs) * static_cast<int64_t>(rhs));
+    }
+
+    //! Shifts the accumulator right by the provided number of bits with the chosen rounding, and saturates the
+    //! result to the limits of the output type.
+    //!
+    //! @param accumulator Value to be narrowed down
+    //! @param shift Number of bits to shift right, e.g. number of fractional bits of the coefficients
+    //! @return Rounded and saturated value
+    template<fgc4::utils::Integral T, RoundingMode mode = RoundingMode::nearest>
+    [[nodiscard]] constexpr T narrow(const int64_t accumulator, const int16_t shift) noexcept
+    {
+        return saturate<T>(roundingShift<mode>(accumulator, shift));
+    }
+
+    //! Converts a floating-point value to its stored fixed-point representation with the given number of fractional
+    //! bits, rounding to the nearest.
+    //!
+    //! @param value Value to be converted
+    //! @return Stored representation, or nothing if the value cannot be represented by the type T
+    template<int16_t fractional_bits, fgc4::utils::Integral T>
+    [[nodiscard]] std::optional<T> quantise(const double value) noexcept
+    {
+        const double scaled = std::round(std::ldexp(value, fractional_bits));
+        if (std::isnan(scaled) || scaled > static_cast<double>(std::numeric_limits<T>::max())
+            || scaled < static_cast<double>(std::numeric_limits<T>::min()))
+        {
+            return {};
+        }
+        return static_cast<T>(scaled);
+    }
+
+    //! Calculates how many bits are left between the worst-case magnitude of a signal and the limit of the type
+    //! holding it. Negative headroom means that the signal can saturate.
+    //!
+    //! @param worst_case_magnitude Largest magnitude the signal can reach, expressed in units of the least significant
+    //! bit
+    //! @param type_width Width of the type holding the signal, in bits, including the sign bit
+    //! @return Number of spare bits
+    [[nodiscard]] inline int16_t headroomBits(const double worst_case_magnitude, const int16_t type_width) noexcept
+    {
+        if (worst_case_magnitude <= 1.0)
+        {
+            return type_width - 1;
+        }
+        return static_cast<int16_t>(type_width - 1 - std::ceil(std::log2(worst_case_magnitude)));
+    }
+}   // namespace vslib::utils
+
 namespace vslib
 {
 
     //! This class implements the Q notation to represent fixed-point numbers with the flexibility what the
     //! fractional precision shall be.
-    //! Please note that no overflow nor underflow check is ever performed, just like with the standard C++ plain-old
-    //! data types. The maximal value that can be stored without internal overflow is defined by the number of bits left
-    //! for the exponent part and is accessible via maximumValue() public method.
-    template<int16_t fractional_bits, fgc4::utils::Integral T = int64_t>
+    //! All arithmetic operations saturate at the limits of T instead of wrapping around. Products and quotients are
+    //! calculated in an intermediate type twice as wide as T, and the dropped fractional bits are rounded according
+    //! to the rounding template parameter. The maximal value that can be stored is defined by the number of bits left
+    //! for the integer part and is accessible via the maximum_value public member.
+    template<int16_t fractional_bits, fgc4::utils::Integral T = int64_t, RoundingMode rounding = RoundingMode::nearest>
     class FixedPoint
     {
+        using WideType = utils::WideType<T>;
+
       public:
         //! Default constructor, stored value initialized to zero.
         FixedPoint()
@@ -52,6 +265,17 @@ namespace vslib
         {
         }
 
+        //! Creates a fixed-point object directly from its stored representation, e.g. a raw ADC code.
+        //!
+        //! @param raw_value Value already expressed in the Q notation of this type
+        //! @return Fixed-point object holding the provided representation
+        [[nodiscard]] static FixedPoint fromRaw(const T raw_value) noexcept
+        {
+            FixedPoint result;
+            result.m_value = raw_value;
+            return result;
+        }
+
         //! Inverse conversion from the internal Q notation to double-precision floating point.
         [[nodiscard]] double toDouble() const
         {
@@ -69,7 +293,7 @@ namespace vslib
         //! @param other Fixed-point value to be added
         void operator+=(const FixedPoint& other)
         {
-            m_value += other.m_value;
+            m_value = utils::saturatingAdd(m_value, other.m_value);
         }
 
         //! Overload to handle subtracting a FixedPoint object's value from the already-existing object
@@ -77,7 +301,7 @@ namespace vslib
         //! @param other Fixed-point value to be subtracted
         void operator-=(const FixedPoint& other)
         {
-            m_value -= other.m_value;
+            m_value = utils::saturatingSubtract(m_value, other.m_value);
         }
 
         //! Overload to handle multiplying a FixedPoint object's value with the already-existing object
@@ -85,7 +309,7 @@ namespace vslib
         //! @param other Fixed-point value to be the multiplicand
         void operator*=(const FixedPoint& other)
         {
-            m_value = (this->m_value * other.m_value + m_fractional_rounding) >> fractional_bits;
+            m_value = multiply(m_value, other.m_value);
         }
 
         //! Overload to handle dividing the already-existing object's value by a FixedPoint object's value
@@ -93,7 +317,7 @@ namespace vslib
         //! @param Fixed-point value to be the divisor
         void operator/=(const FixedPoint& other)
         {
-            m_value = (m_value << fractional_bits) / other.m_value;
+            m_value = divide(m_value, other.m_value);
         }
 
         //! Operator overload providing all 5 relationship checks, will only work where the number of fractional bits
@@ -105,39 +329,32 @@ namespace vslib
         //! @param other Fixed-point value to be the addend
         FixedPoint operator+(const FixedPoint& other) const
         {
-            FixedPoint result;
-            result.m_value = this->m_value + other.m_value;
-            return result;
+            return fromRaw(utils::saturatingAdd(m_value, other.m_value));
         }
 
-        //! Overload to handle summing two FixedPoint objects where a new object needs to be created.
+        //! Overload to handle subtracting two FixedPoint objects where a new object needs to be created.
         //!
         //! @param other Fixed-point value to be the subtrahend
         FixedPoint operator-(const FixedPoint& other) const
         {
-            FixedPoint result;
-            result.m_value = this->m_value - other.m_value;
-            return result;
+            return fromRaw(utils::saturatingSubtract(m_value, other.m_value));
         }
 
-        //! Overload to handle summing two FixedPoint objects where a new object needs to be created.
+        //! Overload to handle multiplying two FixedPoint objects where a new object needs to be created.
         //!
         //! @param other Fixed-point value of the multiplicand
         FixedPoint operator*(const FixedPoint& other) const
         {
-            FixedPoint result;
-            result.m_value = (this->m_value * other.m_value + m_fractional_rounding) >> fractional_bits;
-            return result;
+            return fromRaw(multiply(m_value, other.m_value));
         }
 
-        //! Overload to handle summing two FixedPoint objects where a new object needs to be created.
+        //! Overload to handle dividing two FixedPoint objects where a new object needs to be created. Division by
+        //! zero saturates towards the sign of the dividend.
         //!
         //! @param other Fixed-point value to be the divisor
         FixedPoint operator/(const FixedPoint& other) const
         {
-            FixedPoint result;
-            result.m_value = (this->m_value << fractional_bits) / other.m_value;
-            return result;
+            return fromRaw(divide(m_value, other.m_value));
         }
 
         //! Overload to handle summing two FixedPoint objects where a new object needs to be created.
@@ -160,8 +377,32 @@ namespace vslib
         //!< Helper method holding the fractional bit shift
         inline static constexpr double m_fractional_shift{static_cast<double>(T(1) << fractional_bits)};
         inline static constexpr float  m_float_fractional_shift{static_cast<float>(T(1) << fractional_bits)};
-        //!< Helper method holding the fractional rounding
-        inline static constexpr T m_fractional_rounding{T(1) << (fractional_bits - 1)};
+
+        //! Multiplies two stored values in the wide type, rounds the product back to this Q-format and saturates it.
+        //!
+        //! @param lhs Multiplicand
+        //! @param rhs Multiplier
+        //! @return Stored representation of the product
+        [[nodiscard]] static constexpr T multiply(const T lhs, const T rhs) noexcept
+        {
+            const WideType product = static_cast<WideType>(lhs) * static_cast<WideType>(rhs);
+            return utils::saturate<T>(utils::roundingShift<rounding>(product, fractional_bits));
+        }
+
+        //! Divides two stored values, with the dividend scaled up in the wide type so that no bits are lost.
+        //!
+        //! @param dividend Value to be divided
+        //! @param divisor Value to divide by
+        //! @return Stored representation of the rounded and saturated quotient
+        [[nodiscard]] static constexpr T divide(const T dividend, const T divisor) noexcept
+        {
+            if (divisor == 0)
+            {
+                return (dividend < 0) ? std::numeric_limits<T>::min() : std::numeric_limits<T>::max();
+            }
+            const WideType scaled_dividend = static_cast<WideType>(dividend) * (WideType(1) << fractional_bits);
+            return utils::saturate<T>(utils::roundingDivide<rounding>(scaled_dividend, static_cast<WideType>(divisor)));
+        }
     };
 
 }   // namespace vslib
\ No newline at end of file
@@ -0,0 +1,337 @@
+//! @file
+//! @brief File containing definition of a packed vector of fixed-point values, processed lane-wise.
+//! @author Dominik Arominski
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "fixedPointType.hpp"
+
+namespace vslib
+{
+    //! Packed vector of N fixed-point values sharing the same Q-format, aligned to the 128-bit SIMD registers.
+    //! Arithmetic is element-wise and saturating, products are rounded to the nearest with ties towards positive
+    //! infinity, as done by the rounding shifts of the NEON unit. 32-bit and 16-bit lanes are processed with NEON
+    //! intrinsics on the target when N fills whole registers; 16-bit additions and subtractions use SSE2 on the host.
+    //! All other cases fall back to plain loops that the compiler is free to auto-vectorise.
+    template<size_t N, int16_t fractional_bits, fgc4::utils::Integral T = int32_t>
+    class FixedPointVector
+    {
+        using WideType = utils::WideType<T>;
+
+        constexpr static size_t register_width = 16;   // in bytes
+        constexpr static size_t lanes          = register_width / sizeof(T);
+        constexpr static bool   whole_registers
+            = (sizeof(T) == sizeof(int32_t) || sizeof(T) == sizeof(int16_t)) && std::is_signed_v<T> && (N % lanes == 0);
+
+      public:
+        using ElementType = FixedPoint<fractional_bits, T>;   //!< Type of a single element of the vector
+
+        //! Default constructor, all stored values initialized to zero.
+        FixedPointVector() = default;
+
+        //! Constructor converting each of the provided floating-point values to Q notation.
+        //!
+        //! @param values Floating-point values to be represented
+        explicit FixedPointVector(const std::array<double, N>& values)
+        {
+            for (size_t index = 0; index < N; index++)
+            {
+                m_values[index] = ElementType(values[index]).value();
+            }
+        }
+
+        //! Creates a fixed-point vector directly from stored representations, e.g. raw ADC codes.
+        //!
+        //! @param raw_values Values already expressed in the Q notation of this type
+        //! @return Fixed-point vector holding the provided representations
+        [[nodiscard]] static FixedPointVector fromRaw(const std::array<T, N>& raw_values) noexcept
+        {
+            FixedPointVector result;
+            result.m_values = raw_values;
+            return result;
+        }
+
+        //! Inverse conversion from the internal Q notation to double-precision floating point.
+        //!
+        //! @return Array with all elements converted to double
+        [[nodiscard]] std::array<double, N> toDouble() const
+        {
+            std::array<double, N> result;
+            for (size_t index = 0; index < N; index++)
+            {
+                result[index] = ElementType::fromRaw(m_values[index]).toDouble();
+            }
+            return result;
+        }
+
+        //! Element-wise saturating sum of two vectors.
+        //!
+        //! @param other Fixed-point vector to be the addend
+        //! @return Vector with sums of the corresponding elements
+        [[nodiscard]] FixedPointVector operator+(const FixedPointVector& other) const noexcept
+        {
+            FixedPointVector result;
+#if defined(__ARM_NEON)
+            if constexpr (whole_registers && sizeof(T) == sizeof(int32_t))
+            {
+                for (size_t index = 0; index < N; index += lanes)
+                {
+                    vst1q_s32(
+                        &result.m_values[index],
+                        vqaddq_s32(vld1q_s32(&m_values[index]), vld1q_s32(&other.m_values[index]))
+                    );
+                }
+                return result;
+            }
+            else if constexpr (whole_registers)
+            {
+                for (size_t index = 0; index < N; index += lanes)
+                {
+                    vst1q_s16(
+                        &result.m_values[index],
+                        vqaddq_s16(vld1q_s16(&m_values[index]), vld1q_s16(&other.m_values[index]))
+                    );
+                }
+                return result;
+            }
+#elif defined(__SSE2__)
+            if constexpr (whole_registers && sizeof(T) == sizeof(int16_t))
+            {
+                for (size_t index = 0; index < N; index += lanes)
+                {
+                    _mm_store_si128(
+                        reinterpret_cast<__m128i*>(&result.m_values[index]),
+                        _mm_adds_epi16(load(m_values, index), load(other.m_values, index))
+                    );
+                }
+                return result;
+            }
+#endif
+            for (size_t index = 0; index < N; index++)
+            {
+                result.m_values[index] = add(m_values[index], other.m_values[index]);
+            }
+            return result;
+        }
+
+        //! Element-wise saturating difference of two vectors.
+        //!
+        //! @param other Fixed-point vector to be the subtrahend
+        //! @return Vector with differences of the corresponding elements
+        [[nodiscard]] FixedPointVector operator-(const FixedPointVector& other) const noexcept
+        {
+            FixedPointVector result;
+#if defined(__ARM_NEON)
+            if constexpr (whole_registers && sizeof(T) == sizeof(int32_t))
+            {
+                for (size_t index = 0; index < N; index += lanes)
+                {
+                    vst1q_s32(
+                        &result.m_values[index],
+                        vqsubq_s32(vld1q_s32(&m_values[index]), vld1q_s32(&other.m_values[index]))
+                    );
+                }
+                return result;
+            }
+            else if constexpr (whole_registers)
+            {
+                for (size_t index = 0; index < N; index += lanes)
+                {
+                    vst1q_s16(
+                        &result.m_values[index],
+                        vqsubq_s16(vld1q_s16(&m_values[index]), vld1q_s16(&other.m_values[index]))
+                    );
+                }
+                return result;
+            }
+#elif defined(__SSE2__)
+            if constexpr (whole_registers && sizeof(T) == sizeof(int16_t))
+            {
+                for (size_t index = 0; index < N; index += lanes)
+                {
+                    _mm_store_si128(
+                        reinterpret_cast<__m128i*>(&result.m_values[index]),
+                        _mm_subs_epi16(load(m_values, index), load(other.m_values, index))
+                    );
+                }
+                return result;
+            }
+#endif
+            for (size_t index = 0; index < N; index++)
+            {
+                result.m_values[index] = subtract(m_values[index], other.m_values[index]);
+            }
+            return result;
+        }
+
+        //! Element-wise saturating product of two vectors, rounded back to the Q-format of this vector.
+        //!
+        //! @param other Fixed-point vector to be the multiplicand
+        //! @return Vector with products of the corresponding elements
+        [[nodiscard]] FixedPointVector operator*(const FixedPointVector& other) const noexcept
+        {
+            FixedPointVector result;
+#if defined(__ARM_NEON)
+            if constexpr (whole_registers && sizeof(T) == sizeof(int32_t))
+            {
+                // widening multiply to 64-bit lanes, rounding shift right and saturating narrow back to 32-bit lanes
+                const int64x2_t shift = vdupq_n_s64(-fractional_bits);
+                for (size_t index = 0; index < N; index += lanes)
+                {
+                    const int32x4_t lhs  = vld1q_s32(&m_values[index]);
+                    const int32x4_t rhs  = vld1q_s32(&other.m_values[index]);
+                    const int64x2_t low  = vrshlq_s64(vmull_s32(vget_low_s32(lhs), vget_low_s32(rhs)), shift);
+                    const int64x2_t high = vrshlq_s64(vmull_high_s32(lhs, rhs), shift);
+                    vst1q_s32(&result.m_values[index], vcombine_s32(vqmovn_s64(low), vqmovn_s64(high)));
+                }
+                return result;
+            }
+#endif
+            for (size_t index = 0; index < N; index++)
+            {
+                const WideType product
+                    = static_cast<WideType>(m_values[index]) * static_cast<WideType>(other.m_values[index]);
+                result.m_values[index]
+                    = utils::saturate<T>(utils::roundingShift<RoundingMode::nearest>(product, fractional_bits));
+            }
+            return result;
+        }
+
+        //! Overload to handle summing a vector with the already-existing object.
+        //!
+        //! @param other Fixed-point vector to be added
+        void operator+=(const FixedPointVector& other) noexcept
+        {
+            *this = *this + other;
+        }
+
+        //! Overload to handle subtracting a vector from the already-existing object.
+        //!
+        //! @param other Fixed-point vector to be subtracted
+        void operator-=(const FixedPointVector& other) noexcept
+        {
+            *this = *this - other;
+        }
+
+        //! Overload to handle multiplying the already-existing object by a vector.
+        //!
+        //! @param other Fixed-point vector to be the multiplicand
+        void operator*=(const FixedPointVector& other) noexcept
+        {
+            *this = *this * other;
+        }
+
+        //! Element-wise equality of two vectors.
+        bool operator==(const FixedPointVector& other) const = default;
+
+        //! Calculates the dot product of two vectors, accumulating the full-precision products before rounding
+        //! once, e.g. for a FIR filter convolution. The accumulator saturates instead of wrapping around.
+        //!
+        //! @param other Fixed-point vector to be multiplied with
+        //! @return Dot product, rounded and saturated to the Q-format of this vector
+        [[nodiscard]] ElementType dot(const FixedPointVector& other) const noexcept
+        {
+            WideType accumulator{0};
+            for (size_t index = 0; index < N; index++)
+            {
+                accumulator = multiplyAccumulate(accumulator, m_values[index], other.m_values[index]);
+            }
+            return ElementType::fromRaw(
+                utils::saturate<T>(utils::roundingShift<RoundingMode::nearest>(accumulator, fractional_bits))
+            );
+        }
+
+        //! Returns the element at the given index.
+        //!
+        //! @param index Index of the element
+        //! @return Fixed-point element at the index
+        [[nodiscard]] ElementType operator[](const size_t index) const noexcept
+        {
+            return ElementType::fromRaw(m_values[index]);
+        }
+
+        //! Returns the stored representations of all elements.
+        //!
+        //! @return Reference to the array with values in Q notation
+        [[nodiscard]] const std::array<T, N>& value() const noexcept
+        {
+            return m_values;
+        }
+
+        //! Returns the number of elements of the vector.
+        [[nodiscard]] static constexpr size_t size() noexcept
+        {
+            return N;
+        }
+
+      private:
+        alignas(register_width) std::array<T, N> m_values{0};   //!< Values stored in Q notation
+
+        //! Saturating sum of two lanes, calculated in the wide type so that the loop can be auto-vectorised.
+        [[nodiscard]] static constexpr T add(const T lhs, const T rhs) noexcept
+        {
+            if constexpr (sizeof(T) < sizeof(int64_t))
+            {
+                return utils::saturate<T>(static_cast<WideType>(lhs) + static_cast<WideType>(rhs));
+            }
+            else
+            {
+                return utils::saturatingAdd(lhs, rhs);
+            }
+        }
+
+        //! Saturating difference of two lanes, calculated in the wide type so that the loop can be auto-vectorised.
+        [[nodiscard]] static constexpr T subtract(const T lhs, const T rhs) noexcept
+        {
+            if constexpr (sizeof(T) < sizeof(int64_t))
+            {
+                return utils::saturate<T>(static_cast<WideType>(lhs) - static_cast<WideType>(rhs));
+            }
+            else
+            {
+                return utils::saturatingSubtract(lhs, rhs);
+            }
+        }
+
+        //! Adds the full-precision product of two lanes to the accumulator, saturating at the limits of the wide type.
+        [[nodiscard]] static constexpr WideType
+        multiplyAccumulate(const WideType accumulator, const T lhs, const T rhs) noexcept
+        {
+            if constexpr (sizeof(T) <= sizeof(int32_t))
+            {
+                return utils::multiplyAccumulate(accumulator, lhs, rhs);
+            }
+            else
+            {
+                // numeric_limits is not specialised for the 128-bit type in strict ISO mode
+                constexpr WideType maximum = ~(WideType(1) << 127);
+                const WideType     product = static_cast<WideType>(lhs) * static_cast<WideType>(rhs);
+                WideType           result;
+                if (__builtin_add_overflow(accumulator, product, &result))
+                {
+                    return (product > 0) ? maximum : -maximum - 1;
+                }
+                return result;
+            }
+        }
+
+#if defined(__SSE2__) && !defined(__ARM_NEON)
+        //! Loads one 128-bit register worth of lanes, starting at the given index.
+        [[nodiscard]] static __m128i load(const std::array<T, N>& values, const size_t index) noexcept
+        {
+            return _mm_load_si128(reinterpret_cast<const __m128i*>(&values[index]));
+        }
+#endif
+    };
+}   // namespace vslib
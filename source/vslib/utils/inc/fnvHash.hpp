@@ -0,0 +1,45 @@
+//! @file
+//! @brief File containing the FNV-1a hash function, used to identify names and types in binary data.
+//! @author Dominik Arominski
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace vslib::utils
+{
+    constexpr uint64_t fnv_offset_basis = 0xCBF29CE484222325;   //!< Initial value of the 64-bit FNV-1a hash
+    constexpr uint64_t fnv_prime        = 0x100000001B3;        //!< Multiplier of the 64-bit FNV-1a hash
+
+    //! Computes the 64-bit FNV-1a hash of the provided string.
+    //!
+    //! @param text String to be hashed
+    //! @param hash Initial value of the hash, allows for hashing data in several parts
+    //! @return Hash of the string
+    [[nodiscard]] constexpr uint64_t fnv1aHash(const std::string_view text, uint64_t hash = fnv_offset_basis) noexcept
+    {
+        for (const char character : text)
+        {
+            hash = (hash ^ static_cast<uint8_t>(character)) * fnv_prime;
+        }
+        return hash;
+    }
+
+    //! Computes the 64-bit FNV-1a hash of the provided bytes.
+    //!
+    //! @param data Bytes to be hashed
+    //! @param hash Initial value of the hash, allows for hashing data in several parts
+    //! @return Hash of the bytes
+    [[nodiscard]] inline uint64_t
+    fnv1aHash(const std::span<const std::byte> data, uint64_t hash = fnv_offset_basis) noexcept
+    {
+        for (const std::byte byte : data)
+        {
+            hash = (hash ^ static_cast<uint8_t>(byte)) * fnv_prime;
+        }
+        return hash;
+    }
+}   // namespace vslib::utils
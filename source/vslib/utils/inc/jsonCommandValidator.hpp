@@ -0,0 +1,103 @@
+//! @file
+//! @brief File containing the validator of commands specialised for the command schema.
+//! @author Dominik Arominski
+
+#pragma once
+
+#include <string>
+#include <string_view>
+
+namespace vslib::utils
+{
+    //! Validates a JSON command against the json_command_schema without the generic schema validator. Presence and
+    //! types of all keys are checked in a single pass over the object, without throwing any exception and without
+    //! converting the command to another JSON type. Errors are reported in the same order and format as by the
+    //! generic validator: the type of the command first, then the required keys, then the types of the keys.
+    //!
+    //! The validator needs to be kept consistent with jsonCommandSchema.hpp, which is cross-checked in debug builds
+    //! of ParameterSetting.
+    //!
+    //! @param command JSON command to be validated
+    //! @param error Set to the explanation if the command is invalid
+    //! @return True if the command follows the schema, false otherwise
+    template<typename Json>
+    [[nodiscard]] bool validateCommandSchema(const Json& command, std::string& error)
+    {
+        const auto format_error = [&error](const std::string_view pointer, const Json& instance, const auto& reason)
+        {
+            error = "At " + std::string(pointer) + " of " + instance.dump() + " - " + std::string(reason) + "\n";
+        };
+
+        if (!command.is_object())
+        {
+            format_error("", command, "unexpected instance type");
+            return false;
+        }
+
+        bool             name_found    = false;
+        bool             value_found   = false;
+        bool             version_found = false;
+        const Json*      invalid_key   = nullptr;   // first key with an invalid value, reported after missing keys
+        std::string_view invalid_pointer;
+        std::string_view invalid_reason;
+
+        for (auto item = command.cbegin(); item != command.cend(); ++item)
+        {
+            const auto&      key      = item.key();
+            const auto&      instance = item.value();
+            std::string_view pointer;
+            std::string_view reason;
+            if (key == "name")
+            {
+                name_found = true;
+                pointer    = "/name";
+                if (!instance.is_string())
+                {
+                    reason = "unexpected instance type";
+                }
+                else if (instance.template get_ref<const typename Json::string_t&>().empty())
+                {
+                    reason = "instance is too short as per minLength:1";
+                }
+            }
+            else if (key == "value")
+            {
+                value_found = true;
+                pointer     = "/value";
+                if (!(instance.is_array() || instance.is_boolean() || instance.is_number() || instance.is_string()))
+                {
+                    reason = "unexpected instance type";
+                }
+            }
+            else if (key == "version")
+            {
+                version_found = true;
+                pointer       = "/version";
+                if (!instance.is_array())
+                {
+                    reason = "unexpected instance type";
+                }
+            }
+
+            if (!reason.empty() && invalid_key == nullptr)
+            {
+                invalid_key     = &instance;
+                invalid_pointer = pointer;
+                invalid_reason  = reason;
+            }
+        }
+
+        if (!name_found || !value_found || !version_found)
+        {
+            const std::string_view missing = !name_found ? "name" : (!value_found ? "value" : "version");
+            format_error("", command, "required property '" + std::string(missing) + "' not found in object");
+            return false;
+        }
+        if (invalid_key != nullptr)
+        {
+            format_error(invalid_pointer, *invalid_key, invalid_reason);
+            return false;
+        }
+        return true;
+    }
+}   // namespace vslib::utils
@@ -0,0 +1,300 @@
+//! @file
+//! @brief File containing the scheduler of real-time tasks running at integer divisors of the rate of an interrupt.
+//! @author Dominik Arominski
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <fmt/format.h>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+
+#include "errorCodes.hpp"
+#include "errorMessage.hpp"
+#include "nonCopyableNonMovable.hpp"
+
+namespace vslib
+{
+    //! Execution time of a task of the MultiRateScheduler, in ticks of the counter provided to tick
+    struct TaskLoad
+    {
+        uint64_t last{0};    //!< Duration of the last run
+        uint64_t worst{0};   //!< Longest duration observed
+        uint64_t total{0};   //!< Sum of the durations of all runs
+        uint64_t runs{0};    //!< Number of runs
+    };
+
+    //! Scheduler of tasks running at integer divisors of the base rate, e.g. of a TimerInterrupt calling tick from its
+    //! handler. A task with divisor N runs on every N-th tick. Slow tasks are phase-staggered: each of them is given
+    //! the offset within its period that lands on the least loaded ticks, so that they do not all run on the same tick
+    //! and the worst-case tick, which determines the shortest possible base period, is kept low.
+    //!
+    //! Within a tick, tasks run in the order of their divisors, the fastest first.
+    //!
+    //! @tparam max_tasks Maximal number of tasks
+    //! @tparam horizon Maximal number of ticks over which the phases are planned
+    template<size_t max_tasks, uint32_t horizon = 1024>
+    class MultiRateScheduler : public NonCopyableNonMovable
+    {
+        //! Function calling the handler of a task
+        using Call = void (*)(void* context) noexcept;
+
+        struct Task
+        {
+            Call     call;        //!< Function calling the handler
+            void*    context;     //!< Object the handler is called on
+            uint32_t divisor;     //!< Number of base ticks between two runs
+            uint32_t phase;       //!< Tick within the period on which the task runs
+            uint32_t countdown;   //!< Number of ticks until the next run
+            uint32_t weight;      //!< Expected relative execution time, used to plan the phases
+            uint16_t id;          //!< Index of the task in the order of addition
+            TaskLoad load;        //!< Measured execution time
+        };
+
+      public:
+        //! Adds a task calling the handler on the provided object every divisor ticks, and plans the phases of all
+        //! tasks again. Tasks are meant to be added at startup, before the first tick.
+        //!
+        //! @tparam handler Captureless callable taking the object as the only argument
+        //! @param context Object the handler is called on, expected to outlive the scheduler
+        //! @param divisor Number of base ticks between two runs of the task, 1 to run on every tick
+        //! @param weight Expected relative execution time of the task, used to plan the phases
+        //! @return Identifier of the task, its index in the order of addition
+        template<auto handler, typename Context>
+        size_t addTask(Context& context, const uint32_t divisor, const uint32_t weight = 1)
+        {
+            static_assert(std::is_invocable_v<decltype(handler), Context&>, "The handler needs to take the object.");
+
+            if (m_number_tasks == max_tasks)
+            {
+                fgc4::utils::Error message(
+                    fmt::format("Scheduler holds at most {} tasks.\n", max_tasks),
+                    fgc4::utils::errorCodes::allocation_buffer_overflow
+                );
+                throw std::length_error(fmt::format("{}", message));
+            }
+            if (divisor == 0 || divisor > horizon)
+            {
+                fgc4::utils::Error message(
+                    fmt::format("Divisor {} of a task is outside the range: 1, {}.\n", divisor, horizon),
+                    fgc4::utils::errorCodes::out_of_bounds_access
+                );
+                throw std::out_of_range(fmt::format("{}", message));
+            }
+
+            const auto id = static_cast<uint16_t>(m_number_tasks);
+            // tasks are kept sorted by divisor, a new task runs after the tasks with the same divisor
+            size_t position = m_number_tasks;
+            while (position > 0 && m_tasks[position - 1].divisor > divisor)
+            {
+                m_tasks[position] = m_tasks[position - 1];
+                position--;
+            }
+            m_tasks[position] = Task{&callHandler<handler, Context>, &context, divisor, 0, 0, weight, id, {}};
+            m_number_tasks++;
+
+            planPhases();
+            return id;
+        }
+
+        //! Runs the tasks due on this tick.
+        void tick() noexcept
+        {
+            for (size_t index = 0; index < m_number_tasks; index++)
+            {
+                Task& task = m_tasks[index];
+                if (task.countdown == 0)
+                {
+                    task.call(task.context);
+                    task.countdown = task.divisor;
+                }
+                task.countdown--;
+            }
+            m_ticks++;
+        }
+
+        //! Runs the tasks due on this tick, measuring the execution time of each task and of the whole tick.
+        //!
+        //! @param counter Callable returning the current value of a monotonic counter, e.g. the CPU cycle counter
+        template<typename Counter>
+        void tick(Counter&& counter) noexcept
+        {
+            const uint64_t tick_start = counter();
+            for (size_t index = 0; index < m_number_tasks; index++)
+            {
+                Task& task = m_tasks[index];
+                if (task.countdown == 0)
+                {
+                    const uint64_t start = counter();
+                    task.call(task.context);
+                    const uint64_t duration = counter() - start;
+
+                    task.load.last   = duration;
+                    task.load.worst  = std::max(task.load.worst, duration);
+                    task.load.total += duration;
+                    task.load.runs++;
+                    task.countdown = task.divisor;
+                }
+                task.countdown--;
+            }
+            m_worst_tick = std::max(m_worst_tick, counter() - tick_start);
+            m_ticks++;
+        }
+
+        //! Provides the measured execution time of a task.
+        //!
+        //! @param task Identifier of the task, as returned by addTask
+        //! @return Execution time of the task
+        [[nodiscard]] const TaskLoad& load(const size_t task) const noexcept
+        {
+            return find(task).load;
+        }
+
+        //! Provides the tick within its period on which a task runs.
+        //!
+        //! @param task Identifier of the task, as returned by addTask
+        //! @return Phase of the task, from 0 to its divisor - 1
+        [[nodiscard]] uint32_t phase(const size_t task) const noexcept
+        {
+            return find(task).phase;
+        }
+
+        //! Provides the CPU load of all tasks running at the provided divisor of the base rate, averaged over all ticks
+        //! measured so far.
+        //!
+        //! @param divisor Divisor of the tasks
+        //! @param period Base period, in ticks of the counter provided to tick
+        //! @return Fraction of the base period spent in the tasks with this divisor
+        [[nodiscard]] double rateLoad(const uint32_t divisor, const uint64_t period) const noexcept
+        {
+            if (m_ticks == 0 || period == 0)
+            {
+                return 0.0;
+            }
+            uint64_t total = 0;
+            for (size_t index = 0; index < m_number_tasks; index++)
+            {
+                if (m_tasks[index].divisor == divisor)
+                {
+                    total += m_tasks[index].load.total;
+                }
+            }
+            return static_cast<double>(total) / (static_cast<double>(m_ticks) * static_cast<double>(period));
+        }
+
+        //! Provides the load of the longest tick measured so far, including the overhead of the scheduler.
+        //!
+        //! @param period Base period, in ticks of the counter provided to tick
+        //! @return Fraction of the base period spent in the longest tick
+        [[nodiscard]] double worstTickLoad(const uint64_t period) const noexcept
+        {
+            return period == 0 ? 0.0 : static_cast<double>(m_worst_tick) / static_cast<double>(period);
+        }
+
+        //! Provides the largest sum of weights of the tasks planned to run on the same tick.
+        //!
+        //! @return Planned weight of the most loaded tick
+        [[nodiscard]] uint64_t plannedPeakWeight() const noexcept
+        {
+            return m_planned_peak;
+        }
+
+        //! Provides the number of ticks run so far.
+        //!
+        //! @return Number of ticks
+        [[nodiscard]] uint64_t ticks() const noexcept
+        {
+            return m_ticks;
+        }
+
+        //! Resets the measured execution times of all tasks and ticks.
+        void resetStatistics() noexcept
+        {
+            for (size_t index = 0; index < m_number_tasks; index++)
+            {
+                m_tasks[index].load = TaskLoad{};
+            }
+            m_worst_tick = 0;
+            m_ticks      = 0;
+        }
+
+      private:
+        std::array<Task, max_tasks> m_tasks{};            //!< Tasks, sorted by divisor
+        size_t                      m_number_tasks{0};    //!< Number of added tasks
+        uint64_t                    m_ticks{0};           //!< Number of ticks run so far
+        uint64_t                    m_worst_tick{0};      //!< Longest measured tick
+        uint64_t                    m_planned_peak{0};    //!< Planned weight of the most loaded tick
+
+        //! Calls the handler of a task on its concrete object type.
+        //!
+        //! @param context Object the handler is called on
+        template<auto handler, typename Context>
+        static void callHandler(void* context) noexcept
+        {
+            handler(*static_cast<Context*>(context));
+        }
+
+        //! Provides the task with the provided identifier.
+        //!
+        //! @param id Identifier of the task, as returned by addTask
+        //! @return Reference to the task
+        [[nodiscard]] const Task& find(const size_t id) const noexcept
+        {
+            // identifiers are given out in the order of addition, so every identifier below the count is found
+            assert(id < m_number_tasks);
+            return *std::find_if(
+                m_tasks.cbegin(), m_tasks.cbegin() + m_number_tasks,
+                [id](const auto& task)
+                {
+                    return task.id == id;
+                }
+            );
+        }
+
+        //! Plans the phases of all tasks, the fastest first. Each task takes the phase whose ticks hold the smallest
+        //! weight so far, over the common period of all divisors, or over the horizon if the common period is longer.
+        //! The countdowns restart, so that the next tick is the first tick of the plan.
+        void planPhases() noexcept
+        {
+            uint64_t common_period = 1;
+            for (size_t index = 0; index < m_number_tasks; index++)
+            {
+                common_period = std::min<uint64_t>(std::lcm(common_period, m_tasks[index].divisor), horizon);
+            }
+
+            std::array<uint32_t, horizon> weights{};
+            for (size_t index = 0; index < m_number_tasks; index++)
+            {
+                Task&    task       = m_tasks[index];
+                uint32_t best_peak  = std::numeric_limits<uint32_t>::max();
+                uint32_t best_phase = 0;
+                for (uint32_t phase = 0; phase < task.divisor; phase++)
+                {
+                    uint32_t peak = 0;
+                    for (uint64_t tick = phase; tick < common_period; tick += task.divisor)
+                    {
+                        peak = std::max(peak, weights[tick]);
+                    }
+                    if (peak < best_peak)
+                    {
+                        best_peak  = peak;
+                        best_phase = phase;
+                    }
+                }
+                for (uint64_t tick = best_phase; tick < common_period; tick += task.divisor)
+                {
+                    weights[tick] += task.weight;
+                }
+                task.phase     = best_phase;
+                task.countdown = best_phase;
+            }
+            m_planned_peak = *std::max_element(weights.cbegin(), weights.cbegin() + common_period);
+        }
+    };
+}   // namespace vslib
@@ -0,0 +1,144 @@
+//! @file
+//! @brief File containing the append-only arena holding the names of all Components and Parameters.
+//! @author Dominik Arominski
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include "nonCopyableNonMovable.hpp"
+
+namespace vslib::utils
+{
+    //! Append-only arena of names. The names of all Components and Parameters are interned into a few large blocks
+    //! allocated at startup, instead of hundreds of small strings scattered between the real-time data. Interned names
+    //! are never moved nor released, so the returned views remain valid for the lifetime of the program.
+    class NameArena : public NonCopyableNonMovable
+    {
+      public:
+        //! Size of each block of the arena, longer names are stored in a dedicated block
+        constexpr static size_t block_size = 4096;
+
+        //! Provides an instance of the singleton arena
+        //!
+        //! @return Singular instance of the name arena
+        static NameArena& instance()
+        {
+            // Arena is constructed on first access
+            static NameArena m_instance;
+            return m_instance;
+        }
+
+        //! Interns the concatenation of the provided parts as a single contiguous name.
+        //!
+        //! @param parts Parts of the name, concatenated in order without separators
+        //! @return View of the interned name
+        template<typename... Parts>
+        [[nodiscard]] std::string_view intern(const Parts&... parts)
+        {
+            const std::array<std::string_view, sizeof...(Parts)> views{std::string_view(parts)...};
+
+            size_t length = 0;
+            for (const auto& view : views)
+            {
+                length += view.size();
+            }
+
+            char* const name     = allocate(length);
+            char*       position = name;
+            for (const auto& view : views)
+            {
+                position = std::copy(view.begin(), view.end(), position);
+            }
+            return {name, length};
+        }
+
+        //! Interns the provided name once, returning the already interned copy on subsequent calls. Intended for the
+        //! few names shared by many objects, e.g. the types of Components.
+        //!
+        //! @param name Name to be interned
+        //! @return View of the interned name
+        [[nodiscard]] std::string_view internShared(const std::string_view name)
+        {
+            const auto shared = std::find(m_shared.cbegin(), m_shared.cend(), name);
+            if (shared != m_shared.cend())
+            {
+                return *shared;
+            }
+            return m_shared.emplace_back(intern(name));
+        }
+
+        //! Checks whether the provided name is held by the arena.
+        //!
+        //! @param name View of a name
+        //! @return True if the name has been interned in this arena, false otherwise
+        [[nodiscard]] bool holds(const std::string_view name) const noexcept
+        {
+            return std::any_of(
+                m_blocks.cbegin(), m_blocks.cend(),
+                [this, name](const auto& block)
+                {
+                    const std::less_equal<const char*> not_after;
+                    return not_after(block.data.get(), name.data())
+                           && not_after(name.data() + name.size(), block.data.get() + block.size);
+                }
+            );
+        }
+
+        //! Provides the number of bytes taken by all interned names.
+        //!
+        //! @return Number of used bytes
+        [[nodiscard]] size_t usedBytes() const noexcept
+        {
+            return m_used_bytes;
+        }
+
+        //! Provides the number of heap allocations made by the arena, i.e. the number of its blocks.
+        //!
+        //! @return Number of allocated blocks
+        [[nodiscard]] size_t blockCount() const noexcept
+        {
+            return m_blocks.size();
+        }
+
+      private:
+        NameArena() = default;   //!< Default constructor
+
+        struct Block
+        {
+            std::unique_ptr<char[]> data;   //!< Storage of the names
+            size_t                  size;   //!< Number of bytes of the storage
+        };
+
+        std::vector<Block>            m_blocks{};             //!< Blocks holding the interned names
+        std::vector<std::string_view> m_shared{};             //!< Names interned once
+        char*                         m_position{nullptr};    //!< First free byte of the last block
+        char*                         m_block_end{nullptr};   //!< End of the last block
+        size_t                        m_used_bytes{0};        //!< Number of bytes taken by all names
+
+        //! Provides storage for a name of the provided length, allocating a new block when the last one is full.
+        //!
+        //! @param length Length of the name
+        //! @return Pointer to the storage of the name
+        char* allocate(const size_t length)
+        {
+            if (static_cast<size_t>(m_block_end - m_position) < length)
+            {
+                const size_t size  = std::max(length, block_size);
+                auto&        block = m_blocks.emplace_back(std::make_unique_for_overwrite<char[]>(size), size);
+                m_position         = block.data.get();
+                m_block_end        = m_position + size;
+            }
+            char* const name  = m_position;
+            m_position       += length;
+            m_used_bytes     += length;
+            return name;
+        }
+    };
+}   // namespace vslib::utils
@@ -0,0 +1,89 @@
+//! @file
+//! @brief File containing definition of an integer phase accumulator, representing an angle of a numerically
+//! controlled oscillator.
+//! @author Dominik Arominski
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+
+#include "typeTraits.hpp"
+
+namespace vslib
+{
+    //! Angle of a numerically controlled oscillator, stored as an unsigned 64-bit integer where the full range of the
+    //! integer corresponds to one period of 2 pi. Advancing the angle wraps around the period for free, so no range
+    //! reduction is ever needed, and the resolution of the angle is constant over the whole period.
+    class PhaseAccumulator
+    {
+      public:
+        //! Radians corresponding to the least significant bit of the accumulator
+        inline static constexpr double radians_per_unit{2.0 * std::numbers::pi / 18446744073709551616.0};   // 2^64
+
+        //! Default constructor, angle initialized to zero.
+        PhaseAccumulator() = default;
+
+        //! Creates a phase accumulator holding the provided angle.
+        //!
+        //! @param radians Angle in radians, of any magnitude
+        //! @return Phase accumulator holding the angle brought to the 0 to 2 pi range
+        [[nodiscard]] static PhaseAccumulator fromRadians(const double radians) noexcept
+        {
+            PhaseAccumulator result;
+            result.advance(radians);
+            return result;
+        }
+
+        //! Advances the angle by the provided increment, wrapping around the period.
+        //!
+        //! @param increment Angle increment in radians, may be negative
+        void advance(double increment) noexcept
+        {
+            // increments up to half a period are converted directly, larger ones are brought to that range first
+            if (std::abs(increment) >= std::numbers::pi)
+            {
+                increment = std::remainder(increment, 2.0 * std::numbers::pi);
+            }
+            double units = increment / radians_per_unit;
+            // exactly half a period is only representable as a signed integer when negative
+            if (units >= half_period_units)
+            {
+                units = -half_period_units;
+            }
+            m_phase += static_cast<uint64_t>(static_cast<int64_t>(units));
+        }
+
+        //! Converts the accumulated phase to radians.
+        //!
+        //! @return Angle in the 0 to 2 pi range
+        template<fgc4::utils::Floating T = double>
+        [[nodiscard]] T toRadians() const noexcept
+        {
+            // phases close to the full period round up to exactly 2 pi in the conversion, which is the same angle as 0
+            constexpr T two_pi  = static_cast<T>(2.0 * std::numbers::pi);
+            const T     radians = static_cast<T>(static_cast<double>(m_phase) * radians_per_unit);
+            return (radians < two_pi) ? radians : T{0};
+        }
+
+        //! Resets the angle to zero.
+        void reset() noexcept
+        {
+            m_phase = 0;
+        }
+
+        //! Returns the raw value of the accumulator.
+        //!
+        //! @return Accumulated phase, in units of 2 pi / 2^64
+        [[nodiscard]] uint64_t value() const noexcept
+        {
+            return m_phase;
+        }
+
+      private:
+        inline static constexpr double half_period_units{9223372036854775808.0};   // 2^63
+
+        uint64_t m_phase{0};   //!< Accumulated phase, wraps around at 2 pi
+    };
+}   // namespace vslib
@@ -5,11 +5,12 @@
 #pragma once
 
 #include "constants.hpp"
-#include "fsm.hpp"
 #include "parameterMap.hpp"
 #include "parameterRegistry.hpp"
 #include "parameterSetting.hpp"
+#include "parameterSnapshot.hpp"
 #include "rootComponent.hpp"
+#include "tableFsm.hpp"
 #include "vslib_shared_memory_memmap.hpp"
 
 namespace vslib::utils
@@ -24,14 +25,13 @@ namespace vslib::utils
 
     class VSMachine
     {
-        using StateMachine = ::utils::Fsm<VSStates, VSMachine, false>;
-
         using TransResVS = ::utils::FsmTransitionResult<VSStates>;
 
-        using StateFunc = std::function<void(void)>;
+        //! States with their state and transition functions, defined after the class. CAUTION: The order of
+        //! transition methods matters
+        static const ::utils::FsmTable<VSStates, VSMachine, 4, 2> fsm_table;
 
-        //! Convenience alias representing pointer to a member function of the Parent class, for a transition function.
-        using TransitionFunc = ::utils::FsmTransitionResult<VSStates> (VSMachine::*)();
+        using StateMachine = ::utils::TableFsm<VSStates, VSMachine, fsm_table, false>;
 
         constexpr static size_t read_commands_queue_address
             = app_data_2_3_ADDRESS;   // this needs to be CPU-choice dependent, or fixed to CPU3
@@ -40,25 +40,21 @@ namespace vslib::utils
         constexpr static size_t write_parameter_map_queue_address = read_commands_queue_address
                                                                     + fgc4::utils::constants::json_memory_pool_size
                                                                     + fgc4::utils::constants::string_memory_pool_size;
+        constexpr static size_t parameter_snapshot_address = app_data_parameter_snapshot_ADDRESS;
+        constexpr static size_t parameter_snapshot_size    = app_data_parameter_snapshot_SIZE;
 
       public:
         VSMachine(RootComponent& root)
             : m_fsm(*this, VSStates::initialization),
               m_root(root),
-              m_parameter_setting_task{
-                  (uint8_t*)read_commands_queue_address, (uint8_t*)write_commands_status_queue_address, root},
               m_parameter_map{
-                  (uint8_t*)write_parameter_map_queue_address, fgc4::utils::constants::json_memory_pool_size, root}
+                  (uint8_t*)write_parameter_map_queue_address, fgc4::utils::constants::json_memory_pool_size, root},
+              m_parameter_setting_task{
+                  (uint8_t*)read_commands_queue_address, (uint8_t*)write_commands_status_queue_address, root,
+                  &m_parameter_map},
+              m_parameter_snapshot{(uint8_t*)parameter_snapshot_address, parameter_snapshot_size}
 
         {
-            // CAUTION: The order of transition method matters
-
-            // clang-format off
-            m_fsm.addState(VSStates::initialization,  &VSMachine::onInitialization,  {&VSMachine::toUnconfiguredFromInit});
-            m_fsm.addState(VSStates::unconfigured,    &VSMachine::onUnconfigured,    {&VSMachine::toConfiguring, &VSMachine::toConfigured});
-            m_fsm.addState(VSStates::configuring,     &VSMachine::onConfiguring,     {&VSMachine::toUnconfigured, &VSMachine::toConfigured});
-            m_fsm.addState(VSStates::configured,      &VSMachine::onConfigured,      {&VSMachine::toConfiguring});
-            // clang-format on
         }
 
         void update()
@@ -77,13 +73,21 @@ namespace vslib::utils
         bool m_init_done{false};
         bool m_user_code_initialised{false};
 
-        ::vslib::RootComponent&   m_root;
-        ::vslib::ParameterSetting m_parameter_setting_task;
-        ::vslib::ParameterMap     m_parameter_map;
+        ::vslib::RootComponent&    m_root;
+        ::vslib::ParameterMap      m_parameter_map;
+        ::vslib::ParameterSetting  m_parameter_setting_task;
+        ::vslib::ParameterSnapshot m_parameter_snapshot;
 
         void onInitialization()
         {
             // everything generic that needs to be done to initialize the vslib
+
+            // Parameters validated before a reboot are restored and validated at once, so that the converter
+            // does not need to wait for all Parameters to be sent again
+            if (m_parameter_snapshot.restore() > 0)
+            {
+                m_parameter_setting_task.validateComponents();
+            }
             m_init_done = true;
         }
 
@@ -96,7 +100,11 @@ namespace vslib::utils
         void onConfiguring()
         {
             // receive and process commands
-            m_parameter_setting_task.receiveJsonCommand();
+            // persist the newly validated values, to be restored after a reboot
+            if (m_parameter_setting_task.receiveJsonCommand())
+            {
+                m_parameter_snapshot.save();
+            }
             // when done, transition away
         }
 
@@ -152,4 +160,13 @@ namespace vslib::utils
         }
     };
 
+    // clang-format off
+    inline constexpr ::utils::FsmTable<VSStates, VSMachine, 4, 2> VSMachine::fsm_table{{
+        {VSStates::initialization,  &VSMachine::onInitialization,  {&VSMachine::toUnconfiguredFromInit}},
+        {VSStates::unconfigured,    &VSMachine::onUnconfigured,    {&VSMachine::toConfiguring, &VSMachine::toConfigured}},
+        {VSStates::configuring,     &VSMachine::onConfiguring,     {&VSMachine::toUnconfigured, &VSMachine::toConfigured}},
+        {VSStates::configured,      &VSMachine::onConfigured,      {&VSMachine::toConfiguring}},
+    }};
+    // clang-format on
+
 }   // namespace vslib::utils
@@ -6,12 +6,20 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 
 #include "messageQueue.hpp"
 #include "staticJson.hpp"
 
 namespace vslib::utils
 {
+    //! Types of the messages sharing the parameter map queue, set as the "type" field of their header
+    namespace parameter_map_message
+    {
+        constexpr std::string_view parameter_map    = "parameter_map";      //!< Parameter map, in its first element
+        constexpr std::string_view parameter_values = "parameter_values";   //!< Values read back by a get command
+    }
+
     //! Helper function to serialize JSON object and write it to the message queue.
     //!
     //! @param json_object JSON object to be copied to the shared memory
@@ -2,15 +2,17 @@
 
 /* This file was automatically generated from fgc4.memmap. Manual editing is discouraged. */
 
-#define app_data_0_1_ADDRESS 0x806100000
-#define app_data_0_1_SIZE    0x00400000
-#define app_data_0_2_ADDRESS 0x806500000
-#define app_data_0_2_SIZE    0x00400000
-#define app_data_0_3_ADDRESS 0x806900000
-#define app_data_0_3_SIZE    0x00400000
-#define app_data_1_2_ADDRESS 0x806D00000
-#define app_data_1_2_SIZE    0x00400000
-#define app_data_1_3_ADDRESS 0x807100000
-#define app_data_1_3_SIZE    0x00400000
-#define app_data_2_3_ADDRESS 0x807500000
-#define app_data_2_3_SIZE    0x00400000
+#define app_data_0_1_ADDRESS             0x806100000
+#define app_data_0_1_SIZE                0x00400000
+#define app_data_0_2_ADDRESS             0x806500000
+#define app_data_0_2_SIZE                0x00400000
+#define app_data_0_3_ADDRESS             0x806900000
+#define app_data_0_3_SIZE                0x00400000
+#define app_data_1_2_ADDRESS             0x806D00000
+#define app_data_1_2_SIZE                0x00400000
+#define app_data_1_3_ADDRESS             0x807100000
+#define app_data_1_3_SIZE                0x00400000
+#define app_data_2_3_ADDRESS             0x807500000
+#define app_data_2_3_SIZE                0x00400000
+#define app_data_parameter_snapshot_ADDRESS 0x847900000
+#define app_data_parameter_snapshot_SIZE 0x00100000
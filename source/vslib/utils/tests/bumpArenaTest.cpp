@@ -0,0 +1,101 @@
+//! @file
+//! @brief File with unit tests of the BumpArena class.
+//! @author Dominik Arominski
+
+#include <array>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+
+#include "bumpArena.hpp"
+
+using namespace vslib::utils;
+
+class BumpArenaTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+    }
+};
+
+//! Tests that objects created one after the other are adjacent, with their alignment respected
+TEST_F(BumpArenaTest, DenseObjects)
+{
+    BumpArena arena;
+    auto&     first  = arena.create<double>(1.0);
+    auto&     second = arena.create<double>(2.0);
+    auto&     flag   = arena.create<bool>(true);
+    auto&     third  = arena.create<double>(3.0);
+
+    EXPECT_EQ(first, 1.0);
+    EXPECT_EQ(third, 3.0);
+    EXPECT_TRUE(flag);
+    EXPECT_EQ(&second, &first + 1);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(&first) % BumpArena::cache_line_size, 0);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(&third) % alignof(double), 0);
+    EXPECT_EQ(reinterpret_cast<std::byte*>(&third) - reinterpret_cast<std::byte*>(&first), 3 * sizeof(double));
+    EXPECT_EQ(arena.usedBytes(), 3 * sizeof(double) + sizeof(bool));
+    EXPECT_EQ(arena.blockCount(), 1);
+}
+
+//! Tests that new blocks are allocated when the last one is full, and that large objects get a dedicated block
+TEST_F(BumpArenaTest, Blocks)
+{
+    BumpArena arena(64);
+    auto&     first = arena.create<std::array<double, 8>>();
+    EXPECT_EQ(arena.blockCount(), 1);
+
+    auto& second = arena.create<double>(1.0);
+    EXPECT_EQ(arena.blockCount(), 2);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(&second) % BumpArena::cache_line_size, 0);
+
+    auto& large = arena.create<std::array<double, 100>>();
+    EXPECT_EQ(arena.blockCount(), 3);
+    large[99] = 2.0;
+    first[7]  = 3.0;
+    EXPECT_EQ(large[99], 2.0);
+
+    auto& text = arena.create<std::string>("text that does not fit in a small string");
+    EXPECT_EQ(text, "text that does not fit in a small string");
+    std::destroy_at(&text);
+}
+
+//! Tests that the storage of a destroyed object is reused by the next object of the same size and alignment only
+TEST_F(BumpArenaTest, ReuseDestroyed)
+{
+    BumpArena arena;
+    auto&     first  = arena.create<double>(1.0);
+    auto&     second = arena.create<double>(2.0);
+    auto&     text   = arena.create<std::string>("text that does not fit in a small string");
+
+    arena.destroy(first);
+    arena.destroy(text);
+    EXPECT_EQ(arena.usedBytes(), sizeof(double));
+
+    auto& counter = arena.create<uint32_t>(3);
+    EXPECT_NE(reinterpret_cast<std::byte*>(&counter), reinterpret_cast<std::byte*>(&first));
+
+    auto& replacement = arena.create<double>(4.0);
+    EXPECT_EQ(&replacement, &first);
+    EXPECT_EQ(replacement, 4.0);
+    EXPECT_EQ(second, 2.0);
+
+    auto& other_text = arena.create<std::string>("another text that does not fit in a small string");
+    EXPECT_EQ(&other_text, &text);
+    EXPECT_EQ(arena.usedBytes(), 2 * sizeof(double) + sizeof(uint32_t) + sizeof(std::string));
+    arena.destroy(other_text);
+}
+
+//! Tests that storage aligned more strictly than the blocks of the arena is refused
+TEST_F(BumpArenaTest, AlignmentAboveCacheLine)
+{
+    BumpArena arena;
+    EXPECT_NE(arena.allocate(8, BumpArena::cache_line_size), nullptr);
+    ASSERT_DEATH(static_cast<void>(arena.allocate(8, 2 * BumpArena::cache_line_size)), "alignment <= cache_line_size");
+}
@@ -0,0 +1,89 @@
+//! @file
+//! @brief File with unit tests of the chunked transfer helpers.
+//! @author Dominik Arominski
+
+#include <array>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <span>
+
+#include "chunkedTransfer.hpp"
+#include "json/json.hpp"
+
+using namespace vslib::utils;
+
+class ChunkedTransferTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+    }
+};
+
+//! Tests that a command is split into a beginning, chunks covering all elements in order, and an end
+TEST_F(ChunkedTransferTest, SplitIntoChunks)
+{
+    const nlohmann::json command
+        = {{"name", "root.table.coefficients"},
+           {"value", std::array<double, 7>{0.5, 1.5, 2.5, 3.5, 4.5, 5.5, 6.5}},
+           {"version", std::array<int, 2>{0, 1}},
+           {"bank", 1}};
+
+    const auto commands = splitIntoChunks(command, 3);
+    ASSERT_EQ(commands.size(), 5);
+
+    EXPECT_EQ(commands[0]["transfer"], transfer_stage::begin);
+    EXPECT_EQ(commands[0]["value"], 7);
+
+    uint64_t checksum = fnv_offset_basis;
+    for (size_t index = 1; index < 4; index++)
+    {
+        const auto& chunk = commands[index];
+        EXPECT_EQ(chunk["transfer"], transfer_stage::chunk);
+        EXPECT_EQ(chunk["offset"], (index - 1) * 3);
+        EXPECT_EQ(chunk["value"][0], command["value"][(index - 1) * 3]);
+        checksum = chunkChecksum(chunk["value"], checksum);
+    }
+    EXPECT_EQ(commands[3]["value"].size(), 1);
+
+    EXPECT_EQ(commands[4]["transfer"], transfer_stage::end);
+    EXPECT_EQ(commands[4]["value"], checksum);
+
+    // all other fields are copied to every command of the transfer
+    for (const auto& part : commands)
+    {
+        EXPECT_EQ(part["name"], command["name"]);
+        EXPECT_EQ(part["version"], command["version"]);
+        EXPECT_EQ(part["bank"], 1);
+    }
+}
+
+//! Tests that the checksum depends on the order of the chunks
+TEST_F(ChunkedTransferTest, ChecksumOrder)
+{
+    const nlohmann::json         first  = {1, 2};
+    const nlohmann::json         second = {3, 4};
+    const std::array<int64_t, 2> binary{1, 2};
+    EXPECT_EQ(chunkChecksum(first), fnv1aHash(std::as_bytes(std::span(binary))));
+    EXPECT_NE(chunkChecksum(second, chunkChecksum(first)), chunkChecksum(first, chunkChecksum(second)));
+}
+
+//! Tests that the checksum hashes the values of the elements, not the way the sender formats them
+TEST_F(ChunkedTransferTest, ChecksumValues)
+{
+    EXPECT_EQ(
+        chunkChecksum(nlohmann::json::parse(R"([150.0, -2, 7, true, "field1"])")),
+        chunkChecksum(nlohmann::json::parse(R"([ 1.5e2, -2, 7, true, "field1" ])"))
+    );
+    // value of the reference implementation in the documentation
+    EXPECT_EQ(chunkChecksum(nlohmann::json::parse(R"([150.0, -2, 7, true, "field1"])")), 13420146719034505933U);
+    // integers and floating-point numbers are told apart, as are strings split differently
+    EXPECT_NE(chunkChecksum(nlohmann::json::parse("[1, 2]")), chunkChecksum(nlohmann::json::parse("[1.0, 2.0]")));
+    EXPECT_NE(
+        chunkChecksum(nlohmann::json::parse(R"(["ab", "c"])")), chunkChecksum(nlohmann::json::parse(R"(["a", "bc"])"))
+    );
+}
@@ -0,0 +1,100 @@
+//! @file
+//! @brief File with unit tests of the binary status record of a batch of commands.
+//! @author Dominik Arominski
+
+#include <gtest/gtest.h>
+#include <string>
+
+#include "commandStatusRecord.hpp"
+
+using namespace vslib::utils;
+
+class CommandStatusRecordTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+    }
+};
+
+//! Tests that an empty record can be serialized and decoded
+TEST_F(CommandStatusRecordTest, EmptyRecord)
+{
+    CommandStatusRecord record(7);
+    EXPECT_TRUE(record.empty());
+
+    const auto serialized = record.serialize();
+    EXPECT_EQ(serialized.size(), record.size());
+    EXPECT_EQ(serialized[0], CommandStatusRecord::marker);
+
+    const auto decoded = CommandStatusRecord::decode(serialized);
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->batch_sequence, 7);
+    EXPECT_TRUE(decoded->statuses.empty());
+    EXPECT_TRUE(decoded->messages.empty());
+}
+
+//! Tests that statuses and messages survive the serialization
+TEST_F(CommandStatusRecordTest, RoundTrip)
+{
+    CommandStatusRecord record(3);
+    EXPECT_TRUE(record.add(0, CommandResult::success));
+    EXPECT_TRUE(record.add(1, CommandResult::parameter_not_found, "Parameter ID: x not found. Command ignored.\n"));
+    EXPECT_TRUE(record.add(2, CommandResult::value_rejected, "Value out of limits.\n"));
+    EXPECT_FALSE(record.empty());
+
+    const auto decoded = CommandStatusRecord::decode(record.serialize());
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->batch_sequence, 3);
+    ASSERT_EQ(decoded->statuses.size(), 3);
+    EXPECT_EQ(decoded->statuses[0], (CommandStatus{0, CommandResult::success, CommandStatusRecord::no_message}));
+    EXPECT_EQ(decoded->statuses[1], (CommandStatus{1, CommandResult::parameter_not_found, 0}));
+    EXPECT_EQ(decoded->statuses[2], (CommandStatus{2, CommandResult::value_rejected, 1}));
+    ASSERT_EQ(decoded->messages.size(), 2);
+    EXPECT_EQ(decoded->messages[0], "Parameter ID: x not found. Command ignored.\n");
+    EXPECT_EQ(decoded->messages[1], "Value out of limits.\n");
+}
+
+//! Tests that a full record refuses further statuses, and that messages are dropped before statuses
+TEST_F(CommandStatusRecordTest, Capacity)
+{
+    CommandStatusRecord record;
+    const std::string   long_message(CommandStatusRecord::capacity, 'x');
+    EXPECT_TRUE(record.add(0, CommandResult::value_rejected, long_message));
+
+    for (uint16_t command_id = 1; command_id < CommandStatusRecord::max_statuses; command_id++)
+    {
+        EXPECT_TRUE(record.add(command_id, CommandResult::success));
+    }
+    EXPECT_FALSE(record.add(CommandStatusRecord::max_statuses, CommandResult::success));
+    EXPECT_LE(record.size(), CommandStatusRecord::capacity);
+
+    const auto decoded = CommandStatusRecord::decode(record.serialize());
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->statuses.size(), CommandStatusRecord::max_statuses);
+    EXPECT_EQ(decoded->statuses[0].message_index, CommandStatusRecord::no_message);
+    EXPECT_TRUE(decoded->messages.empty());
+
+    record.clear();
+    EXPECT_TRUE(record.empty());
+    EXPECT_TRUE(record.add(0, CommandResult::success));
+}
+
+//! Tests that text statuses and malformed records are not decoded as records
+TEST_F(CommandStatusRecordTest, DecodeInvalid)
+{
+    std::string text_status = "Parameter value updated successfully.\n";
+    EXPECT_FALSE(CommandStatusRecord::decode({reinterpret_cast<const uint8_t*>(text_status.data()), text_status.size()})
+                     .has_value());
+
+    CommandStatusRecord record;
+    record.add(0, CommandResult::success);
+    record.add(1, CommandResult::invalid_command, "Command invalid.\n");
+    const auto serialized = record.serialize();
+    EXPECT_FALSE(CommandStatusRecord::decode(serialized.first(4)).has_value());
+    EXPECT_FALSE(CommandStatusRecord::decode(serialized.first(serialized.size() - 1)).has_value());
+}
@@ -0,0 +1,120 @@
+//! @file
+//! @brief File with unit tests of the compile-time lookup of enumeration fields.
+//! @author Dominik Arominski
+
+#include <gtest/gtest.h>
+
+#include "enumLookup.hpp"
+
+using namespace vslib::utils;
+
+class EnumLookupTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+    }
+};
+
+namespace
+{
+    enum class Mode
+    {
+        off,
+        on,
+        standby,
+        fault
+    };
+
+    enum class Sparse
+    {
+        first  = 3,
+        second = 17,
+        third  = 42
+    };
+
+    enum class Empty
+    {
+    };
+
+    enum class Large
+    {
+        field00,
+        field01,
+        field02,
+        field03,
+        field04,
+        field05,
+        field06,
+        field07,
+        field08,
+        field09,
+        field10,
+        field11,
+        field12,
+        field13,
+        field14,
+        field15,
+        field16,
+        field17,
+        field18,
+        field19
+    };
+}
+
+//! Tests that all fields are found by their names, at compile time as well as at run time
+TEST_F(EnumLookupTest, FromName)
+{
+    static_assert(EnumLookup<Mode>::fromName("standby") == Mode::standby);
+    EXPECT_EQ(EnumLookup<Mode>::fromName("off"), Mode::off);
+    EXPECT_EQ(EnumLookup<Mode>::fromName("on"), Mode::on);
+    EXPECT_EQ(EnumLookup<Mode>::fromName("fault"), Mode::fault);
+    EXPECT_EQ(EnumLookup<Sparse>::fromName("second"), Sparse::second);
+
+    for (size_t index = 0; index < EnumLookup<Large>::size(); index++)
+    {
+        const auto name = magic_enum::enum_names<Large>()[index];
+        EXPECT_EQ(EnumLookup<Large>::fromName(name), EnumLookup<Large>::fromIndex(index));
+    }
+}
+
+//! Tests that unknown names are rejected
+TEST_F(EnumLookupTest, FromUnknownName)
+{
+    EXPECT_FALSE(EnumLookup<Mode>::fromName("").has_value());
+    EXPECT_FALSE(EnumLookup<Mode>::fromName("of").has_value());
+    EXPECT_FALSE(EnumLookup<Mode>::fromName("offline").has_value());
+    EXPECT_FALSE(EnumLookup<Mode>::fromName("Standby").has_value());
+    EXPECT_FALSE(EnumLookup<Large>::fromName("field20").has_value());
+    EXPECT_FALSE(EnumLookup<Empty>::fromName("off").has_value());
+}
+
+//! Tests the conversion between fields and their dense indices
+TEST_F(EnumLookupTest, DenseIndex)
+{
+    static_assert(EnumLookup<Sparse>::size() == 3);
+    EXPECT_EQ(EnumLookup<Sparse>::fromIndex(0), Sparse::first);
+    EXPECT_EQ(EnumLookup<Sparse>::fromIndex(2), Sparse::third);
+    EXPECT_FALSE(EnumLookup<Sparse>::fromIndex(3).has_value());
+    EXPECT_FALSE(EnumLookup<Empty>::fromIndex(0).has_value());
+
+    EXPECT_EQ(EnumLookup<Sparse>::toIndex(Sparse::second), 1);
+    EXPECT_FALSE(EnumLookup<Sparse>::toIndex(static_cast<Sparse>(4)).has_value());
+
+    for (size_t index = 0; index < EnumLookup<Large>::size(); index++)
+    {
+        EXPECT_EQ(EnumLookup<Large>::toIndex(EnumLookup<Large>::fromIndex(index).value()), index);
+    }
+}
+
+//! Tests that a seed making the hash perfect is found for typical enumerations
+TEST_F(EnumLookupTest, PerfectHash)
+{
+    EXPECT_TRUE(EnumLookup<Mode>::isPerfect());
+    EXPECT_TRUE(EnumLookup<Sparse>::isPerfect());
+    EXPECT_TRUE(EnumLookup<Large>::isPerfect());
+}
@@ -172,3 +172,104 @@ TEST_F(FixedPointTest, CompareFixedPointVariablesCloseToMaximum)
     EXPECT_EQ(lhs == rhs, false);
     EXPECT_EQ(lhs != rhs, true);
 }
+
+TEST_F(FixedPointTest, MultiplyFixedPointVariablesWideIntermediate)
+{
+    // the product of the stored values needs 2 * 40 + 3 bits, which used to overflow the 64-bit multiplication
+    constexpr unsigned short     franctional_bits = 40;
+    FixedPoint<franctional_bits> lhs              = 3.0;
+    FixedPoint<franctional_bits> rhs              = -2.5;
+    EXPECT_EQ((lhs * rhs).toDouble(), -7.5);
+    lhs *= rhs;
+    EXPECT_EQ(lhs.toDouble(), -7.5);
+}
+
+TEST_F(FixedPointTest, DivideFixedPointVariablesWideIntermediate)
+{
+    // the dividend is scaled by 2^40 before the division, which used to overflow the 64-bit shift
+    constexpr unsigned short     franctional_bits = 40;
+    FixedPoint<franctional_bits> lhs              = 3.0;
+    FixedPoint<franctional_bits> rhs              = -2.0;
+    EXPECT_EQ((lhs / rhs).toDouble(), -1.5);
+    lhs /= rhs;
+    EXPECT_EQ(lhs.toDouble(), -1.5);
+}
+
+TEST_F(FixedPointTest, SaturatingFixedPointArithmetic)
+{
+    using Q15                 = FixedPoint<15, int32_t>;
+    constexpr int32_t maximum = std::numeric_limits<int32_t>::max();
+    constexpr int32_t minimum = std::numeric_limits<int32_t>::min();
+
+    const Q15 large = 60000.0;
+    EXPECT_EQ((large + large).value(), maximum);
+    EXPECT_EQ((Q15(-60000.0) - large).value(), minimum);
+    EXPECT_EQ((large * large).value(), maximum);
+    EXPECT_EQ((large * Q15(-2.0)).value(), minimum);
+    EXPECT_EQ((large / Q15(0.5)).value(), maximum);
+
+    Q15 accumulator = large;
+    accumulator     += large;
+    EXPECT_EQ(accumulator.value(), maximum);
+    accumulator -= Q15::fromRaw(minimum);
+    EXPECT_EQ(accumulator.value(), maximum);
+}
+
+TEST_F(FixedPointTest, DivideFixedPointByZero)
+{
+    using Q15 = FixedPoint<15, int32_t>;
+    EXPECT_EQ((Q15(1.0) / Q15(0.0)).value(), std::numeric_limits<int32_t>::max());
+    EXPECT_EQ((Q15(-1.0) / Q15(0.0)).value(), std::numeric_limits<int32_t>::min());
+}
+
+TEST_F(FixedPointTest, MultiplyFixedPointRoundingModes)
+{
+    // with two fractional bits, products of the stored values are scaled by 4: 1 * 2 / 4 = 0.5 and 3 * 2 / 4 = 1.5
+    using Nearest     = FixedPoint<2, int32_t, RoundingMode::nearest>;
+    using NearestEven = FixedPoint<2, int32_t, RoundingMode::nearestEven>;
+    using Floor       = FixedPoint<2, int32_t, RoundingMode::floor>;
+    using TowardZero  = FixedPoint<2, int32_t, RoundingMode::towardZero>;
+
+    EXPECT_EQ((Nearest::fromRaw(1) * Nearest::fromRaw(2)).value(), 1);
+    EXPECT_EQ((Nearest::fromRaw(-1) * Nearest::fromRaw(2)).value(), 0);
+    EXPECT_EQ((Nearest::fromRaw(3) * Nearest::fromRaw(2)).value(), 2);
+    EXPECT_EQ((Nearest::fromRaw(-3) * Nearest::fromRaw(2)).value(), -1);
+
+    EXPECT_EQ((NearestEven::fromRaw(1) * NearestEven::fromRaw(2)).value(), 0);
+    EXPECT_EQ((NearestEven::fromRaw(-1) * NearestEven::fromRaw(2)).value(), 0);
+    EXPECT_EQ((NearestEven::fromRaw(3) * NearestEven::fromRaw(2)).value(), 2);
+    EXPECT_EQ((NearestEven::fromRaw(-3) * NearestEven::fromRaw(2)).value(), -2);
+
+    EXPECT_EQ((Floor::fromRaw(1) * Floor::fromRaw(2)).value(), 0);
+    EXPECT_EQ((Floor::fromRaw(-1) * Floor::fromRaw(2)).value(), -1);
+    EXPECT_EQ((Floor::fromRaw(3) * Floor::fromRaw(2)).value(), 1);
+    EXPECT_EQ((Floor::fromRaw(-3) * Floor::fromRaw(2)).value(), -2);
+
+    EXPECT_EQ((TowardZero::fromRaw(1) * TowardZero::fromRaw(2)).value(), 0);
+    EXPECT_EQ((TowardZero::fromRaw(-1) * TowardZero::fromRaw(2)).value(), 0);
+    EXPECT_EQ((TowardZero::fromRaw(3) * TowardZero::fromRaw(2)).value(), 1);
+    EXPECT_EQ((TowardZero::fromRaw(-3) * TowardZero::fromRaw(2)).value(), -1);
+}
+
+TEST_F(FixedPointTest, DivideFixedPointRoundingModes)
+{
+    // with two fractional bits, 0.25 / 2 = 0.125 and 0.75 / 2 = 0.375, i.e. half and one and a half of the LSB
+    using Nearest     = FixedPoint<2, int32_t, RoundingMode::nearest>;
+    using NearestEven = FixedPoint<2, int32_t, RoundingMode::nearestEven>;
+    using Floor       = FixedPoint<2, int32_t, RoundingMode::floor>;
+    using TowardZero  = FixedPoint<2, int32_t, RoundingMode::towardZero>;
+
+    EXPECT_EQ((Nearest(0.25) / Nearest(2.0)).value(), 1);
+    EXPECT_EQ((Nearest(-0.25) / Nearest(2.0)).value(), 0);
+    EXPECT_EQ((Nearest(0.75) / Nearest(-2.0)).value(), -1);
+
+    EXPECT_EQ((NearestEven(0.25) / NearestEven(2.0)).value(), 0);
+    EXPECT_EQ((NearestEven(0.75) / NearestEven(2.0)).value(), 2);
+    EXPECT_EQ((NearestEven(0.75) / NearestEven(-2.0)).value(), -2);
+
+    EXPECT_EQ((Floor(0.25) / Floor(2.0)).value(), 0);
+    EXPECT_EQ((Floor(-0.25) / Floor(2.0)).value(), -1);
+
+    EXPECT_EQ((TowardZero(0.75) / TowardZero(2.0)).value(), 1);
+    EXPECT_EQ((TowardZero(-0.75) / TowardZero(2.0)).value(), -1);
+}
@@ -0,0 +1,132 @@
+//! @file
+//! @brief File with packed fixed-point vector tests.
+//! @author Dominik Arominski
+
+#include <gtest/gtest.h>
+
+#include "fixedPointVector.hpp"
+
+using namespace vslib;
+
+class FixedPointVectorTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+    }
+};
+
+TEST_F(FixedPointVectorTest, CreateDefaultVector)
+{
+    FixedPointVector<4, 15> vector;
+    EXPECT_EQ(vector.size(), 4);
+    for (const auto& value : vector.toDouble())
+    {
+        EXPECT_EQ(value, 0.0);
+    }
+}
+
+TEST_F(FixedPointVectorTest, CreateCustomVector)
+{
+    constexpr unsigned short franctional_bits = 20;
+    std::array<double, 5>    values{3.14159, -2.7128, 0.5, -0.25, 100.0};
+
+    FixedPointVector<5, franctional_bits> vector(values);
+    for (size_t index = 0; index < values.size(); index++)
+    {
+        EXPECT_NEAR(vector[index].toDouble(), values[index], pow(2, -franctional_bits));
+        EXPECT_EQ(vector[index], (FixedPoint<franctional_bits, int32_t>(values[index])));
+    }
+}
+
+//! Checks that lane-wise arithmetic matches the scalar FixedPoint type for all lane widths, including the lengths
+//! which do not fill whole SIMD registers
+template<typename VectorType>
+void checkAgainstScalar(const VectorType& lhs, const VectorType& rhs)
+{
+    using ElementType = typename VectorType::ElementType;
+
+    const auto sum        = lhs + rhs;
+    const auto difference = lhs - rhs;
+    const auto product    = lhs * rhs;
+    for (size_t index = 0; index < VectorType::size(); index++)
+    {
+        EXPECT_EQ(sum[index], ElementType(lhs[index] + rhs[index]));
+        EXPECT_EQ(difference[index], ElementType(lhs[index] - rhs[index]));
+        EXPECT_EQ(product[index], ElementType(lhs[index] * rhs[index]));
+    }
+}
+
+TEST_F(FixedPointVectorTest, ArithmeticMatchesScalar32BitLanes)
+{
+    constexpr int32_t maximum = std::numeric_limits<int32_t>::max();
+    constexpr int32_t minimum = std::numeric_limits<int32_t>::min();
+
+    const auto lhs = FixedPointVector<8, 16>::fromRaw({maximum, minimum, 123456, -98765, 65536, -65536, 1, maximum});
+    const auto rhs = FixedPointVector<8, 16>::fromRaw({1, -1, 654321, 56789, 32768, 32768, -1, maximum});
+    checkAgainstScalar(lhs, rhs);
+
+    const auto odd_lhs = FixedPointVector<3, 16>::fromRaw({maximum, -98765, 65536});
+    const auto odd_rhs = FixedPointVector<3, 16>::fromRaw({1, 56789, 32768});
+    checkAgainstScalar(odd_lhs, odd_rhs);
+}
+
+TEST_F(FixedPointVectorTest, ArithmeticMatchesScalar16BitLanes)
+{
+    constexpr int16_t maximum = std::numeric_limits<int16_t>::max();
+    constexpr int16_t minimum = std::numeric_limits<int16_t>::min();
+
+    const auto lhs
+        = FixedPointVector<8, 8, int16_t>::fromRaw({maximum, minimum, 1234, -9876, 256, -256, 1, maximum});
+    const auto rhs = FixedPointVector<8, 8, int16_t>::fromRaw({1, -1, 4321, 5678, 128, 128, -1, maximum});
+    checkAgainstScalar(lhs, rhs);
+}
+
+TEST_F(FixedPointVectorTest, SaturatingVectorArithmetic)
+{
+    constexpr int32_t maximum = std::numeric_limits<int32_t>::max();
+    constexpr int32_t minimum = std::numeric_limits<int32_t>::min();
+
+    auto       vector = FixedPointVector<4, 16>::fromRaw({maximum, minimum, maximum, 0});
+    const auto offset = FixedPointVector<4, 16>::fromRaw({maximum, minimum, -1, 0});
+    vector            += offset;
+    EXPECT_EQ(vector.value(), (std::array<int32_t, 4>{maximum, minimum, maximum - 1, 0}));
+    vector -= offset;
+    EXPECT_EQ(vector.value(), (std::array<int32_t, 4>{0, 0, maximum, 0}));
+    vector *= FixedPointVector<4, 16>(std::array<double, 4>{2.0, 2.0, 2.0, 2.0});
+    EXPECT_EQ(vector.value(), (std::array<int32_t, 4>{0, 0, maximum, 0}));
+}
+
+TEST_F(FixedPointVectorTest, DotProduct)
+{
+    FixedPointVector<4, 24> lhs(std::array<double, 4>{0.25, 0.5, -0.75, 1.0});
+    FixedPointVector<4, 24> rhs(std::array<double, 4>{4.0, -2.0, 2.0, 1.5});
+    EXPECT_EQ(lhs.dot(rhs).toDouble(), 1.0 - 1.0 - 1.5 + 1.5);
+
+    // intermediate products are kept at full precision, only the final sum is saturated
+    FixedPointVector<2, 24> large(std::array<double, 2>{100.0, 100.0});
+    FixedPointVector<2, 24> signs(std::array<double, 2>{1.0, -1.0});
+    EXPECT_EQ(large.dot(large).value(), std::numeric_limits<int32_t>::max());
+    EXPECT_EQ(large.dot(signs).value(), 0);
+}
+
+TEST_F(FixedPointVectorTest, DotProductSaturatesAccumulator)
+{
+    constexpr int32_t maximum = std::numeric_limits<int32_t>::max();
+    constexpr int32_t minimum = std::numeric_limits<int32_t>::min();
+
+    // each product is 2^62, so the sum of the four exceeds the range of the 64-bit accumulator
+    const auto minimums = FixedPointVector<4, 16>::fromRaw({minimum, minimum, minimum, minimum});
+    const auto maximums = FixedPointVector<4, 16>::fromRaw({maximum, maximum, maximum, maximum});
+    EXPECT_EQ(minimums.dot(minimums).value(), maximum);
+    EXPECT_EQ(minimums.dot(maximums).value(), minimum);
+
+    constexpr int64_t wide_minimum = std::numeric_limits<int64_t>::min();
+    const auto        wide_minimums
+        = FixedPointVector<4, 32, int64_t>::fromRaw({wide_minimum, wide_minimum, wide_minimum, wide_minimum});
+    EXPECT_EQ(wide_minimums.dot(wide_minimums).value(), std::numeric_limits<int64_t>::max());
+}
@@ -0,0 +1,40 @@
+//! @file
+//! @brief File with unit tests of the FNV-1a hash function.
+//! @author Dominik Arominski
+
+#include <array>
+#include <gtest/gtest.h>
+
+#include "fnvHash.hpp"
+
+using namespace vslib::utils;
+
+class FnvHashTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+    }
+};
+
+//! Tests the hash of strings against reference values of the 64-bit FNV-1a hash
+TEST_F(FnvHashTest, ReferenceValues)
+{
+    static_assert(fnv1aHash("") == 0xCBF29CE484222325);
+    EXPECT_EQ(fnv1aHash("a"), 0xAF63DC4C8601EC8C);
+    EXPECT_EQ(fnv1aHash("foobar"), 0x85944171F73967E8);
+}
+
+//! Tests that strings and bytes with the same contents have the same hash, and that hashing can be done in parts
+TEST_F(FnvHashTest, BytesAndParts)
+{
+    const std::array<std::byte, 6> bytes{std::byte{'f'}, std::byte{'o'}, std::byte{'o'},
+                                         std::byte{'b'}, std::byte{'a'}, std::byte{'r'}};
+    EXPECT_EQ(fnv1aHash(std::span<const std::byte>(bytes)), fnv1aHash("foobar"));
+    EXPECT_EQ(fnv1aHash("bar", fnv1aHash("foo")), fnv1aHash("foobar"));
+    EXPECT_NE(fnv1aHash("root.name.a"), fnv1aHash("root.name.b"));
+}
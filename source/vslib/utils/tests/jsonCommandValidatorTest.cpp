@@ -0,0 +1,94 @@
+//! @file
+//! @brief File with unit tests of the validator specialised for the command schema.
+//! @author Dominik Arominski
+
+#include <array>
+#include <gtest/gtest.h>
+#include <string>
+
+#include "json/json.hpp"
+#include "jsonCommandValidator.hpp"
+#include "staticJson.hpp"
+
+using namespace vslib::utils;
+
+class JsonCommandValidatorTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+    }
+};
+
+//! Tests that valid commands with all supported value types are accepted
+TEST_F(JsonCommandValidatorTest, ValidCommands)
+{
+    std::string error;
+    for (const nlohmann::json& value : {nlohmann::json(1.0), nlohmann::json(-3), nlohmann::json(true),
+                                        nlohmann::json("enum"), nlohmann::json(std::array<double, 2>{1.0, 2.0})})
+    {
+        const nlohmann::json command = {{"name", "test"}, {"value", value}, {"version", std::array<int, 2>{0, 1}}};
+        EXPECT_TRUE(validateCommandSchema(command, error));
+    }
+    EXPECT_TRUE(error.empty());
+
+    fgc4::utils::StaticJson command = fgc4::utils::StaticJsonFactory::getJsonObject();
+    command["name"]                 = "test";
+    command["value"]                = 1.0;
+    command["version"]              = std::array<int, 2>{0, 1};
+    EXPECT_TRUE(validateCommandSchema(command, error));
+}
+
+//! Tests that missing keys are reported in the same way as by the generic schema validator
+TEST_F(JsonCommandValidatorTest, MissingKeys)
+{
+    std::string error;
+
+    EXPECT_FALSE(validateCommandSchema(nlohmann::json{{"value", 1.0}, {"version", std::array<int, 2>{0, 1}}}, error));
+    EXPECT_EQ(error, "At  of {\"value\":1.0,\"version\":[0,1]} - required property 'name' not found in object\n");
+
+    EXPECT_FALSE(validateCommandSchema(nlohmann::json{{"name", "test"}, {"version", std::array<int, 2>{0, 1}}}, error));
+    EXPECT_EQ(error, "At  of {\"name\":\"test\",\"version\":[0,1]} - required property 'value' not found in object\n");
+
+    EXPECT_FALSE(validateCommandSchema(nlohmann::json{{"name", "test"}, {"value", 1.0}}, error));
+    EXPECT_EQ(error, "At  of {\"name\":\"test\",\"value\":1.0} - required property 'version' not found in object\n");
+
+    // missing keys are reported before keys of a wrong type
+    EXPECT_FALSE(validateCommandSchema(nlohmann::json{{"name", 1}, {"value", 1.0}}, error));
+    EXPECT_EQ(error, "At  of {\"name\":1,\"value\":1.0} - required property 'version' not found in object\n");
+}
+
+//! Tests that keys of a wrong type are reported in the same way as by the generic schema validator
+TEST_F(JsonCommandValidatorTest, WrongTypes)
+{
+    std::string error;
+
+    EXPECT_FALSE(validateCommandSchema(nlohmann::json{{"name", "test"}, {"value", 1.0}, {"version", "0,1"}}, error));
+    EXPECT_EQ(error, "At /version of \"0,1\" - unexpected instance type\n");
+
+    EXPECT_FALSE(validateCommandSchema(nlohmann::json{{"name", 5}, {"value", 1.0}, {"version", {0, 1}}}, error));
+    EXPECT_EQ(error, "At /name of 5 - unexpected instance type\n");
+
+    EXPECT_FALSE(validateCommandSchema(nlohmann::json{{"name", ""}, {"value", 1.0}, {"version", {0, 1}}}, error));
+    EXPECT_EQ(error, "At /name of \"\" - instance is too short as per minLength:1\n");
+
+    const nlohmann::json null_value = {{"name", "test"}, {"value", nullptr}, {"version", {0, 1}}};
+    EXPECT_FALSE(validateCommandSchema(null_value, error));
+    EXPECT_EQ(error, "At /value of null - unexpected instance type\n");
+
+    EXPECT_FALSE(validateCommandSchema(nlohmann::json::array({1, 2}), error));
+    EXPECT_EQ(error, "At  of [1,2] - unexpected instance type\n");
+}
+
+//! Tests that additional keys are allowed, as by the schema
+TEST_F(JsonCommandValidatorTest, AdditionalKeys)
+{
+    std::string          error;
+    const nlohmann::json command
+        = {{"name", "test"}, {"value", 1.0}, {"version", std::array<int, 2>{0, 1}}, {"comment", nullptr}};
+    EXPECT_TRUE(validateCommandSchema(command, error));
+}
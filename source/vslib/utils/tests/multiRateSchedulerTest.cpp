@@ -0,0 +1,178 @@
+//! @file
+//! @brief File with unit tests of the MultiRateScheduler class.
+//! @author Dominik Arominski
+
+#include <gtest/gtest.h>
+#include <set>
+#include <vector>
+
+#include "multiRateScheduler.hpp"
+
+using namespace vslib;
+
+class MultiRateSchedulerTest : public ::testing::Test
+{
+};
+
+namespace
+{
+    //! Task recording the ticks it ran on and advancing a shared counter by its duration
+    struct RecordingTask
+    {
+        uint64_t              duration{0};
+        uint64_t*             counter{nullptr};
+        const uint64_t*       tick{nullptr};
+        std::vector<uint64_t> runs{};
+
+        void run()
+        {
+            runs.push_back(*tick);
+            if (counter != nullptr)
+            {
+                *counter += duration;
+            }
+        }
+    };
+
+    constexpr auto run_task = [](RecordingTask& task)
+    {
+        task.run();
+    };
+}
+
+//! Checks that each task runs at its divisor of the base rate
+TEST_F(MultiRateSchedulerTest, Divisors)
+{
+    uint64_t      tick = 0;
+    RecordingTask fast{.tick = &tick};
+    RecordingTask medium{.tick = &tick};
+    RecordingTask slow{.tick = &tick};
+
+    MultiRateScheduler<4> scheduler;
+    const auto            slow_id   = scheduler.addTask<run_task>(slow, 5);
+    const auto            fast_id   = scheduler.addTask<run_task>(fast, 1);
+    const auto            medium_id = scheduler.addTask<run_task>(medium, 2);
+
+    for (tick = 0; tick < 20; tick++)
+    {
+        scheduler.tick();
+    }
+    EXPECT_EQ(scheduler.ticks(), 20);
+    EXPECT_EQ(fast.runs.size(), 20);
+    EXPECT_EQ(medium.runs.size(), 10);
+    EXPECT_EQ(slow.runs.size(), 4);
+
+    for (size_t index = 1; index < medium.runs.size(); index++)
+    {
+        EXPECT_EQ(medium.runs[index] - medium.runs[index - 1], 2);
+    }
+    EXPECT_EQ(medium.runs[0], scheduler.phase(medium_id));
+    EXPECT_EQ(slow.runs[0], scheduler.phase(slow_id));
+    EXPECT_EQ(scheduler.phase(fast_id), 0);
+}
+
+//! Checks that slow tasks with the same divisor are spread over different ticks
+TEST_F(MultiRateSchedulerTest, PhaseStaggering)
+{
+    uint64_t                   tick = 0;
+    std::vector<RecordingTask> tasks(4, RecordingTask{.tick = &tick});
+    RecordingTask      fast{.tick = &tick};
+    MultiRateScheduler<5>      scheduler;
+
+    std::set<uint32_t> phases;
+    for (auto& task : tasks)
+    {
+        phases.insert(scheduler.phase(scheduler.addTask<run_task>(task, 4)));
+    }
+    EXPECT_EQ(phases, (std::set<uint32_t>{0, 1, 2, 3}));
+    EXPECT_EQ(scheduler.plannedPeakWeight(), 1);
+
+    // without staggering all five tasks would run on the same tick
+    scheduler.addTask<run_task>(fast, 1);
+    EXPECT_EQ(scheduler.plannedPeakWeight(), 2);
+}
+
+//! Checks that the phases take the expected execution times of the tasks into account
+TEST_F(MultiRateSchedulerTest, WeightedPhases)
+{
+    uint64_t      tick = 0;
+    RecordingTask heavy{.tick = &tick};
+    RecordingTask first_light{.tick = &tick};
+    RecordingTask second_light{.tick = &tick};
+
+    MultiRateScheduler<3> scheduler;
+    const auto            heavy_id        = scheduler.addTask<run_task>(heavy, 2, 3);
+    const auto            first_light_id  = scheduler.addTask<run_task>(first_light, 4);
+    const auto            second_light_id = scheduler.addTask<run_task>(second_light, 4);
+
+    // the light tasks are placed on the ticks left free by the heavy one
+    EXPECT_EQ(scheduler.phase(heavy_id), 0);
+    EXPECT_EQ(scheduler.phase(first_light_id), 1);
+    EXPECT_EQ(scheduler.phase(second_light_id), 3);
+    EXPECT_EQ(scheduler.plannedPeakWeight(), 3);
+}
+
+//! Checks that the load of each rate and the worst tick are measured with the provided counter
+TEST_F(MultiRateSchedulerTest, Load)
+{
+    uint64_t      counter = 0;
+    uint64_t      tick    = 0;
+    RecordingTask fast{.duration = 10, .counter = &counter, .tick = &tick};
+    RecordingTask first_slow{.duration = 40, .counter = &counter, .tick = &tick};
+    RecordingTask second_slow{.duration = 40, .counter = &counter, .tick = &tick};
+
+    MultiRateScheduler<3> scheduler;
+    const auto            fast_id = scheduler.addTask<run_task>(fast, 1);
+    const auto            slow_id = scheduler.addTask<run_task>(first_slow, 2, 4);
+    scheduler.addTask<run_task>(second_slow, 2, 4);
+
+    constexpr uint64_t period = 100;
+    for (tick = 0; tick < 10; tick++)
+    {
+        scheduler.tick(
+            [&counter]
+            {
+                return counter;
+            }
+        );
+    }
+    EXPECT_EQ(scheduler.load(fast_id).runs, 10);
+    EXPECT_EQ(scheduler.load(fast_id).worst, 10);
+    EXPECT_EQ(scheduler.load(slow_id).runs, 5);
+    EXPECT_EQ(scheduler.load(slow_id).total, 200);
+    EXPECT_DOUBLE_EQ(scheduler.rateLoad(1, period), 0.1);
+    EXPECT_DOUBLE_EQ(scheduler.rateLoad(2, period), 0.4);
+    // the slow tasks are staggered, so the worst tick runs a single one of them
+    EXPECT_DOUBLE_EQ(scheduler.worstTickLoad(period), 0.5);
+
+    scheduler.resetStatistics();
+    EXPECT_EQ(scheduler.ticks(), 0);
+    EXPECT_EQ(scheduler.load(fast_id).runs, 0);
+    EXPECT_DOUBLE_EQ(scheduler.worstTickLoad(period), 0.0);
+}
+
+//! Checks that invalid divisors and too many tasks are rejected
+TEST_F(MultiRateSchedulerTest, InvalidTasks)
+{
+    uint64_t      tick = 0;
+    RecordingTask task{.tick = &tick};
+
+    MultiRateScheduler<1, 16> scheduler;
+    EXPECT_THROW(scheduler.addTask<run_task>(task, 0), std::out_of_range);
+    EXPECT_THROW(scheduler.addTask<run_task>(task, 17), std::out_of_range);
+    scheduler.addTask<run_task>(task, 16);
+    EXPECT_THROW(scheduler.addTask<run_task>(task, 1), std::length_error);
+}
+
+//! Checks that the statistics of a task that has not been added are not read
+TEST_F(MultiRateSchedulerTest, UnknownTask)
+{
+    uint64_t      tick = 0;
+    RecordingTask task{.tick = &tick};
+
+    MultiRateScheduler<2> scheduler;
+    const auto            id = scheduler.addTask<run_task>(task, 1);
+    EXPECT_EQ(scheduler.phase(id), 0);
+    ASSERT_DEATH(static_cast<void>(scheduler.load(id + 1)), "id < m_number_tasks");
+    ASSERT_DEATH(static_cast<void>(scheduler.phase(id + 1)), "id < m_number_tasks");
+}
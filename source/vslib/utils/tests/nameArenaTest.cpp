@@ -0,0 +1,74 @@
+//! @file
+//! @brief File with unit tests of the NameArena class.
+//! @author Dominik Arominski
+
+#include <gtest/gtest.h>
+#include <string>
+
+#include "nameArena.hpp"
+
+using namespace vslib::utils;
+
+class NameArenaTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+    }
+};
+
+//! Tests that the parts of a name are interned contiguously and remain valid after the original is destroyed
+TEST_F(NameArenaTest, Intern)
+{
+    auto&            arena = NameArena::instance();
+    std::string_view full_name;
+    {
+        const std::string parent = "root.parent";
+        const std::string name   = "child";
+        full_name                = arena.intern(parent, ".", name);
+    }
+    EXPECT_EQ(full_name, "root.parent.child");
+    EXPECT_TRUE(arena.holds(full_name));
+    EXPECT_TRUE(arena.holds(full_name.substr(12)));
+
+    const std::string external = "root.parent.child";
+    EXPECT_FALSE(arena.holds(external));
+    EXPECT_EQ(arena.intern(), "");
+}
+
+//! Tests that shared names are interned only once
+TEST_F(NameArenaTest, InternShared)
+{
+    auto&      arena = NameArena::instance();
+    const auto first = arena.internShared(std::string("ComponentType"));
+    const auto bytes = arena.usedBytes();
+
+    const auto second = arena.internShared("ComponentType");
+    EXPECT_EQ(first, "ComponentType");
+    EXPECT_EQ(first.data(), second.data());
+    EXPECT_EQ(arena.usedBytes(), bytes);
+}
+
+//! Tests that names are allocated in large blocks, and that names longer than a block get a dedicated one
+TEST_F(NameArenaTest, Blocks)
+{
+    auto&      arena  = NameArena::instance();
+    const auto blocks = arena.blockCount();
+    const auto bytes  = arena.usedBytes();
+
+    for (int index = 0; index < 100; index++)
+    {
+        [[maybe_unused]] const auto name = arena.intern("root.component.parameter_", std::to_string(index));
+    }
+    EXPECT_LE(arena.blockCount(), blocks + 1);
+    EXPECT_GT(arena.usedBytes(), bytes);
+
+    const std::string long_name(NameArena::block_size + 10, 'a');
+    const auto        interned = arena.intern(long_name);
+    EXPECT_EQ(interned, long_name);
+    EXPECT_TRUE(arena.holds(interned));
+}
@@ -0,0 +1,95 @@
+//! @file
+//! @brief File with unit tests of the integer phase accumulator.
+//! @author Dominik Arominski
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+#include <numbers>
+
+#include "phaseAccumulator.hpp"
+
+using namespace vslib;
+
+class PhaseAccumulatorTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+    }
+};
+
+//! Tests default construction of the phase accumulator
+TEST_F(PhaseAccumulatorTest, DefaultConstruction)
+{
+    PhaseAccumulator phase;
+    EXPECT_EQ(phase.value(), 0);
+    EXPECT_EQ(phase.toRadians(), 0.0);
+}
+
+//! Tests creating the phase accumulator from an angle in and out of the 0 to 2pi range
+TEST_F(PhaseAccumulatorTest, FromRadians)
+{
+    EXPECT_NEAR(PhaseAccumulator::fromRadians(1.0).toRadians(), 1.0, 1e-15);
+    EXPECT_EQ(PhaseAccumulator::fromRadians(std::numbers::pi).value(), uint64_t{1} << 63);
+    EXPECT_NEAR(PhaseAccumulator::fromRadians(-std::numbers::pi / 2).toRadians(), 1.5 * std::numbers::pi, 1e-15);
+    EXPECT_NEAR(PhaseAccumulator::fromRadians(7.0 * std::numbers::pi / 2).toRadians(), 1.5 * std::numbers::pi, 1e-12);
+}
+
+//! Tests that advancing the angle wraps around the period in both directions
+TEST_F(PhaseAccumulatorTest, WrapAround)
+{
+    PhaseAccumulator phase = PhaseAccumulator::fromRadians(1.5 * std::numbers::pi);
+    phase.advance(std::numbers::pi);
+    EXPECT_NEAR(phase.toRadians(), 0.5 * std::numbers::pi, 1e-15);
+
+    phase.advance(-std::numbers::pi);
+    EXPECT_NEAR(phase.toRadians(), 1.5 * std::numbers::pi, 1e-15);
+
+    phase.reset();
+    phase.advance(-0.25);
+    EXPECT_NEAR(phase.toRadians(), 2.0 * std::numbers::pi - 0.25, 1e-15);
+}
+
+//! Tests that a long integration keeps the same precision as a double-precision fmod reduction
+TEST_F(PhaseAccumulatorTest, LongIntegration)
+{
+    const double     increment = 2.0 * std::numbers::pi * 50.0 * 1e-5;   // 50 Hz sampled at 100 kHz
+    PhaseAccumulator phase;
+    double           wt = 0.0;
+    for (size_t index = 0; index < 1'000'000; index++)
+    {
+        phase.advance(increment);
+        wt = std::fmod(wt + increment, 2.0 * std::numbers::pi);
+        ASSERT_NEAR(std::remainder(phase.toRadians() - wt, 2.0 * std::numbers::pi), 0.0, 1e-9);
+    }
+}
+
+//! Tests conversion of the angle to single precision
+TEST_F(PhaseAccumulatorTest, SinglePrecision)
+{
+    const PhaseAccumulator phase = PhaseAccumulator::fromRadians(2.5);
+    EXPECT_NEAR(phase.toRadians<float>(), 2.5F, 1e-6);
+}
+
+//! Tests that phases just below the full period, which round up to 2pi in the conversion, are returned as 0
+TEST_F(PhaseAccumulatorTest, FullScaleConversion)
+{
+    PhaseAccumulator phase;
+    phase.advance(-PhaseAccumulator::radians_per_unit);
+    ASSERT_EQ(phase.value(), std::numeric_limits<uint64_t>::max());
+    EXPECT_GE(phase.toRadians(), 0.0);
+    EXPECT_LT(phase.toRadians(), 2.0 * std::numbers::pi);
+    EXPECT_GE(phase.toRadians<float>(), 0.0F);
+    EXPECT_LT(phase.toRadians<float>(), static_cast<float>(2.0 * std::numbers::pi));
+
+    // still representable in double precision, but not in single precision
+    phase.reset();
+    phase.advance(-1e-9);
+    EXPECT_LT(phase.toRadians(), 2.0 * std::numbers::pi);
+    EXPECT_LT(phase.toRadians<float>(), static_cast<float>(2.0 * std::numbers::pi));
+}
@@ -3,7 +3,9 @@
 #pragma once
 
 //! Generic Parameter
+#include "bankedValue.hpp"
 #include "parameter.hpp"
+#include "parameterBank.hpp"
 
 //! Generic Component
 #include "component.hpp"